@@ -1,15 +1,28 @@
 import type { LTDCConfigState, ClkConfigState } from './types'
 
 const MESSAGE_SIZE = 64
+const SEQ_OFFSET = MESSAGE_SIZE - 2
 
 export type MessageOut = Uint8Array
 export type MessageIn = {
   type: number
   size: number
+  seq: number
   data: Uint8Array
 }
 
-enum CommandOut {
+export enum CommandOut {
+  ANIMATE = 0xb6,
+  GET_ANIM_STATS = 0xb7,
+  GET_MFD_STATS = 0xb8,
+  MFD_SET_VALUES = 0xb9,
+  SHOW_LIST = 0xba,
+  DLIST_END = 0xbb,
+  DLIST_CHUNK = 0xbc,
+  DLIST_BEGIN = 0xbd,
+  BENCH_BLEND = 0xbe,
+  BENCH_PIXEL = 0xbf,
+  BENCH_ROTATE = 0xc0,
   NEXT_SCREEN = 0xc1,
   PREV_SCREEN = 0xc2,
   GET_CONFIG = 0xc3,
@@ -18,6 +31,29 @@ enum CommandOut {
   PUSH_CLK_CONFIG = 0xc6,
   GET_ADV7393_CONFIG = 0xc7,
   PUSH_ADV7393_CONFIG = 0xc8,
+  BATCH_BEGIN = 0xc9,
+  BATCH_COMMIT = 0xca,
+  SET_BAUD_RATE = 0xcb,
+  UPLOAD_BEGIN = 0xcc,
+  UPLOAD_CHUNK = 0xcd,
+  UPLOAD_END = 0xce,
+  GET_UPLOAD_STATUS = 0xcf,
+  SCREENSHOT = 0xd0,
+  GET_CHECKSUM = 0xd1,
+  WATCH_CHECKSUM = 0xd2,
+  GET_CHECKSUM_WATCH = 0xd3,
+  GET_LTDC_ERRORS = 0xd4,
+  SET_THROTTLE = 0xd5,
+  GET_BANDWIDTH = 0xd6,
+  SET_BANDWIDTH_POLICY = 0xd7,
+  SCHEDULE = 0xd8,
+  SHOW_PAGE = 0xd9,
+  GET_EVENT_STATS = 0xda,
+  SET_BEAM_MODE = 0xdb,
+  GET_SCANLINE = 0xdc,
+  SET_RASTER = 0xdd,
+  GET_RASTER_STATS = 0xde,
+  SHOW_PATTERN = 0xdf,
 }
 
 export enum DataTypeIn {
@@ -25,6 +61,161 @@ export enum DataTypeIn {
   LTDC_CLK_CONFIG = 0xf2,
   ADV7393_CONFIG = 0xf3,
   ADV7393_CHANGESET = 0xf4,
+  ACK = 0xf5,
+  BATCH_RESULT = 0xf6,
+  UPLOAD_STATUS = 0xf7,
+  SCREENSHOT_DATA = 0xf8,
+  SCREENSHOT_END = 0xf9,
+  CHECKSUM = 0xfa,
+  CHECKSUM_WATCH = 0xfb,
+  LTDC_ERRORS = 0xfc,
+  BANDWIDTH = 0xfd,
+  DEFERRED_RESULT = 0xfe,
+  EVENT_STATS = 0xe0,
+  SCANLINE = 0xe1,
+  RASTER_STATS = 0xe2,
+  PATTERN_TIME = 0xe3,
+  ROTATE_TIME = 0xe4,
+  PIXEL_BENCH = 0xe5,
+  BLEND_TIME = 0xe6,
+  LIST_TIME = 0xe7,
+  MFD_STATS = 0xe8,
+  ANIM_STATS = 0xe9,
+}
+
+export enum Status {
+  OK = 0x00,
+  UNKNOWN_COMMAND = 0x01,
+  BAD_PAYLOAD = 0x02,
+  BATCH_OVERFLOW = 0x03,
+  NO_BATCH = 0x04,
+  NOT_SUPPORTED = 0x05,
+  BAD_CRC = 0x06,
+  OUT_OF_ORDER = 0x07,
+  INCOMPLETE = 0x08,
+  NO_UPLOAD = 0x09,
+  BANDWIDTH_EXCEEDED = 0x0a,
+  LOW_HEADROOM = 0x0b,
+  QUEUE_FULL = 0x0c,
+}
+
+export enum BandwidthPolicy {
+  OFF = 0x00,
+  WARN = 0x01,
+  REJECT = 0x02,
+}
+
+export enum BandwidthResult {
+  OK = 0x00,
+  LOW = 0x01,
+  EXCEEDED = 0x02,
+}
+
+export enum Throttle {
+  OFF = 0x00,
+  ON = 0x01,
+  AUTO = 0x02,
+}
+
+export enum RasterEffect {
+  NONE = 0x00,
+  RAMP = 0x01,
+  BANDS = 0x02,
+  FADE = 0x03,
+}
+
+export enum TestPattern {
+  SMPTE_BARS = 0x00,
+  CIRCLE_CHART = 0x01,
+  MULTIBURST = 0x02,
+  LUMA_RAMP = 0x03,
+  PLUGE = 0x04,
+  CROSSHATCH = 0x05,
+  CHECKERBOARD = 0x06,
+  ZONE_PLATE = 0x07,
+}
+
+export enum Rotation {
+  ROTATE_0 = 0x00,
+  ROTATE_90 = 0x01,
+  ROTATE_180 = 0x02,
+  ROTATE_270 = 0x03,
+}
+
+export enum PixelKernel {
+  SWAP = 0x00,
+  BLEND = 0x01,
+  SCALE = 0x02,
+  COLOR_KEY = 0x03,
+  CONVERT = 0x04,
+  BLEND_ARGB4444 = 0x05,
+  BLEND_ARGB8888 = 0x06,
+}
+
+export enum BlendFormat {
+  RGB565 = 0x00,
+  ARGB4444 = 0x01,
+  ARGB8888 = 0x02,
+}
+
+export enum UploadEncoding {
+  RAW = 0x00,
+  RLE = 0x01,
+  DELTA = 0x02,
+}
+
+export enum UploadState {
+  IDLE = 0x00,
+  ACTIVE = 0x01,
+  DONE = 0x02,
+  ERROR = 0x03,
+}
+
+export enum ListOp {
+  END = 0x00,
+  PALETTE = 0x01,
+  FILL = 0x02,
+  PATTERN = 0x03,
+  RECT = 0x04,
+  LINE = 0x05,
+  CIRCLE = 0x06,
+  POLYGON = 0x07,
+  BLIT = 0x08,
+  BLIT_SCALED = 0x09,
+  TEXT = 0x0a,
+}
+
+// Default palette at the start of every list, GRAY is the first of 8 levels
+export enum ListColor {
+  BLACK = 0x00,
+  WHITE = 0x01,
+  RED = 0x02,
+  GREEN = 0x03,
+  BLUE = 0x04,
+  YELLOW = 0x05,
+  CYAN = 0x06,
+  MAGENTA = 0x07,
+  GRAY = 0x08,
+}
+
+export enum ListAsset {
+  FOX = 0x00,
+  MFD_SINGLE = 0x01,
+  MFD_MULTI = 0x02,
+}
+
+export enum ListFont {
+  MONO_12 = 0x00,
+  MONO_BOLD_16 = 0x01,
+}
+
+export const LIST_SLOTS = 8
+
+export type Rect = {
+  x: number
+  y: number
+  width: number
+  height: number
 }
 
 type MessageLTDCConfig = {
@@ -60,11 +251,260 @@ type MessageADV7393Changeset = {
   data: Set<number>
 }
 
+type MessageAck = {
+  type: DataTypeIn.ACK
+  seq: number
+  command: number
+  status: Status
+}
+
+type MessageBatchResult = {
+  type: DataTypeIn.BATCH_RESULT
+  seq: number
+  status: Status
+  results: Map<number, Status>
+}
+
+type MessageUploadStatus = {
+  type: DataTypeIn.UPLOAD_STATUS
+  state: UploadState
+  page: number
+  activePage: number
+  offset: number
+  size: number
+  pixels: number
+  screenWidth: number
+  screenHeight: number
+}
+
+type MessageScreenshotData = {
+  type: DataTypeIn.SCREENSHOT_DATA
+  offset: number
+  data: Uint8Array
+}
+
+type MessageScreenshotEnd = {
+  type: DataTypeIn.SCREENSHOT_END
+  width: number
+  height: number
+  size: number
+  crc: number
+}
+
+type MessageChecksum = {
+  type: DataTypeIn.CHECKSUM
+  checksum: number
+  frame: number
+}
+
+type MessageChecksumWatch = {
+  type: DataTypeIn.CHECKSUM_WATCH
+  rect: Rect
+  interval: number
+  golden: number
+  last: number
+  checks: number
+  mismatches: number
+}
+
+type MessageLTDCErrors = {
+  type: DataTypeIn.LTDC_ERRORS
+  underrunFrames: number
+  transferErrorFrames: number
+  lastErrorFrame: number
+  frame: number
+  throttle: Throttle
+  throttled: boolean
+}
+
+type MessageBandwidth = {
+  type: DataTypeIn.BANDWIDTH
+  available: number
+  scanoutPeak: number
+  scanoutAverage: number
+  drawReserve: number
+  headroom: number
+  pixelClock: number
+  result: BandwidthResult
+  policy: BandwidthPolicy
+  drawReservePercent: number
+}
+
+type MessageDeferredResult = {
+  type: DataTypeIn.DEFERRED_RESULT
+  seq: number
+  command: CommandOut
+  status: Status
+  frame: number
+  executedFrame: number
+}
+
+/**
+ * Latencies are CPU cycles from an interrupt posting an event to its handler
+ */
+type MessageEventStats = {
+  type: DataTypeIn.EVENT_STATS
+  dispatched: number
+  dropped: number
+  lastLatency: number
+  minLatency: number
+  maxLatency: number
+  maxHandler: number
+  coreClock: number
+}
+
+/**
+ * Scanline counts from the start of vertical sync, the image starts at
+ * accumulatedVBP + 1 and ends at accumulatedActiveH
+ */
+type MessageScanline = {
+  type: DataTypeIn.SCANLINE
+  scanline: number
+  accumulatedVBP: number
+  accumulatedActiveH: number
+  totalHeight: number
+  frame: number
+  beamMode: boolean
+}
+
+/**
+ * Latencies are pixel clocks from the start of the line to the register write
+ */
+type MessageRasterStats = {
+  type: DataTypeIn.RASTER_STATS
+  applied: number
+  late: number
+  lastLatency: number
+  minLatency: number
+  maxLatency: number
+  pixelClock: number
+}
+
+/**
+ * Time the firmware took to generate the pattern for the whole screen
+ */
+type MessagePatternTime = {
+  type: DataTypeIn.PATTERN_TIME
+  pattern: TestPattern
+  cycles: number
+  coreClock: number
+  framePeriodUs: number
+}
+
+/**
+ * A size x size region copied straight and then rotated
+ */
+type MessageRotateTime = {
+  type: DataTypeIn.ROTATE_TIME
+  rotation: Rotation
+  mirror: boolean
+  size: number
+  copyCycles: number
+  rotateCycles: number
+  coreClock: number
+}
+
+/**
+ * One row through a SIMD kernel and its C reference, match is whether
+ * every output pixel was the same
+ */
+type MessagePixelBench = {
+  type: DataTypeIn.PIXEL_BENCH
+  kernel: PixelKernel
+  match: boolean
+  pixels: number
+  refCycles: number
+  simdCycles: number
+  coreClock: number
+}
+
+/**
+ * The same overlay blended over the screen by DMA2D and by the CPU,
+ * status is the DMA2D result
+ */
+type MessageBlendTime = {
+  type: DataTypeIn.BLEND_TIME
+  format: BlendFormat
+  alpha: number
+  status: number
+  rows: number
+  dmaCycles: number
+  cpuCycles: number
+  coreClock: number
+  framePeriodUs: number
+}
+
+/**
+ * A display list uploaded into a slot, built and rendered synchronously,
+ * status is the DLIST status of the build
+ */
+type MessageListTime = {
+  type: DataTypeIn.LIST_TIME
+  status: number
+  slot: number
+  size: number
+  buildCycles: number
+  renderCycles: number
+  coreClock: number
+  framePeriodUs: number
+}
+
+/**
+ * Counters of the MFD widget redraws, pixels are the ones written to the
+ * framebuffer, cycles the time spent drawing them
+ */
+type MessageMfdStats = {
+  type: DataTypeIn.MFD_STATS
+  widgets: number
+  redraws: number
+  pixels: number
+  cycles: number
+  maxCycles: number
+  coreClock: number
+}
+
+/**
+ * Frame paced animation counters. Frame time is from the vblank to the end
+ * of the update, the histogram has ANIM_HISTOGRAM_SCALE bins per budget and
+ * the last bin takes everything longer.
+ */
+type MessageAnimStats = {
+  type: DataTypeIn.ANIM_STATS
+  updates: number
+  missed: number
+  overruns: number
+  budgetCycles: number
+  maxCycles: number
+  maxLatencyCycles: number
+  coreClock: number
+  histogram: number[]
+}
+
 export type MessageInParsed =
   | MessageLTDCConfig
   | MessageClkConfig
   | MessageADV7393Config
   | MessageADV7393Changeset
+  | MessageAck
+  | MessageBatchResult
+  | MessageUploadStatus
+  | MessageScreenshotData
+  | MessageScreenshotEnd
+  | MessageChecksum
+  | MessageChecksumWatch
+  | MessageLTDCErrors
+  | MessageBandwidth
+  | MessageDeferredResult
+  | MessageEventStats
+  | MessageScanline
+  | MessageRasterStats
+  | MessagePatternTime
+  | MessageRotateTime
+  | MessagePixelBench
+  | MessageBlendTime
+  | MessageListTime
+  | MessageMfdStats
+  | MessageAnimStats
 
 function calcCrc(data: Uint8Array): number {
   let crc = 0
@@ -74,13 +514,45 @@ function calcCrc(data: Uint8Array): number {
   return crc & 0xff
 }
 
+let nextSeq = 0
+
 function createPacket(command: CommandOut, payload?: Uint8Array): MessageOut {
   const message = new Uint8Array(MESSAGE_SIZE)
   message.set([command, ...(payload ? [payload.length, ...payload] : [])])
+  message.set([nextSeq], SEQ_OFFSET)
+  nextSeq = (nextSeq + 1) & 0xff
   message.set([calcCrc(message)], MESSAGE_SIZE - 1)
   return message
 }
 
+/**
+ * Wraps the messages into a batch, the firmware executes them in order
+ * and replies with a single BATCH_RESULT message. Commands that answer with
+ * data of their own are refused there with NOT_SUPPORTED.
+ */
+export function batch(...messages: MessageOut[]): MessageOut {
+  return join(
+    createPacket(CommandOut.BATCH_BEGIN),
+    ...messages,
+    createPacket(CommandOut.BATCH_COMMIT)
+  )
+}
+
+/**
+ * Sends several messages in one write, each one executed on its own.
+ */
+export function join(...messages: MessageOut[]): MessageOut {
+  const result = new Uint8Array(
+    messages.reduce((size, message) => size + message.length, 0)
+  )
+  let offset = 0
+  for (const message of messages) {
+    result.set(message, offset)
+    offset += message.length
+  }
+  return result
+}
+
 export function nextScreen(): MessageOut {
   return createPacket(CommandOut.NEXT_SCREEN)
 }
@@ -101,7 +573,7 @@ export function getAdv7393Config(registers: number[]): MessageOut {
   return createPacket(CommandOut.GET_ADV7393_CONFIG, new Uint8Array(registers))
 }
 
-export function pushLTDCConfig(s: LTDCConfigState): MessageOut {
+function ltdcConfigPayload(s: LTDCConfigState): Uint8Array {
   const horizontalSync = s.hSyncWidth - 1
   const verticalSync = s.vSyncHeight - 1
   const accumulatedHBP = s.hBackPorch + horizontalSync
@@ -126,16 +598,666 @@ export function pushLTDCConfig(s: LTDCConfigState): MessageOut {
 
   const payload: Uint8Array = new Uint8Array(40)
   payload.set(new Uint8Array(values.buffer))
-
-  return createPacket(CommandOut.PUSH_CONFIG, payload)
+  return payload
 }
 
-export function pushClkConfig(s: ClkConfigState): MessageOut {
+function clkConfigPayload(s: ClkConfigState): Uint8Array {
   const values = new Int32Array([s.pllSaiN, s.pllSaiR, s.pllSaiDivR])
   const payload: Uint8Array = new Uint8Array(12)
   payload.set(new Uint8Array(values.buffer))
+  return payload
+}
+
+export function pushLTDCConfig(s: LTDCConfigState): MessageOut {
+  return createPacket(CommandOut.PUSH_CONFIG, ltdcConfigPayload(s))
+}
+
+export function pushClkConfig(s: ClkConfigState): MessageOut {
+  return createPacket(CommandOut.PUSH_CLK_CONFIG, clkConfigPayload(s))
+}
+
+/**
+ * Estimates SDRAM bandwidth for the given configs without applying them,
+ * the current ones are used when omitted.
+ */
+export function getBandwidth(
+  ltdc?: LTDCConfigState,
+  clk?: ClkConfigState
+): MessageOut {
+  if (!ltdc) {
+    return createPacket(CommandOut.GET_BANDWIDTH)
+  }
+  const payload = new Uint8Array(clk ? 52 : 40)
+  payload.set(ltdcConfigPayload(ltdc))
+  if (clk) {
+    payload.set(clkConfigPayload(clk), 40)
+  }
+  return createPacket(CommandOut.GET_BANDWIDTH, payload)
+}
+
+export function setBandwidthPolicy(
+  policy: BandwidthPolicy,
+  drawReservePercent: number
+): MessageOut {
+  return createPacket(
+    CommandOut.SET_BANDWIDTH_POLICY,
+    new Uint8Array([policy, drawReservePercent])
+  )
+}
+
+export function getEventStats(clear = false): MessageOut {
+  return createPacket(
+    CommandOut.GET_EVENT_STATS,
+    new Uint8Array([clear ? 1 : 0])
+  )
+}
+
+export function setBeamMode(enabled: boolean): MessageOut {
+  return createPacket(
+    CommandOut.SET_BEAM_MODE,
+    new Uint8Array([enabled ? 1 : 0])
+  )
+}
+
+export function getScanline(): MessageOut {
+  return createPacket(CommandOut.GET_SCANLINE)
+}
+
+/**
+ * Colors are RGB888, the layer can be hidden to show the background only
+ */
+export function setRasterRamp(
+  from: number,
+  to: number,
+  hideLayer: boolean
+): MessageOut {
+  const payload = new Uint8Array(10)
+  const view = new DataView(payload.buffer)
+  payload[0] = RasterEffect.RAMP
+  view.setUint32(1, from, true)
+  view.setUint32(5, to, true)
+  payload[9] = hideLayer ? 1 : 0
+  return createPacket(CommandOut.SET_RASTER, payload)
+}
+
+export function setRasterBands(
+  colors: number[],
+  hideLayer: boolean
+): MessageOut {
+  const payload = new Uint8Array(3 + colors.length * 4)
+  const view = new DataView(payload.buffer)
+  payload[0] = RasterEffect.BANDS
+  payload[1] = hideLayer ? 1 : 0
+  payload[2] = colors.length
+  colors.forEach((color, i) => view.setUint32(3 + i * 4, color, true))
+  return createPacket(CommandOut.SET_RASTER, payload)
+}
+
+export function setRasterFade(
+  background: number,
+  fromAlpha: number,
+  toAlpha: number
+): MessageOut {
+  const payload = new Uint8Array(7)
+  payload[0] = RasterEffect.FADE
+  new DataView(payload.buffer).setUint32(1, background, true)
+  payload[5] = fromAlpha
+  payload[6] = toAlpha
+  return createPacket(CommandOut.SET_RASTER, payload)
+}
+
+export function clearRaster(): MessageOut {
+  return createPacket(
+    CommandOut.SET_RASTER,
+    new Uint8Array([RasterEffect.NONE])
+  )
+}
+
+export function getRasterStats(clear = false): MessageOut {
+  return createPacket(
+    CommandOut.GET_RASTER_STATS,
+    new Uint8Array([clear ? 1 : 0])
+  )
+}
+
+export function showPattern(pattern: TestPattern): MessageOut {
+  return createPacket(CommandOut.SHOW_PATTERN, new Uint8Array([pattern]))
+}
+
+export function benchRotate(rotation: Rotation, mirror: boolean): MessageOut {
+  return createPacket(
+    CommandOut.BENCH_ROTATE,
+    new Uint8Array([rotation, mirror ? 1 : 0])
+  )
+}
+
+export function benchPixel(kernel: PixelKernel): MessageOut {
+  return createPacket(CommandOut.BENCH_PIXEL, new Uint8Array([kernel]))
+}
+
+export function benchBlend(format: BlendFormat, alpha: number): MessageOut {
+  return createPacket(CommandOut.BENCH_BLEND, new Uint8Array([format, alpha]))
+}
+
+export function showPage(page: number): MessageOut {
+  return createPacket(CommandOut.SHOW_PAGE, new Uint8Array([page]))
+}
+
+/**
+ * Runs a message built by another helper at the vertical blanking of the
+ * given frame, 0 meaning the next one. Messages scheduled together run in
+ * order. Register and page changes are latched within that blanking, encoder
+ * config and animations follow from the main loop, screen switches are
+ * rendered a few frames ahead and shown once ready. The firmware replies with
+ * an ACK once queued and a DEFERRED_RESULT with the frame it took effect in,
+ * both with the seq of the SCHEDULE packet.
+ */
+export function schedule(frame: number, message: MessageOut): MessageOut {
+  const size = message[1]
+  const payload = new Uint8Array(5 + size)
+  new DataView(payload.buffer).setUint32(0, frame, true)
+  payload[4] = message[0]
+  payload.set(message.subarray(2, 2 + size), 5)
+  return createPacket(CommandOut.SCHEDULE, payload)
+}
+
+/**
+ * The firmware acknowledges at the current rate and switches right after,
+ * the port has to be reopened with the new rate once the ACK arrives.
+ */
+export function setBaudRate(baudRate: number): MessageOut {
+  const payload = new Uint8Array(new Uint32Array([baudRate]).buffer)
+  return createPacket(CommandOut.SET_BAUD_RATE, payload)
+}
+
+export type UploadHeader = {
+  page: number // any but the shown one, BAD_HEADER otherwise
+  encoding: UploadEncoding
+  show: boolean
+  x: number
+  y: number
+  width: number
+  height: number
+  size: number
+}
+
+// Payload minus the chunk offset and crc
+export const UPLOAD_CHUNK_SIZE = MESSAGE_SIZE - 4 - 8
+
+export function getSeq(message: MessageOut): number {
+  return message[SEQ_OFFSET]
+}
+
+export function uploadBegin(h: UploadHeader): MessageOut {
+  const payload = new Uint8Array(16)
+  const view = new DataView(payload.buffer)
+  view.setUint8(0, h.page)
+  view.setUint8(1, h.encoding)
+  view.setUint8(2, h.show ? 1 : 0)
+  view.setUint16(4, h.x, true)
+  view.setUint16(6, h.y, true)
+  view.setUint16(8, h.width, true)
+  view.setUint16(10, h.height, true)
+  view.setUint32(12, h.size, true)
+  return createPacket(CommandOut.UPLOAD_BEGIN, payload)
+}
+
+function chunkPayload(stream: Uint8Array, offset: number): Uint8Array {
+  const data = stream.subarray(offset, offset + UPLOAD_CHUNK_SIZE)
+  const payload = new Uint8Array(8 + data.length)
+  const view = new DataView(payload.buffer)
+  view.setUint32(0, offset, true)
+  view.setUint32(4, crc32(data), true)
+  payload.set(data, 8)
+  return payload
+}
+
+export function uploadChunk(stream: Uint8Array, offset: number): MessageOut {
+  return createPacket(CommandOut.UPLOAD_CHUNK, chunkPayload(stream, offset))
+}
 
-  return createPacket(CommandOut.PUSH_CLK_CONFIG, payload)
+export function uploadEnd(): MessageOut {
+  return createPacket(CommandOut.UPLOAD_END)
+}
+
+export function getUploadStatus(): MessageOut {
+  return createPacket(CommandOut.GET_UPLOAD_STATUS)
+}
+
+/**
+ * Builds a display list, coordinates are int16 except for blits and text.
+ * Colors are palette indexes, see ListColor.
+ */
+export class DisplayList {
+  private bytes: number[] = []
+
+  private u16(...values: number[]) {
+    values.forEach((v) => this.bytes.push(v & 0xff, (v >> 8) & 0xff))
+    return this
+  }
+
+  palette(first: number, colors: number[]) {
+    this.bytes.push(ListOp.PALETTE, first, colors.length)
+    return this.u16(...colors)
+  }
+
+  fill(color: number) {
+    this.bytes.push(ListOp.FILL, color)
+    return this
+  }
+
+  pattern(pattern: TestPattern) {
+    this.bytes.push(ListOp.PATTERN, pattern)
+    return this
+  }
+
+  rect(x1: number, y1: number, x2: number, y2: number, color: number) {
+    this.bytes.push(ListOp.RECT)
+    this.u16(x1, y1, x2, y2)
+    this.bytes.push(color)
+    return this
+  }
+
+  line(
+    x1: number,
+    y1: number,
+    x2: number,
+    y2: number,
+    width: number,
+    color: number
+  ) {
+    this.bytes.push(ListOp.LINE)
+    this.u16(x1, y1, x2, y2)
+    this.bytes.push(width, color)
+    return this
+  }
+
+  circle(
+    cx: number,
+    cy: number,
+    radius: number,
+    filled: boolean,
+    color: number
+  ) {
+    this.bytes.push(ListOp.CIRCLE)
+    this.u16(cx, cy, radius)
+    this.bytes.push(filled ? 1 : 0, color)
+    return this
+  }
+
+  polygon(points: [number, number][], color: number) {
+    this.bytes.push(ListOp.POLYGON, points.length, color)
+    points.forEach(([x, y]) => this.u16(x, y))
+    return this
+  }
+
+  blit(asset: ListAsset, x: number, y: number) {
+    this.bytes.push(ListOp.BLIT, asset)
+    return this.u16(x, y)
+  }
+
+  blitScaled(
+    asset: ListAsset,
+    x: number,
+    y: number,
+    width: number,
+    height: number,
+    bilinear: boolean
+  ) {
+    this.bytes.push(ListOp.BLIT_SCALED, asset)
+    this.u16(x, y, width, height)
+    this.bytes.push(bilinear ? 1 : 0)
+    return this
+  }
+
+  text(
+    font: ListFont,
+    x: number,
+    y: number,
+    text: string,
+    color: number,
+    background = ListColor.BLACK,
+    opaque = false
+  ) {
+    this.bytes.push(ListOp.TEXT, font)
+    this.u16(x, y)
+    this.bytes.push(color, background, opaque ? 1 : 0)
+    for (const c of text) {
+      this.bytes.push(c.charCodeAt(0) & 0x7f)
+    }
+    this.bytes.push(0)
+    return this
+  }
+
+  build(): Uint8Array {
+    return new Uint8Array([...this.bytes, ListOp.END])
+  }
+}
+
+export function dlistBegin(slot: number, size: number): MessageOut {
+  const payload = new Uint8Array(5)
+  const view = new DataView(payload.buffer)
+  view.setUint8(0, slot)
+  view.setUint32(1, size, true)
+  return createPacket(CommandOut.DLIST_BEGIN, payload)
+}
+
+export function dlistChunk(list: Uint8Array, offset: number): MessageOut {
+  return createPacket(CommandOut.DLIST_CHUNK, chunkPayload(list, offset))
+}
+
+export function dlistEnd(): MessageOut {
+  return createPacket(CommandOut.DLIST_END)
+}
+
+/**
+ * Shows the list in the slot until another screen is selected, it is
+ * rendered again after every config change. A list that fails to build is
+ * not shown, the LIST_TIME reply carries its status.
+ */
+export function showList(slot: number): MessageOut {
+  return createPacket(CommandOut.SHOW_LIST, new Uint8Array([slot]))
+}
+
+// Entries of a single MFD_SET_VALUES packet
+export const MFD_VALUES_PER_MESSAGE = Math.floor((MESSAGE_SIZE - 4 - 1) / 5)
+
+/**
+ * Values of the MFD widgets as [widget, value] pairs, widgets are numbered
+ * in the order the firmware registers them. Only the widgets whose value
+ * changed are redrawn.
+ */
+export function mfdSetValues(values: [number, number][]): MessageOut {
+  const payload = new Uint8Array(1 + values.length * 5)
+  const view = new DataView(payload.buffer)
+  view.setUint8(0, values.length)
+  values.forEach(([widget, value], i) => {
+    view.setUint8(1 + i * 5, widget)
+    view.setInt32(2 + i * 5, value, true)
+  })
+  return createPacket(CommandOut.MFD_SET_VALUES, payload)
+}
+
+export function getMfdStats(clear = false): MessageOut {
+  return createPacket(CommandOut.GET_MFD_STATS, new Uint8Array([clear ? 1 : 0]))
+}
+
+export enum Animation {
+  MOVING_BARS = 0x00,
+  SCROLLING_ZONE_PLATE = 0x01,
+}
+
+export const ANIM_HISTOGRAM_BINS = 16
+export const ANIM_HISTOGRAM_SCALE = 8
+
+/**
+ * Switches to a motion test screen moving speed pixels per frame, a budget
+ * of 0 us is the frame period
+ */
+export function animate(
+  animation: Animation,
+  speed: number,
+  budgetUs = 0
+): MessageOut {
+  const payload = new Uint8Array(6)
+  const view = new DataView(payload.buffer)
+  view.setUint8(0, animation)
+  view.setUint8(1, speed)
+  view.setUint32(2, budgetUs, true)
+  return createPacket(CommandOut.ANIMATE, payload)
+}
+
+export function getAnimStats(clear = false): MessageOut {
+  return createPacket(
+    CommandOut.GET_ANIM_STATS,
+    new Uint8Array([clear ? 1 : 0])
+  )
+}
+
+/**
+ * CRC-32/MPEG-2, matches CRC_calc in the firmware.
+ */
+export function crc32(data: Uint8Array): number {
+  let crc = 0xffffffff
+  for (const byte of data) {
+    crc ^= byte << 24
+    for (let i = 0; i < 8; i++) {
+      crc = crc & 0x80000000 ? (crc << 1) ^ 0x04c11db7 : crc << 1
+    }
+  }
+  return crc >>> 0
+}
+
+export function rgbaToRgb565(rgba: Uint8ClampedArray): Uint16Array {
+  const pixels = new Uint16Array(rgba.length / 4)
+  for (let i = 0; i < pixels.length; i++) {
+    const r = rgba[i * 4]
+    const g = rgba[i * 4 + 1]
+    const b = rgba[i * 4 + 2]
+    pixels[i] = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+  }
+  return pixels
+}
+
+const OP_LITERAL = 0
+const OP_RUN = 1
+const OP_SKIP = 2
+const OP_MAX_COUNT = 8192
+const MIN_RUN = 3
+
+/**
+ * Encodes RGB565 pixels for UPLOAD_CHUNK, see upload.h for the format.
+ * With a base frame (the one currently shown) unchanged pixels become skips.
+ */
+export function encodeFrame(
+  pixels: Uint16Array,
+  encoding: UploadEncoding,
+  base?: Uint16Array
+): Uint8Array {
+  if (encoding === UploadEncoding.RAW) {
+    return new Uint8Array(pixels.buffer.slice(0))
+  }
+
+  const out: number[] = []
+  const reference = encoding === UploadEncoding.DELTA ? base : undefined
+
+  const pushOp = (op: number, count: number) => {
+    const c = count - 1
+    if (c < 32) {
+      out.push((op << 6) | c)
+    } else {
+      out.push((op << 6) | 0x20 | (c & 0x1f), c >> 5)
+    }
+  }
+
+  const pushPixel = (p: number) => out.push(p & 0xff, p >> 8)
+
+  const skipLength = (i: number) => {
+    let n = 0
+    while (
+      reference &&
+      i + n < pixels.length &&
+      n < OP_MAX_COUNT &&
+      pixels[i + n] === reference[i + n]
+    ) {
+      n++
+    }
+    return n
+  }
+
+  const runLength = (i: number) => {
+    let n = 1
+    while (
+      i + n < pixels.length &&
+      n < OP_MAX_COUNT &&
+      pixels[i + n] === pixels[i]
+    ) {
+      n++
+    }
+    return n
+  }
+
+  let i = 0
+  while (i < pixels.length) {
+    const skip = skipLength(i)
+    if (skip > 0) {
+      pushOp(OP_SKIP, skip)
+      i += skip
+      continue
+    }
+
+    const run = runLength(i)
+    if (run >= MIN_RUN) {
+      pushOp(OP_RUN, run)
+      pushPixel(pixels[i])
+      i += run
+      continue
+    }
+
+    let end = i + run
+    while (
+      end < pixels.length &&
+      end - i < OP_MAX_COUNT &&
+      skipLength(end) === 0 &&
+      runLength(end) < MIN_RUN
+    ) {
+      end++
+    }
+    end = Math.min(end, i + OP_MAX_COUNT)
+
+    pushOp(OP_LITERAL, end - i)
+    for (let j = i; j < end; j++) {
+      pushPixel(pixels[j])
+    }
+    i = end
+  }
+
+  return new Uint8Array(out)
+}
+
+/**
+ * Decodes an RLE or DELTA stream, skipped pixels are taken from base.
+ */
+export function decodeFrame(
+  stream: Uint8Array,
+  width: number,
+  height: number,
+  base?: Uint16Array
+): Uint16Array {
+  const pixels = base ? base.slice() : new Uint16Array(width * height)
+  let pos = 0
+  let i = 0
+
+  while (i < stream.length && pos < pixels.length) {
+    const op = stream[i] >> 6
+    let count = stream[i] & 0x1f
+    if (stream[i++] & 0x20) {
+      count |= stream[i++] << 5
+    }
+    count++
+
+    if (op === OP_SKIP) {
+      pos += count
+    } else if (op === OP_RUN) {
+      pixels.fill(stream[i] | (stream[i + 1] << 8), pos, pos + count)
+      pos += count
+      i += 2
+    } else {
+      for (let j = 0; j < count; j++, i += 2) {
+        pixels[pos++] = stream[i] | (stream[i + 1] << 8)
+      }
+    }
+  }
+
+  return pixels
+}
+
+export function rgb565ToRgba(pixels: Uint16Array): Uint8ClampedArray {
+  const rgba = new Uint8ClampedArray(pixels.length * 4)
+  for (let i = 0; i < pixels.length; i++) {
+    const p = pixels[i]
+    const r = (p >> 11) & 0x1f
+    const g = (p >> 5) & 0x3f
+    const b = p & 0x1f
+    rgba[i * 4] = (r << 3) | (r >> 2)
+    rgba[i * 4 + 1] = (g << 2) | (g >> 4)
+    rgba[i * 4 + 2] = (b << 3) | (b >> 2)
+    rgba[i * 4 + 3] = 0xff
+  }
+  return rgba
+}
+
+/**
+ * Streams the shown page back as SCREENSHOT_DATA messages followed by
+ * SCREENSHOT_END, the whole screen without a rect.
+ */
+export function screenshot(rect?: Rect): MessageOut {
+  return createPacket(CommandOut.SCREENSHOT, rect && rectPayload(rect))
+}
+
+function rectPayload(rect: Rect, ...extra: number[]): Uint8Array {
+  return new Uint8Array(
+    new Uint16Array([rect.x, rect.y, rect.width, rect.height, ...extra]).buffer
+  )
+}
+
+export function getChecksum(rect?: Rect): MessageOut {
+  return createPacket(CommandOut.GET_CHECKSUM, rect && rectPayload(rect))
+}
+
+/**
+ * The firmware records the checksum of the rect and re-verifies it
+ * every interval frames, 0 stops watching.
+ */
+export function watchChecksum(rect: Rect, interval: number): MessageOut {
+  return createPacket(CommandOut.WATCH_CHECKSUM, rectPayload(rect, interval))
+}
+
+export function getChecksumWatch(): MessageOut {
+  return createPacket(CommandOut.GET_CHECKSUM_WATCH)
+}
+
+export function getLTDCErrors(clear = false): MessageOut {
+  return createPacket(
+    CommandOut.GET_LTDC_ERRORS,
+    new Uint8Array([clear ? 1 : 0])
+  )
+}
+
+/**
+ * While throttled the firmware only draws during vertical blanking
+ */
+export function setThrottle(mode: Throttle): MessageOut {
+  return createPacket(CommandOut.SET_THROTTLE, new Uint8Array([mode]))
+}
+
+/**
+ * Matches DISP_frameChecksum for RGB565 pixels in host order: rows of
+ * stored pixels (red and blue swapped) fed as words of two, as the CRC
+ * peripheral does, most significant byte first.
+ */
+export function frameChecksum(
+  pixels: Uint16Array,
+  width: number,
+  height: number
+): number {
+  const swap = (p: number) =>
+    ((p & 0x001f) << 11) | ((p & 0xf800) >> 11) | (p & 0x07e0)
+  const bytes = new Uint8Array(height * Math.ceil(width / 2) * 4)
+  let n = 0
+
+  for (let y = 0; y < height; y++) {
+    for (let x = 0; x < width; x += 2) {
+      const low = swap(pixels[y * width + x])
+      const high = x + 1 < width ? swap(pixels[y * width + x + 1]) : 0
+      bytes[n++] = high >> 8
+      bytes[n++] = high & 0xff
+      bytes[n++] = low >> 8
+      bytes[n++] = low & 0xff
+    }
+  }
+
+  return crc32(bytes)
 }
 
 export function pushAdv7393Config(data: Record<number, number>): MessageOut {
@@ -171,9 +1293,10 @@ export function createMessageReader(
 
       const type = message[0]
       const size = message[1]
+      const seq = message[SEQ_OFFSET]
       const data = message.slice(2, 2 + size)
 
-      onMessageReceive({ type, size, data })
+      onMessageReceive({ type, size, seq, data })
     }
   }
 }
@@ -253,6 +1376,243 @@ export function parseMessageIn(m: MessageIn): MessageInParsed {
       console.log(m, data)
       return { type: DataTypeIn.ADV7393_CHANGESET, data }
     }
+    case DataTypeIn.ACK: {
+      const [command, status] = m.data
+      return { type: DataTypeIn.ACK, seq: m.seq, command, status }
+    }
+    case DataTypeIn.BATCH_RESULT: {
+      const results = new Map<number, Status>()
+      for (let i = 1; i < m.size; i += 2) {
+        results.set(m.data[i], m.data[i + 1])
+      }
+      return {
+        type: DataTypeIn.BATCH_RESULT,
+        seq: m.seq,
+        status: m.data[0],
+        results,
+      }
+    }
+    case DataTypeIn.UPLOAD_STATUS: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.UPLOAD_STATUS,
+        state: view.getUint8(0),
+        page: view.getUint8(1),
+        activePage: view.getUint8(2),
+        offset: view.getUint32(3, true),
+        size: view.getUint32(7, true),
+        pixels: view.getUint32(11, true),
+        screenWidth: view.getUint16(15, true),
+        screenHeight: view.getUint16(17, true),
+      }
+    }
+    case DataTypeIn.SCREENSHOT_DATA: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.SCREENSHOT_DATA,
+        offset: view.getUint32(0, true),
+        data: m.data.slice(4),
+      }
+    }
+    case DataTypeIn.SCREENSHOT_END: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.SCREENSHOT_END,
+        width: view.getUint16(0, true),
+        height: view.getUint16(2, true),
+        size: view.getUint32(4, true),
+        crc: view.getUint32(8, true),
+      }
+    }
+    case DataTypeIn.CHECKSUM: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.CHECKSUM,
+        checksum: view.getUint32(0, true),
+        frame: view.getUint32(4, true),
+      }
+    }
+    case DataTypeIn.CHECKSUM_WATCH: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.CHECKSUM_WATCH,
+        rect: {
+          x: view.getUint16(0, true),
+          y: view.getUint16(2, true),
+          width: view.getUint16(4, true),
+          height: view.getUint16(6, true),
+        },
+        interval: view.getUint16(8, true),
+        golden: view.getUint32(10, true),
+        last: view.getUint32(14, true),
+        checks: view.getUint32(18, true),
+        mismatches: view.getUint32(22, true),
+      }
+    }
+    case DataTypeIn.LTDC_ERRORS: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.LTDC_ERRORS,
+        underrunFrames: view.getUint32(0, true),
+        transferErrorFrames: view.getUint32(4, true),
+        lastErrorFrame: view.getUint32(8, true),
+        frame: view.getUint32(12, true),
+        throttle: view.getUint8(16),
+        throttled: view.getUint8(17) !== 0,
+      }
+    }
+    case DataTypeIn.BANDWIDTH: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.BANDWIDTH,
+        available: view.getUint32(0, true),
+        scanoutPeak: view.getUint32(4, true),
+        scanoutAverage: view.getUint32(8, true),
+        drawReserve: view.getUint32(12, true),
+        headroom: view.getInt32(16, true),
+        pixelClock: view.getUint32(20, true),
+        result: view.getUint8(24),
+        policy: view.getUint8(25),
+        drawReservePercent: view.getUint8(26),
+      }
+    }
+    case DataTypeIn.DEFERRED_RESULT: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.DEFERRED_RESULT,
+        seq: m.seq,
+        command: view.getUint8(0),
+        status: view.getUint8(1),
+        frame: view.getUint32(2, true),
+        executedFrame: view.getUint32(6, true),
+      }
+    }
+    case DataTypeIn.EVENT_STATS: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.EVENT_STATS,
+        dispatched: view.getUint32(0, true),
+        dropped: view.getUint32(4, true),
+        lastLatency: view.getUint32(8, true),
+        minLatency: view.getUint32(12, true),
+        maxLatency: view.getUint32(16, true),
+        maxHandler: view.getUint32(20, true),
+        coreClock: view.getUint32(24, true),
+      }
+    }
+    case DataTypeIn.SCANLINE: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.SCANLINE,
+        scanline: view.getUint16(0, true),
+        accumulatedVBP: view.getUint16(2, true),
+        accumulatedActiveH: view.getUint16(4, true),
+        totalHeight: view.getUint16(6, true),
+        frame: view.getUint32(8, true),
+        beamMode: view.getUint8(12) !== 0,
+      }
+    }
+    case DataTypeIn.RASTER_STATS: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.RASTER_STATS,
+        applied: view.getUint32(0, true),
+        late: view.getUint32(4, true),
+        lastLatency: view.getUint32(8, true),
+        minLatency: view.getUint32(12, true),
+        maxLatency: view.getUint32(16, true),
+        pixelClock: view.getUint32(20, true),
+      }
+    }
+    case DataTypeIn.PATTERN_TIME: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.PATTERN_TIME,
+        pattern: view.getUint8(0),
+        cycles: view.getUint32(1, true),
+        coreClock: view.getUint32(5, true),
+        framePeriodUs: view.getUint32(9, true),
+      }
+    }
+    case DataTypeIn.ROTATE_TIME: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.ROTATE_TIME,
+        rotation: view.getUint8(0),
+        mirror: view.getUint8(1) !== 0,
+        size: view.getUint16(2, true),
+        copyCycles: view.getUint32(4, true),
+        rotateCycles: view.getUint32(8, true),
+        coreClock: view.getUint32(12, true),
+      }
+    }
+    case DataTypeIn.PIXEL_BENCH: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.PIXEL_BENCH,
+        kernel: view.getUint8(0),
+        match: view.getUint8(1) !== 0,
+        pixels: view.getUint16(2, true),
+        refCycles: view.getUint32(4, true),
+        simdCycles: view.getUint32(8, true),
+        coreClock: view.getUint32(12, true),
+      }
+    }
+    case DataTypeIn.BLEND_TIME: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.BLEND_TIME,
+        format: view.getUint8(0),
+        alpha: view.getUint8(1),
+        status: view.getUint8(2),
+        rows: view.getUint16(3, true),
+        dmaCycles: view.getUint32(5, true),
+        cpuCycles: view.getUint32(9, true),
+        coreClock: view.getUint32(13, true),
+        framePeriodUs: view.getUint32(17, true),
+      }
+    }
+    case DataTypeIn.LIST_TIME: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.LIST_TIME,
+        status: view.getUint8(0),
+        slot: view.getUint8(1),
+        size: view.getUint32(2, true),
+        buildCycles: view.getUint32(6, true),
+        renderCycles: view.getUint32(10, true),
+        coreClock: view.getUint32(14, true),
+        framePeriodUs: view.getUint32(18, true),
+      }
+    }
+    case DataTypeIn.MFD_STATS: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.MFD_STATS,
+        widgets: view.getUint8(0),
+        redraws: view.getUint32(1, true),
+        pixels: view.getUint32(5, true),
+        cycles: view.getUint32(9, true),
+        maxCycles: view.getUint32(13, true),
+        coreClock: view.getUint32(17, true),
+      }
+    }
+    case DataTypeIn.ANIM_STATS: {
+      const view = new DataView(m.data.buffer, m.data.byteOffset)
+      return {
+        type: DataTypeIn.ANIM_STATS,
+        updates: view.getUint32(0, true),
+        missed: view.getUint32(4, true),
+        overruns: view.getUint32(8, true),
+        budgetCycles: view.getUint32(12, true),
+        maxCycles: view.getUint32(16, true),
+        maxLatencyCycles: view.getUint32(20, true),
+        coreClock: view.getUint32(24, true),
+        histogram: Array.from({ length: ANIM_HISTOGRAM_BINS }, (_, i) =>
+          view.getUint16(28 + i * 2, true)
+        ),
+      }
+    }
     default:
       throw new Error(`Unknown message type ${m.type}`)
   }
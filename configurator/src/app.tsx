@@ -2,9 +2,19 @@ import { useEffect, useState } from 'react'
 import { Button, ConfigProvider, theme } from 'antd'
 import { SerialProvider } from './serial'
 import { nextScreen, prevScreen } from './api'
-import { LtdcConfigurator } from './ltdc'
+import {
+  LtdcAnim,
+  LtdcBlit,
+  LtdcConfigurator,
+  LtdcLists,
+  LtdcMfd,
+  LtdcPatterns,
+  LtdcRaster,
+  LtdcTelemetry,
+} from './ltdc'
 import { ClockConfigurator } from './clock'
 import { RegisterConfigurator } from './adv7393'
+import { FramebufferUploader, FramebufferScreenshot } from './framebuffer'
 import { useStm32Serial } from './serial-stm32'
 
 function Root() {
@@ -30,8 +40,17 @@ function Root() {
         )}
       </div>
       <LtdcConfigurator />
+      <LtdcTelemetry />
+      <LtdcRaster />
+      <LtdcPatterns />
+      <LtdcBlit />
+      <LtdcLists />
+      <LtdcMfd />
+      <LtdcAnim />
       <ClockConfigurator />
       <RegisterConfigurator />
+      <FramebufferUploader />
+      <FramebufferScreenshot />
     </div>
   )
 }
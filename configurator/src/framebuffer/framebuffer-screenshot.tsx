@@ -0,0 +1,117 @@
+import { useCallback, useRef, useState } from 'react'
+import { Button, Card } from 'antd'
+import { CameraOutlined, SafetyOutlined } from '@ant-design/icons'
+import {
+  DataTypeIn,
+  MessageInParsed,
+  crc32,
+  decodeFrame,
+  frameChecksum,
+  getChecksum,
+  rgb565ToRgba,
+  screenshot,
+} from '../api'
+import { useStm32Serial } from '../serial-stm32'
+
+export function FramebufferScreenshot() {
+  const canvasRef = useRef<HTMLCanvasElement>(null)
+  const chunks = useRef<Uint8Array[]>([])
+  const received = useRef(0)
+  const [result, setResult] = useState('')
+  const [verify, setVerify] = useState('')
+  // Checksum of the last screenshot, computed the way the firmware does it
+  const expected = useRef<number>()
+
+  const handleMessageReceive = useCallback((m: MessageInParsed) => {
+    if (m.type === DataTypeIn.SCREENSHOT_DATA) {
+      if (m.offset !== received.current) {
+        return
+      }
+      chunks.current.push(m.data)
+      received.current += m.data.length
+    } else if (m.type === DataTypeIn.SCREENSHOT_END) {
+      const stream = new Uint8Array(received.current)
+      let offset = 0
+      for (const chunk of chunks.current) {
+        stream.set(chunk, offset)
+        offset += chunk.length
+      }
+      chunks.current = []
+      received.current = 0
+
+      if (stream.length !== m.size || crc32(stream) !== m.crc) {
+        setResult(`Corrupted: ${stream.length} of ${m.size} bytes`)
+        return
+      }
+
+      const canvas = canvasRef.current
+      const ctx = canvas?.getContext('2d')
+      if (!canvas || !ctx) {
+        return
+      }
+
+      canvas.width = m.width
+      canvas.height = m.height
+      const pixels = decodeFrame(stream, m.width, m.height)
+      expected.current = frameChecksum(pixels, m.width, m.height)
+      ctx.putImageData(
+        new ImageData(rgb565ToRgba(pixels), m.width, m.height),
+        0,
+        0
+      )
+      setResult(
+        `${m.width}x${m.height}, ${m.size} bytes, crc ${m.crc.toString(16)}`
+      )
+    } else if (m.type === DataTypeIn.CHECKSUM) {
+      const checksum = m.checksum.toString(16)
+      if (expected.current === undefined) {
+        setVerify(`Frame ${m.frame}: ${checksum}`)
+      } else {
+        setVerify(
+          `Frame ${m.frame}: ${checksum}, ${
+            m.checksum === expected.current ? 'matches' : 'differs from'
+          } the screenshot`
+        )
+      }
+    }
+  }, [])
+
+  const { portState, sendMessage } = useStm32Serial(handleMessageReceive)
+
+  const capture = () => {
+    chunks.current = []
+    received.current = 0
+    expected.current = undefined
+    setResult('')
+    setVerify('')
+    sendMessage(screenshot())
+  }
+
+  return (
+    <Card
+      title="Screenshot"
+      extra={
+        <div className="flex items-center gap-4">
+          <Button
+            icon={<CameraOutlined />}
+            disabled={portState !== 'open'}
+            onClick={capture}
+          >
+            Capture
+          </Button>
+          <Button
+            icon={<SafetyOutlined />}
+            disabled={portState !== 'open'}
+            onClick={() => sendMessage(getChecksum())}
+          >
+            Checksum
+          </Button>
+        </div>
+      }
+    >
+      <canvas ref={canvasRef} className="max-w-full" />
+      {result && <div>{result}</div>}
+      {verify && <div>{verify}</div>}
+    </Card>
+  )
+}
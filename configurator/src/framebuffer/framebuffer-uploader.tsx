@@ -0,0 +1,270 @@
+import {
+  type ChangeEvent,
+  useCallback,
+  useEffect,
+  useRef,
+  useState,
+} from 'react'
+import { Button, Card, Checkbox, Progress, Select } from 'antd'
+import { UploadOutlined } from '@ant-design/icons'
+import {
+  CommandOut,
+  DataTypeIn,
+  MessageInParsed,
+  Status,
+  UPLOAD_CHUNK_SIZE,
+  UploadEncoding,
+  UploadState,
+  encodeFrame,
+  getSeq,
+  getUploadStatus,
+  rgbaToRgb565,
+  uploadBegin,
+  uploadChunk,
+  uploadEnd,
+} from '../api'
+import { useStm32Serial } from '../serial-stm32'
+
+// Pages 1 and 2 are flipped between, page 0 keeps the debug screens
+const UPLOAD_PAGES = [1, 2]
+// Chunks in flight, the firmware queues 8 packets
+const WINDOW_SIZE = 4
+const STALL_TIMEOUT = 1000
+
+type Phase = 'idle' | 'status' | 'begin' | 'chunks' | 'resume' | 'end'
+
+type Upload = {
+  phase: Phase
+  stream: Uint8Array
+  frame: Uint16Array
+  page: number
+  nextOffset: number
+  inFlight: Map<number, number>
+}
+
+function rasterize(
+  image: HTMLImageElement,
+  width: number,
+  height: number
+): Uint16Array {
+  const canvas = document.createElement('canvas')
+  canvas.width = width
+  canvas.height = height
+  const ctx = canvas.getContext('2d')!
+  ctx.drawImage(image, 0, 0, width, height)
+  return rgbaToRgb565(ctx.getImageData(0, 0, width, height).data)
+}
+
+export function FramebufferUploader() {
+  const [image, setImage] = useState<HTMLImageElement>()
+  const [encoding, setEncoding] = useState(UploadEncoding.DELTA)
+  const [show, setShow] = useState(true)
+  const [progress, setProgress] = useState(0)
+  const [result, setResult] = useState('')
+
+  const upload = useRef<Upload>()
+  // Last frame shown by us, base for delta encoding
+  const shown = useRef<{ page: number; frame: Uint16Array }>()
+  const stallTimer = useRef<ReturnType<typeof setTimeout>>()
+
+  const writeRef = useRef<(data: Uint8Array) => void>(() => {})
+
+  const finish = useCallback((message: string) => {
+    clearTimeout(stallTimer.current)
+    upload.current = undefined
+    setResult(message)
+  }, [])
+
+  const requestStatus = useCallback(() => {
+    const u = upload.current
+    if (u) {
+      u.phase = 'resume'
+      u.inFlight.clear()
+      writeRef.current(getUploadStatus())
+    }
+  }, [])
+
+  const pump = useCallback(() => {
+    const u = upload.current
+    if (!u || u.phase !== 'chunks') {
+      return
+    }
+
+    clearTimeout(stallTimer.current)
+    stallTimer.current = setTimeout(requestStatus, STALL_TIMEOUT)
+
+    if (u.nextOffset >= u.stream.length && u.inFlight.size === 0) {
+      u.phase = 'end'
+      writeRef.current(uploadEnd())
+      return
+    }
+
+    const packets: Uint8Array[] = []
+    while (u.inFlight.size < WINDOW_SIZE && u.nextOffset < u.stream.length) {
+      const packet = uploadChunk(u.stream, u.nextOffset)
+      u.nextOffset = Math.min(
+        u.nextOffset + UPLOAD_CHUNK_SIZE,
+        u.stream.length
+      )
+      u.inFlight.set(getSeq(packet), u.nextOffset)
+      packets.push(packet)
+    }
+
+    if (packets.length > 0) {
+      const data = new Uint8Array(packets.length * packets[0].length)
+      packets.forEach((p, i) => data.set(p, i * p.length))
+      writeRef.current(data)
+    }
+
+    setProgress(Math.round((u.nextOffset / u.stream.length) * 100))
+  }, [requestStatus])
+
+  const handleMessageReceive = useCallback(
+    (m: MessageInParsed) => {
+      const u = upload.current
+      if (!u || !image) {
+        return
+      }
+
+      if (m.type === DataTypeIn.UPLOAD_STATUS && u.phase === 'status') {
+        const base = shown.current
+        u.page = UPLOAD_PAGES.find((p) => p !== m.activePage)!
+        u.frame = rasterize(image, m.screenWidth, m.screenHeight)
+        u.stream = encodeFrame(
+          u.frame,
+          encoding,
+          base?.page === m.activePage ? base.frame : undefined
+        )
+        u.phase = 'begin'
+        writeRef.current(
+          uploadBegin({
+            page: u.page,
+            encoding:
+              encoding === UploadEncoding.DELTA && base?.page !== m.activePage
+                ? UploadEncoding.RLE
+                : encoding,
+            show,
+            x: 0,
+            y: 0,
+            width: m.screenWidth,
+            height: m.screenHeight,
+            size: u.stream.length,
+          })
+        )
+      } else if (m.type === DataTypeIn.UPLOAD_STATUS && u.phase === 'resume') {
+        if (m.state === UploadState.DONE) {
+          // The END was executed but its ACK got lost
+          if (show) {
+            shown.current = { page: u.page, frame: u.frame }
+          }
+          finish(`OK, ${u.stream.length} bytes to page ${u.page}`)
+          return
+        }
+        if (m.state !== UploadState.ACTIVE) {
+          finish(`Aborted: ${UploadState[m.state]}`)
+          return
+        }
+        u.nextOffset = m.offset
+        u.phase = 'chunks'
+        pump()
+      } else if (m.type === DataTypeIn.ACK) {
+        if (m.command === CommandOut.UPLOAD_BEGIN && u.phase === 'begin') {
+          if (m.status !== Status.OK) {
+            finish(`Rejected: ${Status[m.status]}`)
+            return
+          }
+          u.phase = 'chunks'
+          pump()
+        } else if (m.command === CommandOut.UPLOAD_CHUNK) {
+          if (!u.inFlight.delete(m.seq) || u.phase !== 'chunks') {
+            return
+          }
+          if (m.status !== Status.OK) {
+            requestStatus()
+            return
+          }
+          pump()
+        } else if (m.command === CommandOut.UPLOAD_END && u.phase === 'end') {
+          if (m.status === Status.INCOMPLETE) {
+            requestStatus()
+            return
+          }
+          if (m.status === Status.OK && show) {
+            shown.current = { page: u.page, frame: u.frame }
+          }
+          finish(
+            `${Status[m.status]}, ${u.stream.length} bytes to page ${u.page}`
+          )
+        }
+      }
+    },
+    [image, encoding, show, pump, requestStatus, finish]
+  )
+
+  const { portState, writeMessage } = useStm32Serial(handleMessageReceive)
+
+  useEffect(() => {
+    writeRef.current = writeMessage
+  }, [writeMessage])
+
+  useEffect(() => () => clearTimeout(stallTimer.current), [])
+
+  const handleFileChange = (e: ChangeEvent<HTMLInputElement>) => {
+    const file = e.target.files?.[0]
+    if (!file) {
+      return
+    }
+    const img = new Image()
+    img.onload = () => setImage(img)
+    img.src = URL.createObjectURL(file)
+  }
+
+  const start = () => {
+    upload.current = {
+      phase: 'status',
+      stream: new Uint8Array(0),
+      frame: new Uint16Array(0),
+      page: 0,
+      nextOffset: 0,
+      inFlight: new Map(),
+    }
+    setProgress(0)
+    setResult('')
+    writeMessage(getUploadStatus())
+  }
+
+  const disabled = portState !== 'open'
+
+  return (
+    <Card
+      title="Framebuffer"
+      extra={
+        <div className="flex items-center gap-4">
+          <input type="file" accept="image/*" onChange={handleFileChange} />
+          <Select
+            value={encoding}
+            onChange={setEncoding}
+            options={[
+              { label: 'Raw', value: UploadEncoding.RAW },
+              { label: 'RLE', value: UploadEncoding.RLE },
+              { label: 'Delta', value: UploadEncoding.DELTA },
+            ]}
+          />
+          <Checkbox checked={show} onChange={(e) => setShow(e.target.checked)}>
+            Show
+          </Checkbox>
+          <Button
+            icon={<UploadOutlined />}
+            disabled={disabled || !image}
+            onClick={start}
+          >
+            Upload
+          </Button>
+        </div>
+      }
+    >
+      <Progress percent={progress} />
+      {result && <div>{result}</div>}
+    </Card>
+  )
+}
@@ -0,0 +1,2 @@
+export { FramebufferUploader } from './framebuffer-uploader'
+export { FramebufferScreenshot } from './framebuffer-screenshot'
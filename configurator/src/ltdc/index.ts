@@ -1 +1,8 @@
 export { LtdcConfigurator } from './ltdc-configurator'
+export { LtdcTelemetry } from './ltdc-telemetry'
+export { LtdcRaster } from './ltdc-raster'
+export { LtdcPatterns } from './ltdc-patterns'
+export { LtdcBlit } from './ltdc-blit'
+export { LtdcLists } from './ltdc-lists'
+export { LtdcMfd } from './ltdc-mfd'
+export { LtdcAnim } from './ltdc-anim'
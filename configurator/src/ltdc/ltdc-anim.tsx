@@ -0,0 +1,154 @@
+import { useCallback, useEffect, useState } from 'react'
+import { Button, Card, Checkbox, InputNumber, Select } from 'antd'
+import {
+  ANIM_HISTOGRAM_BINS,
+  ANIM_HISTOGRAM_SCALE,
+  Animation,
+  DataTypeIn,
+  MessageInParsed,
+  animate,
+  getAnimStats,
+} from '../api'
+import { useStm32Serial } from '../serial-stm32'
+
+const POLL_INTERVAL = 1000
+const HISTOGRAM_HEIGHT = 80
+
+type Stats = {
+  updates: number
+  missed: number
+  overruns: number
+  budgetCycles: number
+  maxCycles: number
+  maxLatencyCycles: number
+  coreClock: number
+  histogram: number[]
+}
+
+export function LtdcAnim() {
+  const [animation, setAnimation] = useState(Animation.MOVING_BARS)
+  const [speed, setSpeed] = useState(2)
+  const [budgetUs, setBudgetUs] = useState(0)
+  const [poll, setPoll] = useState(false)
+  const [stats, setStats] = useState<Stats>()
+
+  const handleMessageReceive = useCallback((m: MessageInParsed) => {
+    if (m.type === DataTypeIn.ANIM_STATS) {
+      setStats(m)
+    }
+  }, [])
+
+  const { portState, writeMessage } = useStm32Serial(handleMessageReceive)
+
+  const disabled = portState !== 'open'
+
+  useEffect(() => {
+    if (!poll || disabled) {
+      return
+    }
+    // Cleared on every read, so the counters are per poll interval
+    const timer = setInterval(
+      () => writeMessage(getAnimStats(true)),
+      POLL_INTERVAL
+    )
+    return () => clearInterval(timer)
+  }, [poll, disabled, writeMessage])
+
+  const millis = (cycles: number) =>
+    stats ? `${((cycles / stats.coreClock) * 1000).toFixed(2)} ms` : ''
+
+  const peak = stats ? Math.max(1, ...stats.histogram) : 1
+
+  return (
+    <Card title="Animation">
+      <div className="flex items-center gap-4">
+        <Select
+          disabled={disabled}
+          value={animation}
+          onChange={setAnimation}
+          options={[
+            { label: 'Moving bars', value: Animation.MOVING_BARS },
+            {
+              label: 'Scrolling zone plate',
+              value: Animation.SCROLLING_ZONE_PLATE,
+            },
+          ]}
+        />
+        <InputNumber
+          disabled={disabled}
+          addonBefore="Pixels / frame"
+          min={1}
+          max={255}
+          value={speed}
+          onChange={(v) => v !== null && setSpeed(v)}
+        />
+        <InputNumber
+          disabled={disabled}
+          addonBefore="Budget, us"
+          min={0}
+          max={1000000}
+          value={budgetUs}
+          onChange={(v) => v !== null && setBudgetUs(v)}
+        />
+        <Button
+          type="primary"
+          disabled={disabled}
+          onClick={() => {
+            writeMessage(animate(animation, speed, budgetUs))
+            // Counters of the previous run are dropped
+            writeMessage(getAnimStats(true))
+            setStats(undefined)
+            setPoll(true)
+          }}
+        >
+          Start
+        </Button>
+        <Checkbox
+          disabled={disabled}
+          checked={poll}
+          onChange={(e) => setPoll(e.target.checked)}
+        >
+          Poll stats
+        </Checkbox>
+      </div>
+      {stats && stats.coreClock > 0 && (
+        <div className="mt-3">
+          <div>
+            {stats.updates} frames drawn, {stats.missed} missed,{' '}
+            {stats.overruns} over the {millis(stats.budgetCycles)} budget
+            {stats.updates > 0 &&
+              `, longest update ${millis(stats.maxCycles)}, ` +
+                `started up to ${millis(stats.maxLatencyCycles)} ` +
+                'after vblank'}
+          </div>
+          <div
+            className="mt-2 flex items-end gap-1"
+            style={{ height: HISTOGRAM_HEIGHT }}
+          >
+            {stats.histogram.map((count, i) => (
+              <div
+                key={i}
+                className={
+                  i < ANIM_HISTOGRAM_SCALE ? 'bg-green-500' : 'bg-red-500'
+                }
+                style={{
+                  width: 16,
+                  height: Math.max(1, (count / peak) * HISTOGRAM_HEIGHT),
+                }}
+                title={
+                  `${millis((stats.budgetCycles * i) / ANIM_HISTOGRAM_SCALE)}` +
+                  (i < ANIM_HISTOGRAM_BINS - 1
+                    ? ` - ${millis(
+                        (stats.budgetCycles * (i + 1)) / ANIM_HISTOGRAM_SCALE
+                      )}`
+                    : ' and longer') +
+                  `: ${count}`
+                }
+              />
+            ))}
+          </div>
+        </div>
+      )}
+    </Card>
+  )
+}
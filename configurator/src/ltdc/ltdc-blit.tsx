@@ -0,0 +1,183 @@
+import { useCallback, useState } from 'react'
+import { Button, Card, Checkbox, InputNumber, Select } from 'antd'
+import {
+  BlendFormat,
+  DataTypeIn,
+  MessageInParsed,
+  PixelKernel,
+  Rotation,
+  benchBlend,
+  benchPixel,
+  benchRotate,
+} from '../api'
+import { useStm32Serial } from '../serial-stm32'
+
+type RotateTiming = {
+  rotation: Rotation
+  mirror: boolean
+  size: number
+  copyCycles: number
+  rotateCycles: number
+  coreClock: number
+}
+
+type KernelResult = {
+  kernel: PixelKernel
+  match: boolean
+  pixels: number
+  refCycles: number
+  simdCycles: number
+}
+
+type BlendTiming = {
+  status: number
+  rows: number
+  dmaCycles: number
+  cpuCycles: number
+  coreClock: number
+  framePeriodUs: number
+}
+
+const kernels = [
+  { label: 'Swap', value: PixelKernel.SWAP },
+  { label: 'Blend', value: PixelKernel.BLEND },
+  { label: 'Scale', value: PixelKernel.SCALE },
+  { label: 'Color key', value: PixelKernel.COLOR_KEY },
+  { label: 'Convert', value: PixelKernel.CONVERT },
+  { label: 'ARGB4444 over', value: PixelKernel.BLEND_ARGB4444 },
+  { label: 'ARGB8888 over', value: PixelKernel.BLEND_ARGB8888 },
+]
+
+function blendTime(timing: BlendTiming, cycles: number) {
+  const micros = (cycles / timing.coreClock) * 1e6
+  const share = timing.framePeriodUs > 0 ? micros / timing.framePeriodUs : 0
+  const percent = (share * 100).toFixed(0)
+  return `${(micros / 1000).toFixed(2)} ms (${percent}% of a frame)`
+}
+
+function millis(cycles: number, coreClock: number) {
+  return `${((cycles / coreClock) * 1000).toFixed(2)} ms`
+}
+
+export function LtdcBlit() {
+  const [rotation, setRotation] = useState(Rotation.ROTATE_90)
+  const [mirror, setMirror] = useState(false)
+  const [rotate, setRotate] = useState<RotateTiming>()
+  const [results, setResults] = useState<KernelResult[]>([])
+  const [format, setFormat] = useState(BlendFormat.ARGB4444)
+  const [alpha, setAlpha] = useState(255)
+  const [blend, setBlend] = useState<BlendTiming>()
+
+  const handleMessageReceive = useCallback((m: MessageInParsed) => {
+    if (m.type === DataTypeIn.ROTATE_TIME) {
+      setRotate(m)
+    }
+    if (m.type === DataTypeIn.BLEND_TIME) {
+      setBlend(m)
+    }
+    if (m.type === DataTypeIn.PIXEL_BENCH) {
+      setResults((prev) => [...prev.filter((r) => r.kernel !== m.kernel), m])
+    }
+  }, [])
+
+  const { portState, sendMessage, writeMessage } =
+    useStm32Serial(handleMessageReceive)
+
+  const checkKernels = () => {
+    setResults([])
+    kernels.forEach(({ value }) => writeMessage(benchPixel(value)))
+  }
+
+  const disabled = portState !== 'open'
+
+  return (
+    <Card title="Blit Benchmark">
+      <div className="flex items-center gap-4">
+        <Select
+          disabled={disabled}
+          value={rotation}
+          onChange={setRotation}
+          options={[
+            { label: '0°', value: Rotation.ROTATE_0 },
+            { label: '90°', value: Rotation.ROTATE_90 },
+            { label: '180°', value: Rotation.ROTATE_180 },
+            { label: '270°', value: Rotation.ROTATE_270 },
+          ]}
+        />
+        <Checkbox
+          disabled={disabled}
+          checked={mirror}
+          onChange={(e) => setMirror(e.target.checked)}
+        >
+          Mirror
+        </Checkbox>
+        <Button
+          type="primary"
+          disabled={disabled}
+          onClick={() => sendMessage(benchRotate(rotation, mirror))}
+        >
+          Rotate
+        </Button>
+        {rotate && rotate.coreClock > 0 && rotate.copyCycles > 0 && (
+          <div>
+            {rotate.size}×{rotate.size}: copy{' '}
+            {millis(rotate.copyCycles, rotate.coreClock)}, rotated{' '}
+            {millis(rotate.rotateCycles, rotate.coreClock)} (
+            {(rotate.rotateCycles / rotate.copyCycles).toFixed(2)}×)
+          </div>
+        )}
+      </div>
+      <div className="flex items-center gap-4 mt-3">
+        <Select
+          disabled={disabled}
+          value={format}
+          onChange={setFormat}
+          options={[
+            { label: 'RGB565', value: BlendFormat.RGB565 },
+            { label: 'ARGB4444', value: BlendFormat.ARGB4444 },
+            { label: 'ARGB8888', value: BlendFormat.ARGB8888 },
+          ]}
+        />
+        <InputNumber
+          disabled={disabled}
+          addonBefore="Alpha"
+          min={0}
+          max={255}
+          value={alpha}
+          onChange={(v) => v !== null && setAlpha(v)}
+        />
+        <Button
+          disabled={disabled}
+          onClick={() => sendMessage(benchBlend(format, alpha))}
+        >
+          Blend
+        </Button>
+        {blend && blend.coreClock > 0 && (
+          <div>
+            {blend.rows} rows: DMA2D{' '}
+            {blend.status === 0 ? blendTime(blend, blend.dmaCycles) : 'failed'}
+            , CPU {blendTime(blend, blend.cpuCycles)}
+          </div>
+        )}
+      </div>
+      <div className="flex items-center gap-4 mt-3">
+        <Button disabled={disabled} onClick={checkKernels}>
+          Check kernels
+        </Button>
+        {kernels.map(({ label, value }) => {
+          const result = results.find((r) => r.kernel === value)
+          if (!result) {
+            return null
+          }
+          return (
+            <div key={value}>
+              {label}: {result.match ? 'exact' : 'MISMATCH'},{' '}
+              {(result.refCycles / result.pixels).toFixed(1)} →{' '}
+              {(result.simdCycles / result.pixels).toFixed(1)} cycles/px
+            </div>
+          )
+        })}
+      </div>
+    </Card>
+  )
+}
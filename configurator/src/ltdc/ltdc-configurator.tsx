@@ -1,5 +1,13 @@
 import { useCallback, useEffect, useMemo, useState } from 'react'
-import { Button, Checkbox, Input, InputNumber, List, Card } from 'antd'
+import {
+  Button,
+  Checkbox,
+  Input,
+  InputNumber,
+  List,
+  Card,
+  message,
+} from 'antd'
 import {
   DeleteOutlined,
   DownloadOutlined,
@@ -7,8 +15,14 @@ import {
 } from '@ant-design/icons'
 import type { InputNumberProps } from 'antd'
 import {
+  CommandOut,
   DataTypeIn,
+  Status,
+  batch,
+  getBandwidth,
   getLTDCConfig,
+  join,
+  pushClkConfig,
   pushLTDCConfig,
   MessageInParsed,
 } from '../api'
@@ -149,6 +163,13 @@ export function LtdcConfigurator() {
     state.totalHeight
   )
 
+  const { clockState } = useClockState()
+
+  const [bandwidth, setBandwidth] = useState<{
+    headroom: number
+    scanoutPeak: number
+  }>()
+
   const handleMessageReceive = useCallback(
     (m: MessageInParsed) => {
       if (m.type === DataTypeIn.LTDC_CONFIG) {
@@ -162,6 +183,21 @@ export function LtdcConfigurator() {
           activeHeight: m.accumulatedActiveH - m.accumulatedVBP,
           vFrontPorch: m.totalHeight - m.accumulatedActiveH,
         })
+      } else if (m.type === DataTypeIn.BANDWIDTH) {
+        setBandwidth({
+          headroom: m.headroom / 1e6,
+          scanoutPeak: m.scanoutPeak / 1e6,
+        })
+      } else if (
+        m.type === DataTypeIn.ACK &&
+        (m.command === CommandOut.PUSH_CONFIG ||
+          m.command === CommandOut.PUSH_CLK_CONFIG)
+      ) {
+        if (m.status === Status.BANDWIDTH_EXCEEDED) {
+          message.error('Rejected: not enough SDRAM bandwidth')
+        } else if (m.status === Status.LOW_HEADROOM) {
+          message.warning('Applied with low SDRAM bandwidth headroom')
+        }
       }
     },
     [loadSet]
@@ -171,13 +207,19 @@ export function LtdcConfigurator() {
 
   const [liveUpdate, setLiveUpdate] = useState(false)
 
+  const disabled = portState !== 'open'
+
+  // Estimate of the edited config, sent along with the push when live updating
   useEffect(() => {
-    if (liveUpdate) {
-      sendMessage(pushLTDCConfig(state))
+    if (disabled) {
+      return
     }
-  }, [liveUpdate, state, sendMessage])
-
-  const disabled = portState !== 'open'
+    const estimate = getBandwidth(
+      state,
+      clockState.pllM ? clockState : undefined
+    )
+    sendMessage(liveUpdate ? join(pushLTDCConfig(state), estimate) : estimate)
+  }, [liveUpdate, state, clockState, disabled, sendMessage])
 
   return (
     <Card
@@ -198,6 +240,17 @@ export function LtdcConfigurator() {
           >
             Push config
           </Button>
+          <Button
+            icon={<UploadOutlined />}
+            disabled={disabled || !clockState.pllM}
+            onClick={() =>
+              sendMessage(
+                batch(pushLTDCConfig(state), pushClkConfig(clockState))
+              )
+            }
+          >
+            Push with clock
+          </Button>
           <Checkbox
             disabled={disabled}
             checked={liveUpdate}
@@ -221,6 +274,16 @@ export function LtdcConfigurator() {
             value={frameRate.toFixed(4)}
           />
           <TimingsInput disabled label="HS kHz" value={hsyncRate.toFixed(4)} />
+          <TimingsInput
+            disabled
+            label="Scanout MB/s"
+            value={bandwidth?.scanoutPeak.toFixed(2)}
+          />
+          <TimingsInput
+            disabled
+            label="SDRAM headroom MB/s"
+            value={bandwidth?.headroom.toFixed(2)}
+          />
         </div>
         <div>
           <TimingsInput
@@ -0,0 +1,180 @@
+import { useCallback, useEffect, useRef, useState } from 'react'
+import { Button, Card, Select } from 'antd'
+import {
+  CommandOut,
+  DataTypeIn,
+  DisplayList,
+  LIST_SLOTS,
+  ListAsset,
+  ListColor,
+  ListFont,
+  MessageInParsed,
+  Status,
+  UPLOAD_CHUNK_SIZE,
+  dlistBegin,
+  dlistChunk,
+  dlistEnd,
+  showList,
+} from '../api'
+import { useStm32Serial } from '../serial-stm32'
+
+type Timing = {
+  status: number
+  slot: number
+  size: number
+  buildCycles: number
+  renderCycles: number
+  coreClock: number
+  framePeriodUs: number
+}
+
+type Upload = {
+  slot: number
+  list: Uint8Array
+  offset: number
+}
+
+// Laid out for 360x240, the list is replayed as is at other sizes
+function gauge(): Uint8Array {
+  const cx = 120
+  const cy = 125
+  const radius = 100
+  const list = new DisplayList()
+    .palette(ListColor.GRAY, [0x18e3])
+    .fill(ListColor.BLACK)
+    .circle(cx, cy, radius, true, ListColor.GRAY)
+    .circle(cx, cy, radius, false, ListColor.WHITE)
+
+  for (let i = 0; i < 12; i++) {
+    const a = (i / 12) * 2 * Math.PI
+    const inner = i % 3 === 0 ? radius - 18 : radius - 10
+    list.line(
+      Math.round(cx + Math.sin(a) * inner),
+      Math.round(cy - Math.cos(a) * inner),
+      Math.round(cx + Math.sin(a) * radius),
+      Math.round(cy - Math.cos(a) * radius),
+      i % 3 === 0 ? 3 : 1,
+      ListColor.WHITE
+    )
+  }
+
+  return list
+    .polygon(
+      [
+        [cx - 6, cy],
+        [cx + 50, cy - 60],
+        [cx + 6, cy],
+        [cx, cy + 14],
+      ],
+      ListColor.YELLOW
+    )
+    .circle(cx, cy, 5, true, ListColor.RED)
+    .text(ListFont.MONO_BOLD_16, cx - 20, cy + 40, 'RPM', ListColor.WHITE)
+    .rect(240, 20, 349, 230, ListColor.GRAY + 1)
+    .blitScaled(ListAsset.FOX, 255, 30, 80, 106, true)
+    .text(ListFont.MONO_12, 250, 150, 'Display list', ListColor.CYAN)
+    .text(ListFont.MONO_12, 250, 170, 'in SDRAM', ListColor.CYAN)
+    .build()
+}
+
+function millis(cycles: number, coreClock: number) {
+  return `${((cycles / coreClock) * 1000).toFixed(2)} ms`
+}
+
+export function LtdcLists() {
+  const [slot, setSlot] = useState(0)
+  const [result, setResult] = useState<string>()
+  const [timing, setTiming] = useState<Timing>()
+  const upload = useRef<Upload>()
+
+  const writeRef = useRef<(data: Uint8Array) => void>(() => {})
+
+  const handleMessageReceive = useCallback((m: MessageInParsed) => {
+    if (m.type === DataTypeIn.LIST_TIME) {
+      setTiming(m)
+      return
+    }
+
+    const u = upload.current
+    if (!u || m.type !== DataTypeIn.ACK) {
+      return
+    }
+
+    if (
+      m.command === CommandOut.DLIST_BEGIN ||
+      m.command === CommandOut.DLIST_CHUNK
+    ) {
+      if (m.status !== Status.OK) {
+        upload.current = undefined
+        setResult(`Rejected: ${Status[m.status]}`)
+        return
+      }
+      if (m.command === CommandOut.DLIST_CHUNK) {
+        u.offset += UPLOAD_CHUNK_SIZE
+      }
+      // Small enough to go one chunk per ACK
+      writeRef.current(
+        u.offset < u.list.length ? dlistChunk(u.list, u.offset) : dlistEnd()
+      )
+    } else if (m.command === CommandOut.DLIST_END) {
+      upload.current = undefined
+      setResult(`${Status[m.status]}, ${u.list.length} bytes to slot ${u.slot}`)
+      if (m.status === Status.OK) {
+        writeRef.current(showList(u.slot))
+      }
+    }
+  }, [])
+
+  const { portState, sendMessage, writeMessage } =
+    useStm32Serial(handleMessageReceive)
+
+  useEffect(() => {
+    writeRef.current = writeMessage
+  }, [writeMessage])
+
+  const uploadGauge = () => {
+    const list = gauge()
+    upload.current = { slot, list, offset: 0 }
+    setResult(undefined)
+    writeMessage(dlistBegin(slot, list.length))
+  }
+
+  const disabled = portState !== 'open'
+
+  return (
+    <Card title="Display Lists">
+      <div className="flex items-center gap-4">
+        <Select
+          disabled={disabled}
+          value={slot}
+          onChange={setSlot}
+          options={Array.from({ length: LIST_SLOTS }, (_, i) => ({
+            label: `Slot ${i}`,
+            value: i,
+          }))}
+        />
+        <Button type="primary" disabled={disabled} onClick={uploadGauge}>
+          Upload gauge
+        </Button>
+        <Button disabled={disabled} onClick={() => sendMessage(showList(slot))}>
+          Show
+        </Button>
+        {result && <div>{result}</div>}
+      </div>
+      {timing && timing.coreClock > 0 && (
+        <div className="mt-3">
+          Slot {timing.slot}, {timing.size} bytes:{' '}
+          {timing.status === 0
+            ? `build ${millis(timing.buildCycles, timing.coreClock)}, ` +
+              `render ${millis(timing.renderCycles, timing.coreClock)}`
+            : `failed (${timing.status})`}
+          {timing.framePeriodUs > 0 &&
+            `, ${(
+              ((timing.renderCycles / timing.coreClock) * 1e8) /
+              timing.framePeriodUs
+            ).toFixed(0)}% of a frame`}
+        </div>
+      )}
+    </Card>
+  )
+}
@@ -0,0 +1,130 @@
+import { useCallback, useEffect, useState } from 'react'
+import { Button, Card, Checkbox, Select, Slider } from 'antd'
+import { DataTypeIn, MessageInParsed, getMfdStats, mfdSetValues } from '../api'
+import { useStm32Serial } from '../serial-stm32'
+
+const POLL_INTERVAL = 1000
+
+// Widgets as registered by the MFD debug screen
+const WIDGET_GAUGE = 0
+const WIDGET_READOUT = 1
+const WIDGET_LOAD = 2
+const WIDGET_BOOST_BAR = 3
+
+const BOOST_MIN = -50
+const BOOST_MAX = 200
+
+type Stats = {
+  widgets: number
+  redraws: number
+  pixels: number
+  cycles: number
+  maxCycles: number
+  coreClock: number
+}
+
+function boostValues(boost: number): [number, number][] {
+  const load = Math.round(((boost - BOOST_MIN) / (BOOST_MAX - BOOST_MIN)) * 100)
+  return [
+    [WIDGET_GAUGE, boost],
+    [WIDGET_READOUT, boost],
+    [WIDGET_LOAD, load],
+    [WIDGET_BOOST_BAR, boost],
+  ]
+}
+
+export function LtdcMfd() {
+  const [boost, setBoost] = useState(0)
+  const [sweep, setSweep] = useState(false)
+  const [rate, setRate] = useState(30)
+  const [stats, setStats] = useState<Stats>()
+
+  const handleMessageReceive = useCallback((m: MessageInParsed) => {
+    if (m.type === DataTypeIn.MFD_STATS) {
+      setStats(m)
+    }
+  }, [])
+
+  const { portState, sendMessage, writeMessage } =
+    useStm32Serial(handleMessageReceive)
+
+  const disabled = portState !== 'open'
+
+  useEffect(() => {
+    if (!sweep || disabled) {
+      return
+    }
+    const start = performance.now()
+    const timer = setInterval(() => {
+      const t = (performance.now() - start) / 1000
+      const value = Math.round(75 + 125 * Math.sin(t * 1.5))
+      setBoost(value)
+      writeMessage(mfdSetValues(boostValues(value)))
+    }, 1000 / rate)
+    return () => clearInterval(timer)
+  }, [sweep, rate, disabled, writeMessage])
+
+  useEffect(() => {
+    if (!sweep || disabled) {
+      return
+    }
+    // Cleared on every read, so the counters are per poll interval
+    const timer = setInterval(
+      () => writeMessage(getMfdStats(true)),
+      POLL_INTERVAL
+    )
+    return () => clearInterval(timer)
+  }, [sweep, disabled, writeMessage])
+
+  const millis = (cycles: number) =>
+    stats ? `${((cycles / stats.coreClock) * 1000).toFixed(2)} ms` : ''
+
+  return (
+    <Card title="MFD Widgets">
+      <div className="flex items-center gap-4">
+        <Slider
+          className="w-64"
+          disabled={disabled || sweep}
+          min={BOOST_MIN}
+          max={BOOST_MAX}
+          value={boost}
+          onChange={(v) => {
+            setBoost(v)
+            sendMessage(mfdSetValues(boostValues(v)))
+          }}
+        />
+        <Checkbox
+          disabled={disabled}
+          checked={sweep}
+          onChange={(e) => setSweep(e.target.checked)}
+        >
+          Sweep
+        </Checkbox>
+        <Select
+          disabled={disabled}
+          value={rate}
+          onChange={setRate}
+          options={[
+            { label: '30 Hz', value: 30 },
+            { label: '60 Hz', value: 60 },
+          ]}
+        />
+        <Button
+          disabled={disabled}
+          onClick={() => sendMessage(getMfdStats(true))}
+        >
+          Stats
+        </Button>
+      </div>
+      {stats && stats.coreClock > 0 && (
+        <div className="mt-3">
+          {stats.widgets} widgets, {stats.redraws} redraws
+          {stats.redraws > 0 &&
+            `, ${Math.round(stats.pixels / stats.redraws)} px each, ` +
+              `${millis(stats.cycles)} drawing (longest tick ` +
+              `${millis(stats.maxCycles)})`}
+        </div>
+      )}
+    </Card>
+  )
+}
@@ -0,0 +1,67 @@
+import { useCallback, useState } from 'react'
+import { Button, Card, Select } from 'antd'
+import { DataTypeIn, MessageInParsed, TestPattern, showPattern } from '../api'
+import { useStm32Serial } from '../serial-stm32'
+
+type Timing = {
+  pattern: TestPattern
+  cycles: number
+  coreClock: number
+  framePeriodUs: number
+}
+
+const patterns = [
+  { label: 'SMPTE bars', value: TestPattern.SMPTE_BARS },
+  { label: 'Circle chart', value: TestPattern.CIRCLE_CHART },
+  { label: 'Multiburst', value: TestPattern.MULTIBURST },
+  { label: 'Luma ramp', value: TestPattern.LUMA_RAMP },
+  { label: 'PLUGE', value: TestPattern.PLUGE },
+  { label: 'Crosshatch', value: TestPattern.CROSSHATCH },
+  { label: 'Checkerboard', value: TestPattern.CHECKERBOARD },
+  { label: 'Zone plate', value: TestPattern.ZONE_PLATE },
+]
+
+export function LtdcPatterns() {
+  const [pattern, setPattern] = useState(TestPattern.SMPTE_BARS)
+  const [timing, setTiming] = useState<Timing>()
+
+  const handleMessageReceive = useCallback((m: MessageInParsed) => {
+    if (m.type === DataTypeIn.PATTERN_TIME) {
+      setTiming(m)
+    }
+  }, [])
+
+  const { portState, sendMessage } = useStm32Serial(handleMessageReceive)
+
+  const disabled = portState !== 'open'
+
+  const micros = timing ? (timing.cycles / timing.coreClock) * 1e6 : 0
+  const share = timing?.framePeriodUs ? micros / timing.framePeriodUs : 0
+
+  return (
+    <Card title="Test Patterns">
+      <div className="flex items-center gap-4">
+        <Select
+          disabled={disabled}
+          value={pattern}
+          onChange={setPattern}
+          options={patterns}
+        />
+        <Button
+          type="primary"
+          disabled={disabled}
+          onClick={() => sendMessage(showPattern(pattern))}
+        >
+          Show
+        </Button>
+        {timing && timing.coreClock > 0 && (
+          <div>
+            {patterns.find((p) => p.value === timing.pattern)?.label}:{' '}
+            {(micros / 1000).toFixed(2)} ms
+            {share > 0 && `, ${(share * 100).toFixed(0)}% of a frame`}
+          </div>
+        )}
+      </div>
+    </Card>
+  )
+}
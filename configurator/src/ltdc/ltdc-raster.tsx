@@ -0,0 +1,191 @@
+import { useCallback, useState } from 'react'
+import { Button, Card, Checkbox, ColorPicker, InputNumber, Select } from 'antd'
+import { ReloadOutlined } from '@ant-design/icons'
+import {
+  DataTypeIn,
+  MessageInParsed,
+  RasterEffect,
+  clearRaster,
+  getRasterStats,
+  setRasterBands,
+  setRasterFade,
+  setRasterRamp,
+} from '../api'
+import { useStm32Serial } from '../serial-stm32'
+
+type Stats = {
+  applied: number
+  late: number
+  lastLatency: number
+  minLatency: number
+  maxLatency: number
+  pixelClock: number
+}
+
+function nanos(pixels: number, pixelClock: number) {
+  return `${((pixels / pixelClock) * 1e9).toFixed(0)} ns`
+}
+
+function grayBands(count: number) {
+  return Array.from({ length: count }, (_, i) => {
+    const level = Math.round((i * 255) / (count - 1))
+    return (level << 16) | (level << 8) | level
+  })
+}
+
+function ColorInput({
+  value,
+  disabled,
+  onChange,
+}: {
+  value: number
+  disabled: boolean
+  onChange: (value: number) => void
+}) {
+  return (
+    <ColorPicker
+      disabled={disabled}
+      disabledAlpha
+      value={`#${value.toString(16).padStart(6, '0')}`}
+      onChange={(color) => onChange(parseInt(color.toHex().slice(0, 6), 16))}
+    />
+  )
+}
+
+export function LtdcRaster() {
+  const [effect, setEffect] = useState(RasterEffect.RAMP)
+  const [from, setFrom] = useState(0x000000)
+  const [to, setTo] = useState(0xffffff)
+  const [bands, setBands] = useState(11)
+  const [fromAlpha, setFromAlpha] = useState(255)
+  const [toAlpha, setToAlpha] = useState(0)
+  const [hideLayer, setHideLayer] = useState(true)
+  const [stats, setStats] = useState<Stats>()
+
+  const handleMessageReceive = useCallback((m: MessageInParsed) => {
+    if (m.type === DataTypeIn.RASTER_STATS) {
+      setStats(m)
+    }
+  }, [])
+
+  const { portState, sendMessage } = useStm32Serial(handleMessageReceive)
+
+  const disabled = portState !== 'open'
+
+  const apply = () => {
+    switch (effect) {
+      case RasterEffect.NONE:
+        sendMessage(clearRaster())
+        break
+      case RasterEffect.RAMP:
+        sendMessage(setRasterRamp(from, to, hideLayer))
+        break
+      case RasterEffect.BANDS:
+        sendMessage(setRasterBands(grayBands(bands), hideLayer))
+        break
+      case RasterEffect.FADE:
+        sendMessage(setRasterFade(from, fromAlpha, toAlpha))
+        break
+    }
+  }
+
+  return (
+    <Card
+      title="Raster Effects"
+      extra={
+        <div className="flex items-center gap-4">
+          <Button
+            icon={<ReloadOutlined />}
+            disabled={disabled}
+            onClick={() => sendMessage(getRasterStats())}
+          >
+            Get
+          </Button>
+          <Button
+            disabled={disabled}
+            onClick={() => sendMessage(getRasterStats(true))}
+          >
+            Clear
+          </Button>
+        </div>
+      }
+    >
+      <div className="flex items-center gap-4">
+        <Select
+          disabled={disabled}
+          value={effect}
+          onChange={setEffect}
+          options={[
+            { label: 'None', value: RasterEffect.NONE },
+            { label: 'Ramp', value: RasterEffect.RAMP },
+            { label: 'Gray bands', value: RasterEffect.BANDS },
+            { label: 'Layer fade', value: RasterEffect.FADE },
+          ]}
+        />
+        {(effect === RasterEffect.RAMP || effect === RasterEffect.FADE) && (
+          <ColorInput value={from} disabled={disabled} onChange={setFrom} />
+        )}
+        {effect === RasterEffect.RAMP && (
+          <ColorInput value={to} disabled={disabled} onChange={setTo} />
+        )}
+        {effect === RasterEffect.BANDS && (
+          <InputNumber
+            disabled={disabled}
+            addonBefore="Bands"
+            min={2}
+            max={14}
+            value={bands}
+            onChange={(v) => v !== null && setBands(v)}
+          />
+        )}
+        {effect === RasterEffect.FADE && (
+          <>
+            <InputNumber
+              disabled={disabled}
+              addonBefore="Alpha from"
+              min={0}
+              max={255}
+              value={fromAlpha}
+              onChange={(v) => v !== null && setFromAlpha(v)}
+            />
+            <InputNumber
+              disabled={disabled}
+              addonBefore="to"
+              min={0}
+              max={255}
+              value={toAlpha}
+              onChange={(v) => v !== null && setToAlpha(v)}
+            />
+          </>
+        )}
+        {(effect === RasterEffect.RAMP || effect === RasterEffect.BANDS) && (
+          <Checkbox
+            disabled={disabled}
+            checked={hideLayer}
+            onChange={(e) => setHideLayer(e.target.checked)}
+          >
+            Hide layer
+          </Checkbox>
+        )}
+        <Button type="primary" disabled={disabled} onClick={apply}>
+          Apply
+        </Button>
+      </div>
+      {stats && stats.pixelClock > 0 && (
+        <div className="grid grid-cols-5 gap-4 mt-3">
+          <div>Line writes: {stats.applied}</div>
+          <div>Late: {stats.late}</div>
+          <div>
+            Latency: {nanos(stats.minLatency, stats.pixelClock)} –{' '}
+            {nanos(stats.maxLatency, stats.pixelClock)}
+          </div>
+          <div>
+            Jitter:{' '}
+            {nanos(stats.maxLatency - stats.minLatency, stats.pixelClock)}
+          </div>
+          <div>Last: {nanos(stats.lastLatency, stats.pixelClock)}</div>
+        </div>
+      )}
+    </Card>
+  )
+}
@@ -0,0 +1,185 @@
+import { useCallback, useEffect, useState } from 'react'
+import { Button, Card, Checkbox, Select } from 'antd'
+import { ReloadOutlined } from '@ant-design/icons'
+import {
+  DataTypeIn,
+  MessageInParsed,
+  Throttle,
+  getEventStats,
+  getLTDCErrors,
+  getScanline,
+  join,
+  setBeamMode,
+  setThrottle,
+} from '../api'
+import { useStm32Serial } from '../serial-stm32'
+
+const POLL_INTERVAL = 1000
+
+type Stats = {
+  underrunFrames: number
+  transferErrorFrames: number
+  lastErrorFrame: number
+  frame: number
+  throttle: Throttle
+  throttled: boolean
+}
+
+type EventStats = {
+  dispatched: number
+  dropped: number
+  lastLatency: number
+  minLatency: number
+  maxLatency: number
+  maxHandler: number
+  coreClock: number
+}
+
+type Scanline = {
+  scanline: number
+  accumulatedVBP: number
+  accumulatedActiveH: number
+  totalHeight: number
+  frame: number
+  beamMode: boolean
+}
+
+function beamRow(s: Scanline) {
+  if (s.scanline <= s.accumulatedVBP) {
+    return 'vertical sync / back porch'
+  }
+  if (s.scanline > s.accumulatedActiveH) {
+    return 'front porch'
+  }
+  return `row ${s.scanline - s.accumulatedVBP - 1}`
+}
+
+function micros(cycles: number, coreClock: number) {
+  return `${((cycles / coreClock) * 1e6).toFixed(1)} µs`
+}
+
+export function LtdcTelemetry() {
+  const [stats, setStats] = useState<Stats>()
+  const [events, setEvents] = useState<EventStats>()
+  const [scanline, setScanline] = useState<Scanline>()
+  const [poll, setPoll] = useState(false)
+
+  const handleMessageReceive = useCallback((m: MessageInParsed) => {
+    if (m.type === DataTypeIn.LTDC_ERRORS) {
+      setStats(m)
+    } else if (m.type === DataTypeIn.EVENT_STATS) {
+      setEvents(m)
+    } else if (m.type === DataTypeIn.SCANLINE) {
+      setScanline(m)
+    }
+  }, [])
+
+  const { portState, sendMessage } = useStm32Serial(handleMessageReceive)
+
+  const disabled = portState !== 'open'
+
+  useEffect(() => {
+    if (!poll || disabled) {
+      return
+    }
+    const timer = setInterval(
+      () =>
+        sendMessage(join(getLTDCErrors(), getEventStats(), getScanline())),
+      POLL_INTERVAL
+    )
+    return () => clearInterval(timer)
+  }, [poll, disabled, sendMessage])
+
+  return (
+    <Card
+      title="LTDC Errors"
+      extra={
+        <div className="flex items-center gap-4">
+          <Select
+            disabled={disabled}
+            value={stats?.throttle ?? Throttle.OFF}
+            onChange={(mode) => {
+              sendMessage(setThrottle(mode))
+              setStats((s) => s && { ...s, throttle: mode })
+            }}
+            options={[
+              { label: 'Throttle off', value: Throttle.OFF },
+              { label: 'Throttle on', value: Throttle.ON },
+              { label: 'Throttle auto', value: Throttle.AUTO },
+            ]}
+          />
+          <Checkbox
+            disabled={disabled}
+            checked={scanline?.beamMode ?? false}
+            onChange={(e) => {
+              const enabled = e.target.checked
+              sendMessage(setBeamMode(enabled))
+              setScanline((s) => s && { ...s, beamMode: enabled })
+            }}
+          >
+            Behind the beam
+          </Checkbox>
+          <Button
+            icon={<ReloadOutlined />}
+            disabled={disabled}
+            onClick={() =>
+              sendMessage(
+                join(getLTDCErrors(), getEventStats(), getScanline())
+              )
+            }
+          >
+            Get
+          </Button>
+          <Button
+            disabled={disabled}
+            onClick={() =>
+              sendMessage(join(getLTDCErrors(true), getEventStats(true)))
+            }
+          >
+            Clear
+          </Button>
+          <Checkbox
+            disabled={disabled}
+            checked={poll}
+            onChange={(e) => setPoll(e.target.checked)}
+          >
+            Poll
+          </Checkbox>
+        </div>
+      }
+    >
+      {stats && (
+        <div className="grid grid-cols-5 gap-4">
+          <div>Underrun frames: {stats.underrunFrames}</div>
+          <div>Transfer error frames: {stats.transferErrorFrames}</div>
+          <div>Last error at frame: {stats.lastErrorFrame}</div>
+          <div>Frame: {stats.frame}</div>
+          <div>{stats.throttled ? 'Throttled' : 'Not throttled'}</div>
+        </div>
+      )}
+      {events && events.coreClock > 0 && (
+        <div className="grid grid-cols-5 gap-4 mt-3">
+          <div>Events: {events.dispatched}</div>
+          <div>Dropped: {events.dropped}</div>
+          <div>
+            Latency: {micros(events.minLatency, events.coreClock)} –{' '}
+            {micros(events.maxLatency, events.coreClock)}
+          </div>
+          <div>Last: {micros(events.lastLatency, events.coreClock)}</div>
+          <div>
+            Longest handler: {micros(events.maxHandler, events.coreClock)}
+          </div>
+        </div>
+      )}
+      {scanline && (
+        <div className="grid grid-cols-5 gap-4 mt-3">
+          <div>
+            Scanline: {scanline.scanline} / {scanline.totalHeight + 1}
+          </div>
+          <div>Beam: {beamRow(scanline)}</div>
+          <div>At frame: {scanline.frame}</div>
+        </div>
+      )}
+    </Card>
+  )
+}
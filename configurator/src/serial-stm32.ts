@@ -9,6 +9,8 @@ import {
   parseMessageIn,
 } from './api'
 
+let writeQueue = Promise.resolve()
+
 export const useStm32Serial = (rxCb?: (m: MessageInParsed) => void) => {
   const { connect, disconnect, subscribe, write, portState } = useSerial()
 
@@ -21,17 +23,27 @@ export const useStm32Serial = (rxCb?: (m: MessageInParsed) => void) => {
     [rxCb]
   )
 
-  const sendMessage = useDebouncedCallback((data: MessageOut) => {
-    write(data)
-      .then((res) => {
-        if (!res) {
-          console.error('Failed to send message:', data)
-        } else {
-          console.log('Message sent:', data)
-        }
-      })
-      .catch(console.error)
-  }, 100)
+  /**
+   * Sends right away, writes are chained so a port writer is never
+   * requested while the previous one is still locked.
+   */
+  const writeMessage = useCallback(
+    (data: MessageOut) => {
+      writeQueue = writeQueue
+        .then(() => write(data))
+        .then((res) => {
+          if (!res) {
+            console.error('Failed to send message:', data)
+          } else {
+            console.log('Message sent:', data)
+          }
+        })
+        .catch(console.error)
+    },
+    [write]
+  )
+
+  const sendMessage = useDebouncedCallback(writeMessage, 100)
 
   const readMessageChunk = useMemo(() => {
     console.log('createMessageReader')
@@ -44,5 +56,12 @@ export const useStm32Serial = (rxCb?: (m: MessageInParsed) => void) => {
     // eslint-disable-next-line react-hooks/exhaustive-deps
   }, [])
 
-  return { connect, disconnect, portState, subscribe, sendMessage }
+  return {
+    connect,
+    disconnect,
+    portState,
+    subscribe,
+    sendMessage,
+    writeMessage,
+  }
 }
@@ -0,0 +1,57 @@
+#ifndef LTDC_0_ANIM_H
+#define LTDC_0_ANIM_H
+
+#include "main.h"
+
+/**
+ * Frame paced animation. The running animation has its update called once
+ * per video frame, from the main loop as soon as it sees the vblank, and
+ * has until the next one to draw. Update times are measured against a
+ * budget: longer updates are overruns, frames that passed without an update
+ * showed the previous frame again and are counted as missed.
+ */
+#define ANIM_HISTOGRAM_BINS 16
+
+/**
+ * Histogram bins per budget, the bins cover twice the budget and the last one takes everything longer
+ */
+#define ANIM_HISTOGRAM_SCALE 8
+
+/**
+ * frames is the number of video frames since the previous update, 1 unless some were missed,
+ * so motion can follow the frame count rather than the update count
+ */
+typedef void (*ANIM_UpdateTypeDef)(uint32_t frame, uint32_t frames);
+
+typedef struct ANIM_StatsTypeDef {
+  uint32_t Updates;
+  uint32_t Missed;
+  uint32_t Overruns;
+  uint32_t Budget; // cycles, of the last update
+  uint32_t LastCycles;
+  uint32_t MaxCycles;
+  uint32_t MaxLatency; // cycles from the vblank to the start of an update
+  uint16_t Histogram[ANIM_HISTOGRAM_BINS]; // update times, Budget / ANIM_HISTOGRAM_SCALE cycles per bin
+} ANIM_StatsTypeDef;
+
+/**
+ * Replaces the running animation, the first update comes with the next frame.
+ * budgetUs 0 is the frame period at the current config.
+ */
+void ANIM_start(ANIM_UpdateTypeDef update, uint32_t budgetUs);
+
+void ANIM_stop(void);
+
+uint8_t ANIM_isRunning(void);
+
+/**
+ * Runs the update when a frame started since the last one, call from the main loop
+ * while nothing else draws
+ */
+void ANIM_tick(void);
+
+ANIM_StatsTypeDef ANIM_getStats(void);
+
+void ANIM_resetStats(void);
+
+#endif //LTDC_0_ANIM_H
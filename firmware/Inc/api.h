@@ -2,11 +2,33 @@
 #define LTDC_0_API_H
 
 #include "main.h"
+#include "api_transport.h"
 
-void API_Init(UART_HandleTypeDef *h);
+void API_Init(const API_TransportTypeDef *t);
 
+/**
+ * Streams screenshot data and reports scheduled command results,
+ * received packets are handled on EVENT_API_PACKET.
+ */
 void API_Tick(void);
 
+/**
+ * Nothing queued or in progress, the main loop may sleep
+ */
+uint8_t API_isIdle(void);
+
+/**
+ * Feeds received bytes into the packet queue, called by the transport
+ * backends, usually from interrupt context.
+ */
+void API_receive(const uint8_t *data, uint16_t size);
+
+/**
+ * Drops the partially received packet, the next byte starts a new one.
+ * Called by the transport backends after a line error lost bytes.
+ */
+void API_resetReceive(void);
+
 HAL_StatusTypeDef API_transmit(const uint8_t *pData, uint16_t size);
 
 #endif //LTDC_0_API_H
@@ -0,0 +1,40 @@
+#ifndef LTDC_0_API_TRANSPORT_H
+#define LTDC_0_API_TRANSPORT_H
+
+#include "main.h"
+
+/**
+ * Byte transport used by the API.
+ * A backend delivers received bytes by calling API_receive, in any chunk size
+ * and from any context, and sends complete packets through transmit.
+ * It calls API_resetReceive when received bytes were lost.
+ * setBaudRate is NULL for backends without a configurable line rate.
+ */
+typedef struct API_TransportTypeDef {
+  HAL_StatusTypeDef (*start)(void);
+
+  HAL_StatusTypeDef (*transmit)(const uint8_t *data, uint16_t size);
+
+  uint8_t (*isBaudRateSupported)(uint32_t baudRate);
+
+  HAL_StatusTypeDef (*setBaudRate)(uint32_t baudRate);
+} API_TransportTypeDef;
+
+/**
+ * USART with circular DMA reception, switches to 8x oversampling
+ * for rates above PCLK / 16.
+ */
+const API_TransportTypeDef *API_TRANSPORT_uart(UART_HandleTypeDef *huart);
+
+/**
+ * In-memory loopback: transmitted packets are buffered for
+ * API_TRANSPORT_loopbackRead, API_TRANSPORT_loopbackWrite injects bytes as
+ * if they were received. Has no peripheral dependencies.
+ */
+const API_TransportTypeDef *API_TRANSPORT_loopback(void);
+
+void API_TRANSPORT_loopbackWrite(const uint8_t *data, uint16_t size);
+
+uint16_t API_TRANSPORT_loopbackRead(uint8_t *data, uint16_t size);
+
+#endif //LTDC_0_API_TRANSPORT_H
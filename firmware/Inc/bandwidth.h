@@ -0,0 +1,45 @@
+#ifndef LTDC_0_BANDWIDTH_H
+#define LTDC_0_BANDWIDTH_H
+
+#include "main.h"
+#include "disp.h"
+
+typedef enum {
+  BANDWIDTH_POLICY_OFF = 0x00,
+  BANDWIDTH_POLICY_WARN = 0x01, // apply, but report low headroom
+  BANDWIDTH_POLICY_REJECT = 0x02, // refuse configs without headroom
+} BANDWIDTH_PolicyTypeDef;
+
+typedef enum {
+  BANDWIDTH_OK = 0x00,
+  BANDWIDTH_LOW = 0x01, // less than BANDWIDTH_LOW_HEADROOM_PERCENT left
+  BANDWIDTH_EXCEEDED = 0x02, // scanout and drawing need more than SDRAM delivers
+} BANDWIDTH_ResultTypeDef;
+
+#define BANDWIDTH_LOW_HEADROOM_PERCENT 10
+
+/**
+ * All values in bytes per second.
+ * Available is the sustained SDRAM read rate for LTDC bursts derived from
+ * the FMC configuration, ScanoutPeak is the rate the layers are fetched
+ * during active video, DrawReserve is the share kept for drawing.
+ */
+typedef struct BANDWIDTH_EstimateTypeDef {
+  uint32_t Available;
+  uint32_t ScanoutPeak;
+  uint32_t ScanoutAverage;
+  uint32_t DrawReserve;
+  int32_t Headroom;
+} BANDWIDTH_EstimateTypeDef;
+
+BANDWIDTH_EstimateTypeDef BANDWIDTH_estimate(const DISP_LTDC_ConfigTypeDef *cfg, uint32_t pixelClock);
+
+BANDWIDTH_ResultTypeDef BANDWIDTH_check(const BANDWIDTH_EstimateTypeDef *estimate);
+
+void BANDWIDTH_setPolicy(BANDWIDTH_PolicyTypeDef policy, uint8_t drawReservePercent);
+
+BANDWIDTH_PolicyTypeDef BANDWIDTH_getPolicy(void);
+
+uint8_t BANDWIDTH_getDrawReservePercent(void);
+
+#endif //LTDC_0_BANDWIDTH_H
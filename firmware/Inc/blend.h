@@ -0,0 +1,38 @@
+#ifndef LTDC_0_BLEND_H
+#define LTDC_0_BLEND_H
+
+#include "main.h"
+
+/**
+ * Source formats that can be blended into the RGB565 framebuffer. Sources are in
+ * framebuffer channel order, red and blue swapped like the framebuffer itself,
+ * the DMA2D of the F429 has no red blue swap of its own.
+ */
+typedef enum {
+  BLEND_RGB565 = 0x00, // constant alpha only
+  BLEND_ARGB4444 = 0x01,
+  BLEND_ARGB8888 = 0x02,
+} BLEND_FormatTypeDef;
+
+uint8_t BLEND_getPixelSize(BLEND_FormatTypeDef format);
+
+/**
+ * Blends count source pixels over dst with the CPU, alpha multiplies the per pixel alpha
+ */
+void BLEND_row(uint16_t *dst, const void *src, BLEND_FormatTypeDef format, uint8_t alpha, uint32_t count);
+
+/**
+ * Blends a width x height source over the RGB565 rect at dst, rows srcStride and dstStride pixels apart.
+ * Runs on DMA2D memory to memory with blending and waits for it, the CPU does it when DMA2D cannot
+ * read the source (CCM RAM). Waits for a tile flush in progress first.
+ */
+HAL_StatusTypeDef BLEND_rect(uint16_t *dst, uint32_t dstStride, const void *src, uint32_t srcStride,
+                             BLEND_FormatTypeDef format, uint8_t alpha, uint16_t width, uint16_t height);
+
+/**
+ * Same as BLEND_rect, always on the CPU
+ */
+void BLEND_rectCpu(uint16_t *dst, uint32_t dstStride, const void *src, uint32_t srcStride,
+                   BLEND_FormatTypeDef format, uint8_t alpha, uint16_t width, uint16_t height);
+
+#endif //LTDC_0_BLEND_H
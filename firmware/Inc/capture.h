@@ -0,0 +1,21 @@
+#ifndef LTDC_0_CAPTURE_H
+#define LTDC_0_CAPTURE_H
+
+#include "main.h"
+
+/**
+ * Reads back a rect of the page being shown, encoded with the LITERAL and RUN
+ * ops of the upload stream format (see upload.h), as RGB565 in host order.
+ * Scanout is not interrupted, drawing during a capture ends up partially in it.
+ */
+uint8_t CAPTURE_begin(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+/**
+ * Fills data with whole ops, up to size bytes.
+ * Returns the number of bytes written, 0 once the rect is complete.
+ */
+uint8_t CAPTURE_read(uint8_t *data, uint8_t size);
+
+uint8_t CAPTURE_isActive(void);
+
+#endif //LTDC_0_CAPTURE_H
@@ -0,0 +1,28 @@
+#ifndef LTDC_0_CRC_H
+#define LTDC_0_CRC_H
+
+#include "main.h"
+
+#define CRC_INIT 0xFFFFFFFF
+
+/**
+ * CRC-32/MPEG-2 (poly 0x04C11DB7, no reflection, no final xor),
+ * the same polynomial the CRC peripheral uses.
+ * Pass CRC_INIT for the first block and the previous result to continue.
+ */
+uint32_t CRC_calc(uint32_t crc, const uint8_t *data, uint32_t size);
+
+/**
+ * CRC peripheral fed by memory-to-memory DMA, the DMA stream packs
+ * halfwords in pairs into words, the first one in the low half.
+ * An odd trailing halfword is fed zero-extended.
+ */
+void CRC_hwInit(DMA_HandleTypeDef *hdma);
+
+void CRC_hwReset(void);
+
+HAL_StatusTypeDef CRC_hwFeed16(uint32_t addr, uint32_t count);
+
+uint32_t CRC_hwResult(void);
+
+#endif //LTDC_0_CRC_H
@@ -13,4 +13,47 @@ void DEBUG_SCREEN_next(void);
 
 void DEBUG_SCREEN_reInit(void);
 
+/**
+ * Renders the next or the previous screen to a page that is not shown, DEBUG_SCREEN_showPrepared
+ * switches to it. The shown screen stops updating meanwhile, a screen change cancels it.
+ */
+void DEBUG_SCREEN_prepare(uint8_t next);
+
+/**
+ * Drops the prepared screen, for commands drawing to the shown page directly
+ */
+void DEBUG_SCREEN_cancelPrepared(void);
+
+/**
+ * A prepared screen is rendering or waiting to be shown
+ */
+uint8_t DEBUG_SCREEN_isPreparing(void);
+
+/**
+ * Shows the prepared screen once it is rendered, returns 0 before. Only latches the page address,
+ * call it from the vblank callback for the switch to take effect in that frame.
+ */
+uint8_t DEBUG_SCREEN_showPrepared(void);
+
+/**
+ * Shows the display list uploaded into slot until another screen is selected, it is built again by
+ * DEBUG_SCREEN_reInit. Rendered tells that the caller has already drawn it.
+ */
+void DEBUG_SCREEN_showList(uint8_t slot, uint8_t rendered);
+
+/**
+ * The page being shown was drawn outside of the debug screen, nothing draws to it
+ * until another screen is selected, config changes included
+ */
+void DEBUG_SCREEN_showExternal(void);
+
+/**
+ * Switches to motion test screen animation, 0 moving bars or 1 a scrolling zone plate, moving speed pixels
+ * per frame. budgetUs is the frame time budget of ANIM_start. Returns 0 for an unknown animation.
+ * The screen is switched or restarted by the tick, call from the main loop.
+ */
+uint8_t DEBUG_SCREEN_animate(uint8_t animation, uint8_t speed, uint32_t budgetUs);
+
+uint8_t DEBUG_SCREEN_isIdle(void);
+
 #endif //LTDC_0_DEBUG_SCREEN_H
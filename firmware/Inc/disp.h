@@ -2,6 +2,8 @@
 #define __DISP_H
 
 #include "main.h"
+#include "font.h"
+#include "vector.h"
 
 /**
    * For 16 bpp colors the color format is RGB565.
@@ -15,6 +17,13 @@
 #define DISP_COLOR_WHITE 0xFFFF
 #define DISP_COLOR_BLACK 0
 
+/**
+ * SDRAM is split into framebuffer pages, page 0 is the one shown after reset.
+ * A page fits a full 16 bpp frame up to 1 MB.
+ */
+#define DISP_PAGE_SIZE ((uint32_t) 0x100000)
+#define DISP_PAGE_COUNT 4
+
 typedef struct DISP_LTDC_ConfigTypeDef {
   uint32_t HorizontalSync;
   uint32_t VerticalSync;
@@ -36,6 +45,40 @@ typedef struct DISP_LTDC_ClockConfigTypeDef {
   uint32_t PLLSAIDivR; // RCC_PLLSAIDIVR_2, RCC_PLLSAIDIVR_4, RCC_PLLSAIDIVR_8, RCC_PLLSAIDIVR_16
 } DISP_LTDC_ClockConfigTypeDef;
 
+typedef struct DISP_RectTypeDef {
+  uint16_t X;
+  uint16_t Y;
+  uint16_t Width;
+  uint16_t Height;
+} DISP_RectTypeDef;
+
+typedef struct DISP_ChecksumWatchTypeDef {
+  DISP_RectTypeDef Rect;
+  uint16_t Interval; // frames between checks, 0 - disabled
+  uint32_t Golden;
+  uint32_t Last;
+  uint32_t Checks;
+  uint32_t Mismatches;
+} DISP_ChecksumWatchTypeDef;
+
+typedef enum {
+  DISP_THROTTLE_OFF = 0x00,
+  DISP_THROTTLE_ON = 0x01,
+  DISP_THROTTLE_AUTO = 0x02, // engaged for a while after each LTDC error
+} DISP_ThrottleTypeDef;
+
+/**
+ * Frames are counted once per error type, the interrupts are re-armed at vblank
+ */
+typedef struct DISP_ErrorStatsTypeDef {
+  uint32_t UnderrunFrames;
+  uint32_t TransferErrorFrames;
+  uint32_t LastErrorFrame;
+  uint32_t Frame;
+  uint8_t Throttle; // DISP_ThrottleTypeDef
+  uint8_t Throttled;
+} DISP_ErrorStatsTypeDef;
+
 void DISP_FillScreen(uint16_t color);
 
 void DISP_FillRect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
@@ -44,6 +87,58 @@ void DISP_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint16_t color);
 
 void DISP_DrawBitmap(uint16_t *ptr_image, uint16_t img_width, uint16_t img_height, uint8_t tile, uint8_t center);
 
+/**
+ * Part of DISP_DrawBitmap, draws screen rows [first_row, first_row + row_count)
+ */
+void DISP_DrawBitmapRows(uint16_t *ptr_image, uint16_t img_width, uint16_t img_height, uint8_t tile, uint8_t center,
+                         uint16_t first_row, uint16_t row_count);
+
+/**
+ * Scales the whole image to the rect at x, y of width x height, clipped to the screen.
+ * filter is a SCALE_FilterTypeDef.
+ */
+void DISP_DrawBitmapScaled(uint16_t *ptr_image, uint16_t img_width, uint16_t img_height, uint16_t x, uint16_t y,
+                           uint16_t width, uint16_t height, uint8_t filter);
+
+/**
+ * Draws the image turned by rotation quarter turns clockwise at x, y, clipped to the screen.
+ * rotation is a ROTATE_AngleTypeDef, mirror flips the image horizontally before the turn.
+ */
+void DISP_DrawBitmapRotated(uint16_t *ptr_image, uint16_t img_width, uint16_t img_height, uint16_t x, uint16_t y,
+                            uint8_t rotation, uint8_t mirror);
+
+/**
+ * Blends the image over the screen at x, y, clipped to the screen. format is a BLEND_FormatTypeDef,
+ * the image is in framebuffer channel order. alpha is the constant alpha, multiplied with the per pixel one.
+ */
+void DISP_DrawBitmapBlend(const void *ptr_image, uint8_t format, uint16_t img_width, uint16_t img_height,
+                          uint16_t x, uint16_t y, uint8_t alpha);
+
+/**
+ * Draws the text with its top left at x, y, clipped to the screen. Opaque fills the glyph cells with background.
+ */
+void DISP_DrawString(const FONT_TypeDef *font, const char *text, uint16_t x, uint16_t y, uint16_t color,
+                     uint16_t background, uint8_t opaque);
+
+/**
+ * Redraws text at x, y that was drawn opaque as oldText, only the glyph cells that differ are written
+ * and the cells left over from a longer oldText are cleared. Returns the rect written, 0 wide when none.
+ */
+DISP_RectTypeDef DISP_UpdateString(const FONT_TypeDef *font, const char *oldText, const char *newText, uint16_t x,
+                                   uint16_t y, uint16_t color, uint16_t background);
+
+/**
+ * Vector shapes drawn with span writes, see vector.h. Coordinates may lie outside the screen, shapes are clipped
+ * to it. Width is the line width in pixels, 1 for a Bresenham line.
+ */
+void DISP_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t width, uint16_t color);
+
+void DISP_DrawCircle(int16_t cx, int16_t cy, uint16_t radius, uint16_t color);
+
+void DISP_FillCircle(int16_t cx, int16_t cy, uint16_t radius, uint16_t color);
+
+void DISP_FillPolygon(const VECTOR_PointTypeDef *points, uint8_t count, uint16_t color);
+
 uint16_t DISP_SwapRedBlue(uint16_t color);
 
 void DISP_drawRects(uint16_t w, uint16_t h, uint8_t step);
@@ -52,16 +147,122 @@ uint32_t DISP_getScreenWidth(void);
 
 uint32_t DISP_getScreenHeight(void);
 
+/**
+ * Framebuffer the drawing functions write to, the shown page unless DISP_setDrawPage selected another
+ */
+uint32_t DISP_getDrawAddress(void);
+
+/**
+ * Draws to page while another one is shown, DISP_PAGE_COUNT follows the shown page again
+ */
+void DISP_setDrawPage(uint8_t page);
+
 DISP_LTDC_ConfigTypeDef DISP_getCurrentCfg(void);
 
-void DISP_init(SDRAM_HandleTypeDef *hsdram, LTDC_HandleTypeDef *hltdc, SPI_HandleTypeDef *hspi, I2C_HandleTypeDef *hi2c);
+void DISP_init(SDRAM_HandleTypeDef *hsdram, LTDC_HandleTypeDef *hltdc, SPI_HandleTypeDef *hspi, I2C_HandleTypeDef *hi2c,
+               DMA_HandleTypeDef *hdma);
 
 void DISP_reInit(DISP_LTDC_ConfigTypeDef *newCfg);
 
+/**
+ * Incremental alternative to DISP_reInit: only the registers that differ
+ * from the current config are written, during vertical blanking, so the
+ * encoder keeps sync. Returns HAL_ERROR for timings out of order or an image larger than a page.
+ */
+HAL_StatusTypeDef DISP_applyConfig(DISP_LTDC_ConfigTypeDef *newCfg);
+
 uint32_t DISP_getLtdcPixelClockFreq(void);
 
+/**
+ * Frame period of the current timings in us, 0 while the pixel clock is unknown
+ */
+uint32_t DISP_getFramePeriodUs(void);
+
+/**
+ * Pixel clock a clock config would produce, PLLSAIDivR as RCC_PLLSAIDIVR_x
+ */
+uint32_t DISP_calcPixelClockFreq(const DISP_LTDC_ClockConfigTypeDef *cfg);
+
 void DISP_Set_Clock_Config(DISP_LTDC_ClockConfigTypeDef *cfg);
 
 DISP_LTDC_ClockConfigTypeDef DISP_Get_Clock_Config(void);
 
+uint32_t DISP_getPageAddress(uint8_t page);
+
+uint8_t DISP_getActivePage(void);
+
+void DISP_showPage(uint8_t page);
+
+uint32_t DISP_getFrameCount(void);
+
+/**
+ * EVENT_cycles at the start of the last vertical blanking
+ */
+uint32_t DISP_getVblankCycles(void);
+
+/**
+ * Line the LTDC is scanning out, counted from the start of vertical sync
+ */
+uint16_t DISP_getScanline(void);
+
+/**
+ * Framebuffer row being scanned out. Negative during vertical sync and back porch,
+ * image height and above in the front porch or while the LTDC is disabled.
+ */
+int32_t DISP_getBeamRow(void);
+
+/**
+ * Scanline of the first image row
+ */
+uint32_t DISP_getFirstImageLine(void);
+
+/**
+ * Called from the LTDC line event at the start of vertical blanking, after the frame counter
+ * is incremented. DISP_showPage and DISP_applyConfig take effect immediately when called from it,
+ * the encoder update and the screen rebuild of a config change follow from the main loop.
+ */
+void DISP_VblankCallback(uint32_t frame);
+
+/**
+ * Called from the LTDC line event, at vblank after DISP_VblankCallback and on the lines it asked for.
+ * Returns the next scanline to be called on in the active area, 0 for none until the next vblank.
+ */
+uint32_t DISP_LineCallback(uint32_t scanline, uint8_t vblank);
+
+/**
+ * CRC-32/MPEG-2 of the shown page inside rect, computed by the CRC peripheral.
+ * Each row is fed as words of two stored pixels (red and blue swapped),
+ * the first pixel in the low half, an odd last pixel zero-extended.
+ * The rect is clipped to the screen.
+ */
+uint32_t DISP_frameChecksum(DISP_RectTypeDef rect);
+
+/**
+ * Records the checksum of rect and re-verifies it every interval frames
+ * on vblank events, mismatches are counted. Interval 0 stops watching.
+ */
+void DISP_watchChecksum(DISP_RectTypeDef rect, uint16_t interval);
+
+DISP_ChecksumWatchTypeDef DISP_getChecksumWatch(void);
+
+DISP_ErrorStatsTypeDef DISP_getErrorStats(void);
+
+void DISP_resetErrorStats(void);
+
+/**
+ * While throttled, framebuffer writers only touch SDRAM during vertical
+ * blanking, leaving the full bandwidth to the LTDC during active video.
+ */
+void DISP_setThrottle(DISP_ThrottleTypeDef mode);
+
+/**
+ * Called by framebuffer writers between rows, blocks during active video while throttled.
+ */
+void DISP_throttle(void);
+
+/**
+ * DISP_throttle would block right now
+ */
+uint8_t DISP_isThrottled(void);
+
 #endif /* __DISP_H */
@@ -0,0 +1,129 @@
+#ifndef LTDC_0_DLIST_H
+#define LTDC_0_DLIST_H
+
+#include "main.h"
+
+/**
+ * Display lists, a screen recorded as a stream of draw ops that is turned
+ * into TILE_ primitives. Lists are kept in flash or uploaded into SDRAM
+ * slots above the framebuffer pages and can be replayed at any time,
+ * after a config change they are composed again at the new resolution.
+ *
+ * Every op starts with its op byte, values are little endian.
+ * x and y are int16 and may lie outside the screen, blits take uint16.
+ * Colors are an index into a palette of DLIST_PALETTE_SIZE RGB565 entries,
+ * it starts as DLIST_COLOR_ at the beginning of every list.
+ *
+ *   END                                             the list may also just end
+ *   PALETTE [first][count][count x color u16]
+ *   FILL [color]
+ *   PATTERN [pattern]                               PATTERN_TypeDef
+ *   RECT [x1][y1][x2][y2][color]                    filled, corners included
+ *   LINE [x1][y1][x2][y2][width u8][color]
+ *   CIRCLE [cx][cy][radius u16][filled u8][color]
+ *   POLYGON [count u8][color][count x ([x][y])]
+ *   BLIT [asset u8][x u16][y u16]                   DLIST_AssetTypeDef
+ *   BLIT_SCALED [asset u8][x u16][y u16][width u16][height u16][filter u8]
+ *   TEXT [font u8][x][y][color][background][opaque u8][characters][0]
+ */
+#define DLIST_PALETTE_SIZE 16
+
+/**
+ * Upload slots, the shown slot must not be uploaded to
+ */
+#define DLIST_SLOTS 8
+#define DLIST_SLOT_SIZE ((uint32_t) 0x4000)
+
+/**
+ * Polygon vertices of all polygons in a list, they are copied out of the list
+ */
+#define DLIST_MAX_POINTS 256
+
+/**
+ * Operand bytes of a list written as a C array, int16 values wrap into the same bytes
+ */
+#define DLIST_U16(v) (uint8_t) ((uint16_t) (v) & 0xFF), (uint8_t) ((uint16_t) (v) >> 8)
+
+typedef enum {
+  DLIST_OP_END = 0x00,
+  DLIST_OP_PALETTE = 0x01,
+  DLIST_OP_FILL = 0x02,
+  DLIST_OP_PATTERN = 0x03,
+  DLIST_OP_RECT = 0x04,
+  DLIST_OP_LINE = 0x05,
+  DLIST_OP_CIRCLE = 0x06,
+  DLIST_OP_POLYGON = 0x07,
+  DLIST_OP_BLIT = 0x08,
+  DLIST_OP_BLIT_SCALED = 0x09,
+  DLIST_OP_TEXT = 0x0A,
+} DLIST_OpTypeDef;
+
+typedef enum {
+  DLIST_COLOR_BLACK = 0x00,
+  DLIST_COLOR_WHITE = 0x01,
+  DLIST_COLOR_RED = 0x02,
+  DLIST_COLOR_GREEN = 0x03,
+  DLIST_COLOR_BLUE = 0x04,
+  DLIST_COLOR_YELLOW = 0x05,
+  DLIST_COLOR_CYAN = 0x06,
+  DLIST_COLOR_MAGENTA = 0x07,
+  DLIST_COLOR_GRAY = 0x08, // 0x08..0x0F gray levels, darkest first
+} DLIST_ColorTypeDef;
+
+typedef enum {
+  DLIST_ASSET_FOX = 0x00, // 240x320
+  DLIST_ASSET_MFD_SINGLE = 0x01, // 317x186
+  DLIST_ASSET_MFD_MULTI = 0x02, // 317x185
+  DLIST_ASSET_COUNT,
+} DLIST_AssetTypeDef;
+
+typedef enum {
+  DLIST_FONT_MONO_12 = 0x00,
+  DLIST_FONT_MONO_BOLD_16 = 0x01,
+  DLIST_FONT_COUNT,
+} DLIST_FontTypeDef;
+
+typedef enum {
+  DLIST_OK = 0x00,
+  DLIST_BAD_OP, // unknown op or out of range operand
+  DLIST_TRUNCATED, // the list ends inside an op
+  DLIST_FULL, // more primitives or points than fit
+  DLIST_BAD_SLOT,
+  DLIST_NOT_ACTIVE,
+  DLIST_BAD_CRC,
+  DLIST_OUT_OF_ORDER,
+  DLIST_INCOMPLETE,
+} DLIST_StatusTypeDef;
+
+/**
+ * Appends the primitives of the list to the tile list. Text and the list itself are referenced,
+ * both must stay unchanged until the screen is rendered.
+ */
+DLIST_StatusTypeDef DLIST_build(const uint8_t *list, uint32_t size);
+
+/**
+ * Checks every op without drawing, returns the primitive count through primitives
+ */
+DLIST_StatusTypeDef DLIST_check(const uint8_t *list, uint32_t size, uint16_t *primitives);
+
+/**
+ * Upload into a slot, the slot is emptied until DLIST_end accepts the list.
+ * Chunks work like UPLOAD_chunk: in order, CRC_calc over the data, already accepted ones are ignored.
+ */
+DLIST_StatusTypeDef DLIST_begin(uint8_t slot, uint32_t size);
+
+DLIST_StatusTypeDef DLIST_chunk(uint32_t offset, const uint8_t *data, uint8_t size, uint32_t crc);
+
+DLIST_StatusTypeDef DLIST_end(void);
+
+/**
+ * DLIST_build of an uploaded slot, DLIST_BAD_SLOT when it holds no accepted list
+ */
+DLIST_StatusTypeDef DLIST_buildSlot(uint8_t slot);
+
+/**
+ * Size of the list in the slot, 0 when empty
+ */
+uint32_t DLIST_getSize(uint8_t slot);
+
+#endif //LTDC_0_DLIST_H
@@ -0,0 +1,78 @@
+#ifndef LTDC_0_EVENT_H
+#define LTDC_0_EVENT_H
+
+#include "main.h"
+
+typedef enum {
+  EVENT_API_PACKET = 0x00,
+  EVENT_VBLANK = 0x01, // Arg - frame number
+  EVENT_NEC_DECODED = 0x02, // Arg - address << 8 | command
+  EVENT_NEC_REPEAT = 0x03,
+  EVENT_NEC_ERROR = 0x04,
+  EVENT_TYPE_COUNT,
+} EVENT_TypeTypeDef;
+
+/**
+ * Every source posts to its own queue, so each queue has a single producer.
+ * A source must not post from two contexts that can preempt each other.
+ */
+typedef enum {
+  EVENT_SOURCE_API = 0x00, // transport receive, UART interrupt or loopback
+  EVENT_SOURCE_LTDC = 0x01,
+  EVENT_SOURCE_IR = 0x02,
+  EVENT_SOURCE_COUNT,
+} EVENT_SourceTypeDef;
+
+typedef struct EVENT_TypeDef {
+  uint32_t Type; // EVENT_TypeTypeDef
+  uint32_t Arg;
+  uint32_t Timestamp; // cycle counter when posted
+} EVENT_TypeDef;
+
+typedef void (*EVENT_HandlerTypeDef)(const EVENT_TypeDef *event);
+
+/**
+ * Latencies are cycles from posting to the start of the handler
+ */
+typedef struct EVENT_StatsTypeDef {
+  uint32_t Dispatched;
+  uint32_t Dropped;
+  uint32_t LastLatency;
+  uint32_t MinLatency;
+  uint32_t MaxLatency;
+  uint32_t MaxHandler; // longest handler run, cycles
+} EVENT_StatsTypeDef;
+
+/**
+ * Starts the DWT cycle counter used for timestamps, call before any source is enabled
+ */
+void EVENT_init(void);
+
+/**
+ * One handler per event type, events without a handler are discarded
+ */
+void EVENT_subscribe(EVENT_TypeTypeDef type, EVENT_HandlerTypeDef handler);
+
+/**
+ * Safe from interrupts, returns 0 and counts the event as dropped when the queue is full
+ */
+uint8_t EVENT_post(EVENT_SourceTypeDef source, EVENT_TypeTypeDef type, uint32_t arg);
+
+/**
+ * Runs the handlers of all queued events, oldest first per source.
+ * Returns the number of events handled.
+ */
+uint32_t EVENT_dispatch(void);
+
+/**
+ * Sleeps until the next interrupt unless an event is already queued
+ */
+void EVENT_idle(void);
+
+uint32_t EVENT_cycles(void);
+
+EVENT_StatsTypeDef EVENT_getStats(void);
+
+void EVENT_resetStats(void);
+
+#endif //LTDC_0_EVENT_H
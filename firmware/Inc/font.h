@@ -0,0 +1,61 @@
+#ifndef LTDC_0_FONT_H
+#define LTDC_0_FONT_H
+
+#include "main.h"
+
+/**
+ * Bitmap fonts packed by scripts/fonts/fontpack.py. Every glyph is its ink cropped
+ * from a cell of Advance x Height pixels, stored row by row in the atlas,
+ * each row starting on a byte. 1 bpp rows have the first pixel in the top
+ * bit, 4 bpp rows in the high nibble, 15 is full coverage.
+ *
+ * Text is drawn a target row at a time. Glyph rows are expanded into runs
+ * of equal coverage that are filled as spans, so mostly empty or solid
+ * rows cost a few stores per run rather than a test per pixel.
+ */
+typedef enum {
+  FONT_1BPP = 1,
+  FONT_4BPP = 4,
+} FONT_BppTypeDef;
+
+typedef struct FONT_GlyphTypeDef {
+  uint32_t Offset; // first atlas byte
+  uint8_t Width; // ink size, 0 for blank glyphs
+  uint8_t Height;
+  uint8_t Left; // ink position inside the cell
+  uint8_t Top;
+  uint8_t Advance; // cell width
+} FONT_GlyphTypeDef;
+
+typedef struct FONT_TypeDef {
+  const uint8_t *Atlas;
+  const FONT_GlyphTypeDef *Glyphs;
+  uint8_t First; // character code of Glyphs[0]
+  uint8_t Count;
+  uint8_t Default; // glyph index drawn for codes out of range
+  uint8_t Bpp; // FONT_BppTypeDef
+  uint8_t Height; // cell height, the line spacing
+  uint8_t Baseline;
+} FONT_TypeDef;
+
+/**
+ * Width of the text, the sum of the glyph advances
+ */
+uint32_t FONT_measure(const FONT_TypeDef *font, const char *text);
+
+/**
+ * Horizontal range [x1, x2) relative to the text origin that differs between the two texts drawn at the same
+ * position. Glyphs that match keep their cell, past the first glyph of another advance everything up to the end
+ * of the longer text differs. Returns 0 when nothing does.
+ */
+uint8_t FONT_diff(const FONT_TypeDef *font, const char *oldText, const char *newText, uint32_t *x1, uint32_t *x2);
+
+/**
+ * Draws row (0 .. Height - 1) of the text with its origin at x into a row of the target, only pixels in
+ * [clipX1, clipX2) are written. Colors are in the target channel order. Opaque fills the rest of every cell
+ * and of the clip range with background, otherwise 4 bpp edges are blended with the target.
+ */
+void FONT_drawRow(const FONT_TypeDef *font, const char *text, uint16_t row, uint16_t *dst, int32_t x,
+                  int32_t clipX1, int32_t clipX2, uint16_t color, uint16_t background, uint8_t opaque);
+
+#endif //LTDC_0_FONT_H
@@ -0,0 +1,8 @@
+#ifndef LTDC_0_FONT_MONO_12_H
+#define LTDC_0_FONT_MONO_12_H
+
+#include "font.h"
+
+extern const FONT_TypeDef font_mono_12;
+
+#endif //LTDC_0_FONT_MONO_12_H
@@ -0,0 +1,8 @@
+#ifndef LTDC_0_FONT_MONO_BOLD_16_H
+#define LTDC_0_FONT_MONO_BOLD_16_H
+
+#include "font.h"
+
+extern const FONT_TypeDef font_mono_bold_16;
+
+#endif //LTDC_0_FONT_MONO_BOLD_16_H
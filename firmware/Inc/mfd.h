@@ -0,0 +1,95 @@
+#ifndef LTDC_0_MFD_H
+#define LTDC_0_MFD_H
+
+#include "main.h"
+#include "font.h"
+#include "disp.h"
+
+/**
+ * Live instruments over a static background. The screen with the background
+ * is rendered once, afterwards a widget whose value changed only redraws the
+ * part that differs: the needle positions, the bar between the old and the
+ * new level, the readout characters. That part is composed in SRAM from the
+ * background bitmap and the widget and written with a single DMA2D flush,
+ * so SDRAM sees one write per changed pixel and no reads.
+ */
+#define MFD_MAX_WIDGETS 16
+#define MFD_TEXT_LENGTH 12
+
+/**
+ * Two buffers, one is composed while the other is flushed.
+ * Larger regions are drawn in strips of as many rows as fit.
+ */
+#define MFD_BUFFER_PIXELS 4096
+
+typedef enum {
+  MFD_GAUGE, // needle turning around the center of the rect
+  MFD_BAR,
+  MFD_READOUT, // number right aligned in Digits characters
+} MFD_WidgetTypeTypeDef;
+
+typedef struct MFD_WidgetTypeDef {
+  MFD_WidgetTypeTypeDef Type;
+  DISP_RectTypeDef Rect; // relative to the background, nothing is drawn outside
+  int32_t Min;
+  int32_t Max;
+  int32_t Value;
+  int32_t Drawn; // value on screen
+  uint8_t Invalid; // the whole rect is drawn again
+  uint16_t Color;
+  int16_t Start; // gauge angle at Min, degrees clockwise from up
+  int16_t Sweep; // gauge angle from Min to Max
+  uint8_t Vertical; // bar growing upwards, otherwise to the right
+  const FONT_TypeDef *Font;
+  uint8_t Digits;
+  uint8_t Decimals; // readout value in 1 / 10^Decimals units
+  char Shown[MFD_TEXT_LENGTH];
+} MFD_WidgetTypeDef;
+
+typedef struct MFD_StatsTypeDef {
+  uint32_t Redraws; // widget updates drawn
+  uint32_t Pixels; // pixels written to the framebuffer by them
+  uint32_t Cycles; // spent in MFD_tick drawing
+  uint32_t MaxCycles; // longest MFD_tick that drew
+} MFD_StatsTypeDef;
+
+/**
+ * Removes all widgets
+ */
+void MFD_clear(void);
+
+/**
+ * Widgets are numbered in the order they are added, 0 when there is no room left
+ */
+uint8_t MFD_gauge(uint16_t x, uint16_t y, uint16_t width, uint16_t height, int32_t min, int32_t max, int16_t start,
+                  int16_t sweep, uint16_t color);
+
+uint8_t MFD_bar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, int32_t min, int32_t max, uint8_t vertical,
+                uint16_t color);
+
+uint8_t MFD_readout(uint16_t x, uint16_t y, const FONT_TypeDef *font, uint8_t digits, uint8_t decimals, int32_t min,
+                    int32_t max, uint16_t color);
+
+uint8_t MFD_getCount(void);
+
+/**
+ * Records where the background was drawn, NULL for a black one. Every widget is drawn in full
+ * by the next MFD_tick, so call it once the screen with the background has been rendered or queued.
+ */
+void MFD_setBackground(const uint16_t *bitmap, uint16_t width, uint16_t height, uint16_t x, uint16_t y);
+
+/**
+ * Clamped to the widget range, returns 0 for an unknown widget. Safe to call from interrupts.
+ */
+uint8_t MFD_setValue(uint8_t index, int32_t value);
+
+/**
+ * Redraws the widgets that changed, the tile renderer must be idle
+ */
+void MFD_tick(void);
+
+MFD_StatsTypeDef MFD_getStats(void);
+
+void MFD_resetStats(void);
+
+#endif //LTDC_0_MFD_H
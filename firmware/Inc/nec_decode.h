@@ -11,19 +11,30 @@
 #include <stdint.h>
 #include "stm32f4xx_hal.h"
 
+/**
+ * Falling edges are captured continuously into a circular buffer.
+ * The timer resets on every edge, so each capture is the period since the
+ * previous edge in timer ticks (1 us). Half a buffer holds more than the
+ * 34 edges of a frame.
+ */
+#define NEC_BUFFER_SIZE 128
+
 typedef enum {
   NEC_NOT_EXTENDED, NEC_EXTENDED
 } NEC_TYPE;
 
 typedef enum {
-  NEC_INIT, NEC_AGC_OK, NEC_AGC_FAIL, NEC_FAIL, NEC_OK
+  NEC_IDLE, NEC_DATA
 } NEC_STATE;
 
 typedef struct {
-  int rawTimerData[32];
+  uint32_t rawTimerData[NEC_BUFFER_SIZE];
+  uint16_t readPos;
   uint8_t decoded[4];
 
   NEC_STATE state;
+  uint8_t bitCount;
+  uint32_t lastFrameTick; // HAL tick of the last frame or repeat, repeats are only valid right after one
 
   TIM_HandleTypeDef *timerHandle;
 
@@ -41,12 +52,21 @@ typedef struct {
   void (*NEC_RepeatCallback)();
 } NEC;
 
-void NEC_Init(NEC *handle);
-
-void NEC_DeInit(NEC *handle);
-
+/**
+ * Called from the DMA half and full transfer callbacks, so the buffer
+ * never wraps over unread captures.
+ */
 void NEC_TIM_IC_CaptureCallback(NEC *handle);
 
+/**
+ * Starts the continuous capture, once
+ */
 void NEC_Read(NEC *handle);
 
+/**
+ * Decodes the captures received so far, called from the main loop for low latency.
+ * Callbacks run with interrupts masked and must only queue the result.
+ */
+void NEC_Poll(NEC *handle);
+
 #endif /* INC_NEC_DECODE_H_ */
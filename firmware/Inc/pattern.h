@@ -0,0 +1,32 @@
+#ifndef LTDC_0_PATTERN_H
+#define LTDC_0_PATTERN_H
+
+#include "main.h"
+
+/**
+ * Test patterns computed row by row at any resolution, from span fills
+ * and precomputed tables instead of stored bitmaps. Levels follow
+ * RP 219 studio range, 0% is code 16 and 100% code 235.
+ */
+typedef enum {
+  PATTERN_SMPTE_BARS = 0x00, // RP 219 style
+  PATTERN_CIRCLE_CHART = 0x01, // PM5544 like
+  PATTERN_MULTIBURST = 0x02,
+  PATTERN_LUMA_RAMP = 0x03, // ramp over a staircase
+  PATTERN_PLUGE = 0x04,
+  PATTERN_CROSSHATCH = 0x05,
+  PATTERN_CHECKERBOARD = 0x06,
+  PATTERN_ZONE_PLATE = 0x07,
+  PATTERN_COUNT,
+} PATTERN_TypeDef;
+
+// Widest row the row cache holds, wider rows are always computed
+#define PATTERN_MAX_WIDTH 1024
+
+/**
+ * Writes row y of a width x height pattern, pixels in framebuffer order (red and blue swapped).
+ * Every pixel of the row is written.
+ */
+void PATTERN_drawRow(PATTERN_TypeDef pattern, uint16_t *row, uint16_t y, uint16_t width, uint16_t height);
+
+#endif //LTDC_0_PATTERN_H
@@ -1,4 +0,0 @@
-#include "stm32f4xx_hal.h"
-
-void init_philips_pm5544_320_240(void);
-uint16_t* get_philips_pm5544_320_240(void);
@@ -0,0 +1,92 @@
+#ifndef LTDC_0_PIXEL_H
+#define LTDC_0_PIXEL_H
+
+#include "main.h"
+
+/**
+ * RGB565 row kernels. On the Cortex-M4 they process two pixels per
+ * 32 bit word with the DSP SIMD instructions, the Ref versions are
+ * the portable C definition every kernel is bit exact with, one pixel
+ * at a time. Rows may have any length and alignment.
+ */
+typedef enum {
+  PIXEL_KERNEL_SWAP = 0x00,
+  PIXEL_KERNEL_BLEND = 0x01,
+  PIXEL_KERNEL_SCALE = 0x02,
+  PIXEL_KERNEL_COLOR_KEY = 0x03,
+  PIXEL_KERNEL_CONVERT = 0x04,
+  PIXEL_KERNEL_BLEND_ARGB4444 = 0x05,
+  PIXEL_KERNEL_BLEND_ARGB8888 = 0x06,
+  PIXEL_KERNEL_COUNT,
+} PIXEL_KernelTypeDef;
+
+/**
+ * RGB565 spread to 0x07E0F81F, every channel has 5 spare bits above it so one multiply
+ * weights all three by up to 32. PIXEL_ROUNDING is half of that weight under each channel.
+ */
+#define PIXEL_SPREAD_MASK 0x07E0F81FU
+#define PIXEL_SPREAD(c) (((uint32_t) (c) | ((uint32_t) (c) << 16)) & PIXEL_SPREAD_MASK)
+#define PIXEL_PACK(v) ((uint16_t) (((v) & PIXEL_SPREAD_MASK) | (((v) & PIXEL_SPREAD_MASK) >> 16)))
+#define PIXEL_ROUNDING (0x10U | 0x10U << 11 | 0x10U << 21)
+
+/**
+ * Row length PIXEL_check runs the kernels on
+ */
+#define PIXEL_CHECK_PIXELS 320
+
+/**
+ * Red and blue swapped, the conversion between asset and framebuffer order
+ */
+void PIXEL_swap(uint16_t *dst, const uint16_t *src, uint32_t count);
+
+void PIXEL_swapRef(uint16_t *dst, const uint16_t *src, uint32_t count);
+
+/**
+ * a over b at constant alpha, 0 is all b and 255 all a. The weight is rounded
+ * to 5 bits and every channel to nearest.
+ */
+void PIXEL_blend(uint16_t *dst, const uint16_t *a, const uint16_t *b, uint8_t alpha, uint32_t count);
+
+void PIXEL_blendRef(uint16_t *dst, const uint16_t *a, const uint16_t *b, uint8_t alpha, uint32_t count);
+
+/**
+ * Every channel multiplied by factor / 256 and rounded, 256 keeps the row as is
+ */
+void PIXEL_scale(uint16_t *dst, const uint16_t *src, uint16_t factor, uint32_t count);
+
+void PIXEL_scaleRef(uint16_t *dst, const uint16_t *src, uint16_t factor, uint32_t count);
+
+/**
+ * Copies the source pixels that are not key, dst keeps its pixel where the source is key
+ */
+void PIXEL_colorKey(uint16_t *dst, const uint16_t *src, uint16_t key, uint32_t count);
+
+void PIXEL_colorKeyRef(uint16_t *dst, const uint16_t *src, uint16_t key, uint32_t count);
+
+/**
+ * ARGB8888 to RGB565 in framebuffer order (red and blue swapped), alpha is dropped
+ */
+void PIXEL_convert(uint16_t *dst, const uint32_t *src, uint32_t count);
+
+void PIXEL_convertRef(uint16_t *dst, const uint32_t *src, uint32_t count);
+
+/**
+ * Per pixel alpha source over dst, the source alpha is multiplied by the constant alpha first.
+ * Sources are in framebuffer channel order like dst, ARGB4444 as A, blue, green, red nibbles from the top
+ * and ARGB8888 as 0xAABBGGRR. Channels are truncated to RGB565 before the blend.
+ */
+void PIXEL_blendArgb4444(uint16_t *dst, const uint16_t *src, uint8_t alpha, uint32_t count);
+
+void PIXEL_blendArgb4444Ref(uint16_t *dst, const uint16_t *src, uint8_t alpha, uint32_t count);
+
+void PIXEL_blendArgb8888(uint16_t *dst, const uint32_t *src, uint8_t alpha, uint32_t count);
+
+void PIXEL_blendArgb8888Ref(uint16_t *dst, const uint32_t *src, uint8_t alpha, uint32_t count);
+
+/**
+ * Runs a kernel and its reference on the same pseudo random rows of PIXEL_CHECK_PIXELS,
+ * returns 1 when every output pixel matches. Cycles are taken over the aligned row.
+ */
+uint8_t PIXEL_check(PIXEL_KernelTypeDef kernel, uint32_t *refCycles, uint32_t *simdCycles);
+
+#endif //LTDC_0_PIXEL_H
@@ -0,0 +1,86 @@
+#ifndef LTDC_0_RASTER_H
+#define LTDC_0_RASTER_H
+
+#include "main.h"
+
+/**
+ * Per-scanline raster effects. A table of entries reprograms the LTDC
+ * background color and the layer constant alpha from line events while
+ * the frame is scanned out. With the layer hidden the background is all
+ * that is shown, so ramps and bands need no framebuffer bandwidth.
+ *
+ * Tables are built in the back buffer and take effect at the next vblank.
+ */
+#define RASTER_MAX_ENTRIES 640
+
+// Bands that fit one packet
+#define RASTER_MAX_BANDS 14
+
+#define RASTER_ALPHA_OPAQUE 0xFF
+
+typedef enum {
+  RASTER_NONE = 0x00,
+  RASTER_RAMP = 0x01,
+  RASTER_BANDS = 0x02,
+  RASTER_FADE = 0x03,
+} RASTER_EffectTypeDef;
+
+typedef struct RASTER_EntryTypeDef {
+  uint16_t Row; // image row, entries are kept in row order
+  uint8_t SetAlpha;
+  uint8_t Alpha;
+  uint32_t Background; // RGB888
+} RASTER_EntryTypeDef;
+
+/**
+ * Latencies are pixel clocks from the start of the line to the register write,
+ * late entries were written on a later line than their own.
+ */
+typedef struct RASTER_StatsTypeDef {
+  uint32_t Applied;
+  uint32_t Late;
+  uint32_t LastLatency;
+  uint32_t MinLatency;
+  uint32_t MaxLatency;
+} RASTER_StatsTypeDef;
+
+/**
+ * Starts a new table, the frame begins with background and alpha
+ */
+void RASTER_begin(uint32_t background, uint8_t alpha, uint8_t hideLayer);
+
+/**
+ * Rows must not decrease, returns 0 when the table is full or the row is out of order
+ */
+uint8_t RASTER_add(uint16_t row, uint32_t background, uint8_t setAlpha, uint8_t alpha);
+
+/**
+ * The table is shown from the next frame on
+ */
+void RASTER_commit(void);
+
+/**
+ * Empty table, the layer shown as usual over a black background
+ */
+void RASTER_clear(void);
+
+/**
+ * Vertical gradient from the first to the last image row, RGB888
+ */
+uint8_t RASTER_ramp(uint32_t from, uint32_t to, uint8_t hideLayer);
+
+/**
+ * Layer alpha stepped from the first to the last image row over a fixed background
+ */
+uint8_t RASTER_fade(uint32_t background, uint8_t from, uint8_t to);
+
+/**
+ * Horizontal bands of equal height, top to bottom
+ */
+uint8_t RASTER_bands(const uint32_t *colors, uint8_t count, uint8_t hideLayer);
+
+RASTER_StatsTypeDef RASTER_getStats(void);
+
+void RASTER_resetStats(void);
+
+#endif //LTDC_0_RASTER_H
@@ -0,0 +1,76 @@
+#ifndef LTDC_0_RENDER_H
+#define LTDC_0_RENDER_H
+
+#include "main.h"
+
+/**
+ * Main loop time spent rendering per RENDER_tick, so packets and IR codes
+ * are handled at least this often while a screen is drawn.
+ */
+#define RENDER_BUDGET_US 2000
+
+#define RENDER_QUEUE_SIZE 4
+
+typedef struct RENDER_JobTypeDef RENDER_JobTypeDef;
+
+/**
+ * Draws one bounded unit of work, usually a row, returns 1 once the job is complete
+ */
+typedef uint8_t (*RENDER_StepTypeDef)(RENDER_JobTypeDef *job);
+
+struct RENDER_JobTypeDef {
+  RENDER_StepTypeDef Step;
+  uint32_t Progress; // units done, 0 when the job starts
+  uint16_t Index; // sub-job counter for jobs made of several shapes
+  uint16_t Color;
+  uint16_t X1;
+  uint16_t Y1;
+  uint16_t X2;
+  uint16_t Y2;
+  uint16_t *Bitmap;
+  uint16_t Width;
+  uint16_t Height;
+  uint8_t Tile;
+  uint8_t Center;
+  uint16_t Param; // job specific, the step of nested rects
+  void *Context;
+};
+
+/**
+ * Drops all queued jobs, the one in progress is abandoned between units
+ */
+void RENDER_cancel(void);
+
+/**
+ * Jobs run in the order they were queued, returns 0 when the queue is full
+ */
+uint8_t RENDER_push(const RENDER_JobTypeDef *job);
+
+uint8_t RENDER_fill(uint16_t color);
+
+uint8_t RENDER_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
+
+/**
+ * Same as DISP_drawRects
+ */
+uint8_t RENDER_nestedRects(uint16_t w, uint16_t h, uint8_t step);
+
+/**
+ * Same as DISP_DrawBitmap
+ */
+uint8_t RENDER_bitmap(uint16_t *bitmap, uint16_t width, uint16_t height, uint8_t tile, uint8_t center);
+
+/**
+ * Composes the TILE_ primitive list band by band, the list must not change until the job is done
+ */
+uint8_t RENDER_tiles(void);
+
+/**
+ * Runs job units until the budget is used up or the queue is empty.
+ * While throttled it yields during active video instead of waiting.
+ */
+void RENDER_tick(uint32_t budgetUs);
+
+uint8_t RENDER_isIdle(void);
+
+#endif //LTDC_0_RENDER_H
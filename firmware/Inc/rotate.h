@@ -0,0 +1,35 @@
+#ifndef LTDC_0_ROTATE_H
+#define LTDC_0_ROTATE_H
+
+#include "main.h"
+
+/**
+ * Quarter turn bitmap rotation. Pixels are copied in ROTATE_BLOCK square
+ * blocks, so a 90 or 270 degree turn reads a few source rows at a time
+ * instead of striding down a whole column, and writes short runs of
+ * consecutive destination pixels.
+ */
+typedef enum {
+  ROTATE_0 = 0x00,
+  ROTATE_90 = 0x01, // clockwise
+  ROTATE_180 = 0x02,
+  ROTATE_270 = 0x03,
+} ROTATE_AngleTypeDef;
+
+#define ROTATE_BLOCK 16
+
+/**
+ * Size of a srcWidth x srcHeight bitmap once rotated
+ */
+void ROTATE_getSize(uint16_t srcWidth, uint16_t srcHeight, ROTATE_AngleTypeDef angle, uint16_t *width,
+                    uint16_t *height);
+
+/**
+ * Copies the width x height region at x, y of the rotated bitmap to dst, rows dstStride pixels apart,
+ * pixels in framebuffer order (red and blue swapped). Mirror flips the source horizontally before the turn.
+ */
+void ROTATE_copy(const uint16_t *src, uint16_t srcWidth, uint16_t srcHeight, ROTATE_AngleTypeDef angle,
+                 uint8_t mirror, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t *dst,
+                 uint32_t dstStride);
+
+#endif //LTDC_0_ROTATE_H
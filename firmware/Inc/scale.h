@@ -0,0 +1,33 @@
+#ifndef LTDC_0_SCALE_H
+#define LTDC_0_SCALE_H
+
+#include "main.h"
+
+/**
+ * Bitmap scaling to any destination size in 16.16 fixed point.
+ * Source columns and weights are computed once per size into tables,
+ * rows are then produced one at a time and a row is only recomputed
+ * when it samples different source rows than the previous one.
+ */
+typedef enum {
+  SCALE_NEAREST = 0x00,
+  SCALE_BILINEAR = 0x01,
+} SCALE_FilterTypeDef;
+
+// Widest source and destination row
+#define SCALE_MAX_WIDTH 1024
+
+/**
+ * Selects the bitmap and sizes the following rows are scaled with, returns 0 when a size is out of range.
+ * Cheap when nothing changed, the tables and the last row are kept.
+ */
+uint8_t SCALE_begin(const uint16_t *bitmap, uint16_t srcWidth, uint16_t srcHeight, uint16_t dstWidth,
+                    uint16_t dstHeight, SCALE_FilterTypeDef filter);
+
+/**
+ * Row y of the scaled bitmap, dstWidth pixels in framebuffer order (red and blue swapped).
+ * Valid until the next SCALE_ call, and only after a successful SCALE_begin.
+ */
+const uint16_t *SCALE_getRow(uint16_t y);
+
+#endif //LTDC_0_SCALE_H
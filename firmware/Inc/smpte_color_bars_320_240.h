@@ -1,4 +0,0 @@
-#include "stm32f4xx_hal.h"
-
-void init_smpte_color_bars_320_240(void);
-uint16_t* get_smpte_color_bars_320_240(void);
@@ -0,0 +1,42 @@
+#ifndef LTDC_0_SPSC_H
+#define LTDC_0_SPSC_H
+
+#include "main.h"
+
+/**
+ * Lock-free single-producer/single-consumer queue of fixed size items.
+ * Only the producer moves Head and only the consumer moves Tail, so an
+ * interrupt can feed the main loop without masking interrupts.
+ * One slot is kept free to tell a full queue from an empty one.
+ */
+typedef struct SPSC_QueueTypeDef {
+  uint8_t *Buffer;
+  uint16_t ItemSize;
+  uint16_t Size;
+  volatile uint16_t Head;
+  volatile uint16_t Tail;
+} SPSC_QueueTypeDef;
+
+#define SPSC_QUEUE_INIT(buffer, itemSize, size) {(uint8_t *) (buffer), (itemSize), (size), 0, 0}
+
+/**
+ * Producer: slot to fill in place, NULL when full. The slot is published by SPSC_commit.
+ */
+void *SPSC_acquire(SPSC_QueueTypeDef *queue);
+
+void SPSC_commit(SPSC_QueueTypeDef *queue);
+
+uint8_t SPSC_push(SPSC_QueueTypeDef *queue, const void *item);
+
+/**
+ * Consumer: oldest item, NULL when empty. The slot is handed back by SPSC_release.
+ */
+void *SPSC_front(SPSC_QueueTypeDef *queue);
+
+void SPSC_release(SPSC_QueueTypeDef *queue);
+
+uint8_t SPSC_pop(SPSC_QueueTypeDef *queue, void *item);
+
+uint8_t SPSC_isEmpty(const SPSC_QueueTypeDef *queue);
+
+#endif //LTDC_0_SPSC_H
@@ -0,0 +1,195 @@
+#ifndef LTDC_0_TILE_H
+#define LTDC_0_TILE_H
+
+#include "main.h"
+#include "font.h"
+#include "vector.h"
+
+/**
+ * A screen is described as a list of primitives and composed a band of
+ * lines at a time in internal SRAM, each band is then copied to the
+ * framebuffer by DMA2D. Overdraw happens at SRAM speed and SDRAM sees
+ * a single burst write per pixel.
+ *
+ * There are two band buffers, one is composed while the other is flushed.
+ * The band height is as many lines as fit TILE_BUFFER_PIXELS.
+ * CCM RAM is not reachable by DMA2D, so the buffers are in main SRAM.
+ */
+#define TILE_BUFFER_PIXELS 16384
+
+#define TILE_MAX_PRIMITIVES 128
+
+typedef enum {
+  TILE_FILL,
+  TILE_FRAMEBUFFER,
+  TILE_RECT,
+  TILE_NESTED_RECTS,
+  TILE_BITMAP,
+  TILE_PATTERN,
+  TILE_BITMAP_SCALED,
+  TILE_BITMAP_ROTATED,
+  TILE_BITMAP_BLEND,
+  TILE_TEXT,
+  TILE_LINE,
+  TILE_CIRCLE,
+  TILE_POLYGON,
+} TILE_PrimitiveTypeTypeDef;
+
+typedef struct TILE_PrimitiveTypeDef {
+  TILE_PrimitiveTypeTypeDef Type;
+  uint16_t Color;
+  uint16_t X1;
+  uint16_t Y1;
+  uint16_t X2;
+  uint16_t Y2;
+  uint16_t *Bitmap;
+  uint16_t Width;
+  uint16_t Height;
+  uint8_t Tile;
+  uint8_t Center;
+  uint8_t Step;
+  uint8_t Pattern; // PATTERN_TypeDef
+  uint8_t Filter; // SCALE_FilterTypeDef
+  uint8_t Rotation; // ROTATE_AngleTypeDef
+  uint8_t Mirror;
+  uint8_t Format; // BLEND_FormatTypeDef
+  uint8_t Alpha;
+  const FONT_TypeDef *Font;
+  const char *Text;
+  uint16_t Background;
+  uint8_t Opaque;
+  VECTOR_PointTypeDef Start; // line ends or circle center, may lie outside the screen
+  VECTOR_PointTypeDef End;
+  uint16_t Radius;
+  uint8_t Filled;
+  const VECTOR_PointTypeDef *Points;
+  uint8_t PointCount;
+} TILE_PrimitiveTypeDef;
+
+void TILE_init(void);
+
+/**
+ * Empties the primitive list, primitives are drawn in the order they were added.
+ * Band buffers are not cleared, the first primitive should be TILE_fill, TILE_pattern or TILE_framebuffer.
+ */
+void TILE_clear(void);
+
+/**
+ * Functions below return 0 when the list is full
+ */
+uint8_t TILE_fill(uint16_t color);
+
+/**
+ * Starts from the current framebuffer contents, for drawing over the previous screen
+ */
+uint8_t TILE_framebuffer(void);
+
+uint8_t TILE_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
+
+/**
+ * Same as DISP_drawRects
+ */
+uint8_t TILE_nestedRects(uint16_t w, uint16_t h, uint8_t step);
+
+/**
+ * Same as DISP_DrawBitmap
+ */
+uint8_t TILE_bitmap(uint16_t *bitmap, uint16_t width, uint16_t height, uint8_t tile, uint8_t center);
+
+/**
+ * Same as DISP_DrawBitmapScaled, the bitmap is scaled into the rect at x, y of width x height
+ */
+uint8_t TILE_bitmapScaled(uint16_t *bitmap, uint16_t srcWidth, uint16_t srcHeight, uint16_t x, uint16_t y,
+                          uint16_t width, uint16_t height, uint8_t filter);
+
+/**
+ * Same as DISP_DrawBitmapRotated
+ */
+uint8_t TILE_bitmapRotated(uint16_t *bitmap, uint16_t width, uint16_t height, uint16_t x, uint16_t y,
+                           uint8_t rotation, uint8_t mirror);
+
+/**
+ * Same as DISP_DrawBitmapBlend, blended on the CPU while the other band is flushed
+ */
+uint8_t TILE_bitmapBlend(const void *bitmap, uint8_t format, uint16_t width, uint16_t height, uint16_t x,
+                         uint16_t y, uint8_t alpha);
+
+/**
+ * Same as DISP_DrawString, the text is not copied and must not change until the screen is rendered
+ */
+uint8_t TILE_text(const FONT_TypeDef *font, const char *text, uint16_t x, uint16_t y, uint16_t color,
+                  uint16_t background, uint8_t opaque);
+
+/**
+ * Same as DISP_DrawLine
+ */
+uint8_t TILE_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t width, uint16_t color);
+
+/**
+ * Same as DISP_DrawCircle or DISP_FillCircle
+ */
+uint8_t TILE_circle(int16_t cx, int16_t cy, uint16_t radius, uint8_t filled, uint16_t color);
+
+/**
+ * Same as DISP_FillPolygon, the points are not copied and must not change until the screen is rendered
+ */
+uint8_t TILE_polygon(const VECTOR_PointTypeDef *points, uint8_t count, uint16_t color);
+
+/**
+ * Procedural test pattern at the screen resolution, covers the whole screen
+ */
+uint8_t TILE_pattern(uint8_t pattern);
+
+/**
+ * TILE_pattern scrolled up by offset rows, the rows scrolled out come back at the bottom
+ */
+uint8_t TILE_patternScrolled(uint8_t pattern, uint16_t offset);
+
+/**
+ * Bands the current screen is split into
+ */
+uint16_t TILE_getCount(void);
+
+/**
+ * Composes band index and starts its flush, returns without waiting for it.
+ * Waits for the previous flush first, and in beam mode for the beam to pass the band.
+ */
+HAL_StatusTypeDef TILE_render(uint16_t index);
+
+/**
+ * TILE_render in two steps, band index is composed by TILE_prepare and flushed by TILE_commit
+ */
+HAL_StatusTypeDef TILE_prepare(uint16_t index);
+
+HAL_StatusTypeDef TILE_commit(void);
+
+/**
+ * Flushes a width x height block of pixels in framebuffer order to x, y of the screen, rows of src are
+ * contiguous. Used to update part of a finished screen, src is not rewritten before TILE_wait.
+ * Waits for the previous flush first, returns without waiting for this one.
+ */
+HAL_StatusTypeDef TILE_flushRect(const uint16_t *src, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+/**
+ * Whether the beam has already scanned out every row of the prepared band in the current frame.
+ * A flush started then ends long before the next frame reaches the band, so it does not tear.
+ * Always true while drawing to a page that is not shown.
+ */
+uint8_t TILE_isBehindBeam(void);
+
+/**
+ * Behind the beam mode, bands are only flushed once the beam has passed them.
+ * Tear-free updates of the shown page without a second page.
+ */
+void TILE_setBeamMode(uint8_t enabled);
+
+uint8_t TILE_getBeamMode(void);
+
+HAL_StatusTypeDef TILE_renderAll(void);
+
+/**
+ * Waits for the flush in progress, if any
+ */
+HAL_StatusTypeDef TILE_wait(void);
+
+#endif //LTDC_0_TILE_H
@@ -0,0 +1,80 @@
+#ifndef LTDC_0_UPLOAD_H
+#define LTDC_0_UPLOAD_H
+
+#include "main.h"
+
+/**
+ * Encoded frame stream, pixels are little endian RGB565.
+ *
+ * RAW - plain pixels, row by row.
+ * RLE and DELTA - a sequence of ops, each starting with an op byte:
+ *   [7..6] op, [5] extended count, [4..0] count low bits
+ *   extended count adds a byte with bits [12..5], count is stored minus one (1..8192)
+ *   LITERAL - followed by count pixels
+ *   RUN - followed by one pixel repeated count times
+ *   SKIP - count pixels are taken from the page that was shown when the
+ *          upload started, DELTA only
+ */
+typedef enum {
+  UPLOAD_ENCODING_RAW = 0x00,
+  UPLOAD_ENCODING_RLE = 0x01,
+  UPLOAD_ENCODING_DELTA = 0x02,
+} UPLOAD_EncodingTypeDef;
+
+typedef enum {
+  UPLOAD_OP_LITERAL = 0x00,
+  UPLOAD_OP_RUN = 0x01,
+  UPLOAD_OP_SKIP = 0x02,
+} UPLOAD_OpTypeDef;
+
+typedef enum {
+  UPLOAD_STATE_IDLE = 0x00,
+  UPLOAD_STATE_ACTIVE = 0x01,
+  UPLOAD_STATE_DONE = 0x02,
+  UPLOAD_STATE_ERROR = 0x03,
+} UPLOAD_StateTypeDef;
+
+typedef enum {
+  UPLOAD_OK = 0x00,
+  UPLOAD_BAD_HEADER,
+  UPLOAD_NOT_ACTIVE,
+  UPLOAD_BAD_CRC,
+  UPLOAD_OUT_OF_ORDER,
+  UPLOAD_BAD_DATA,
+  UPLOAD_INCOMPLETE,
+} UPLOAD_StatusTypeDef;
+
+typedef struct UPLOAD_HeaderTypeDef {
+  uint8_t Page; // any but the shown one
+  uint8_t Encoding; // UPLOAD_EncodingTypeDef
+  uint8_t Show; // show the page at the next vblank after UPLOAD_end
+  uint16_t X;
+  uint16_t Y;
+  uint16_t Width;
+  uint16_t Height;
+  uint32_t Size; // encoded stream size in bytes
+} UPLOAD_HeaderTypeDef;
+
+typedef struct UPLOAD_InfoTypeDef {
+  uint8_t State; // UPLOAD_StateTypeDef
+  uint8_t Page;
+  uint32_t Offset; // encoded bytes accepted so far, the host resumes from here
+  uint32_t Size;
+  uint32_t Pixels; // pixels written so far
+  uint8_t Show;
+} UPLOAD_InfoTypeDef;
+
+UPLOAD_StatusTypeDef UPLOAD_begin(const UPLOAD_HeaderTypeDef *header);
+
+/**
+ * Chunks must arrive in order, each one protected by CRC_calc over its data.
+ * Chunks that were already accepted are ignored, so the host can
+ * resend from any point at or before the current offset.
+ */
+UPLOAD_StatusTypeDef UPLOAD_chunk(uint32_t offset, const uint8_t *data, uint8_t size, uint32_t crc);
+
+UPLOAD_StatusTypeDef UPLOAD_end(void);
+
+UPLOAD_InfoTypeDef UPLOAD_getInfo(void);
+
+#endif //LTDC_0_UPLOAD_H
@@ -0,0 +1,66 @@
+#ifndef LTDC_0_VECTOR_H
+#define LTDC_0_VECTOR_H
+
+#include "main.h"
+
+/**
+ * Integer rasterizers writing horizontal spans into a target, either the
+ * framebuffer or a tile band. Coordinates are pixel centers and may lie
+ * outside the target, everything is clipped to its window.
+ */
+#define VECTOR_MAX_POINTS 32
+
+/**
+ * Polygon vertices, thick line ends and widths are clamped to +-VECTOR_GUARD pixels so their 16.16
+ * differences fit in 32 bits, shapes reaching further out than that are distorted
+ */
+#define VECTOR_GUARD 8192
+
+typedef struct VECTOR_PointTypeDef {
+  int16_t X;
+  int16_t Y;
+} VECTOR_PointTypeDef;
+
+/**
+ * Buffer holds the rows of the window, row Y1 first. Colors are in the target channel order.
+ */
+typedef struct VECTOR_TargetTypeDef {
+  uint16_t *Buffer;
+  uint16_t Stride; // pixels from one buffer row to the next
+  int32_t X1; // window, inclusive
+  int32_t Y1;
+  int32_t X2;
+  int32_t Y2;
+} VECTOR_TargetTypeDef;
+
+/**
+ * Fills [x1, x2] of row y, the ends in any order
+ */
+void VECTOR_span(const VECTOR_TargetTypeDef *target, int32_t y, int32_t x1, int32_t x2, uint16_t color);
+
+/**
+ * Bresenham line including both ends, runs on a row are written as one span
+ */
+void VECTOR_line(const VECTOR_TargetTypeDef *target, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                 uint16_t color);
+
+/**
+ * Line of width pixels as a quad extended by half a pixel past both ends, width 1 or less is VECTOR_line
+ */
+void VECTOR_thickLine(const VECTOR_TargetTypeDef *target, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                      uint16_t width, uint16_t color);
+
+/**
+ * Midpoint circle, the outline or filled with one span per row
+ */
+void VECTOR_circle(const VECTOR_TargetTypeDef *target, int32_t cx, int32_t cy, uint16_t radius, uint8_t filled,
+                   uint16_t color);
+
+/**
+ * Even-odd scanline fill of up to VECTOR_MAX_POINTS vertices. A pixel is set when its center is inside,
+ * centers on the right or bottom edge are not, so polygons sharing an edge do not overlap.
+ */
+void VECTOR_polygon(const VECTOR_TargetTypeDef *target, const VECTOR_PointTypeDef *points, uint8_t count,
+                    uint16_t color);
+
+#endif //LTDC_0_VECTOR_H
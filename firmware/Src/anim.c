@@ -0,0 +1,98 @@
+#include <string.h>
+#include "anim.h"
+#include "disp.h"
+#include "event.h"
+
+static ANIM_UpdateTypeDef running = NULL;
+static uint32_t requestedBudgetUs = 0;
+static uint32_t lastFrame;
+static uint8_t started = 0;
+
+static ANIM_StatsTypeDef stats;
+
+void ANIM_start(ANIM_UpdateTypeDef update, uint32_t budgetUs) {
+  running = update;
+  requestedBudgetUs = budgetUs;
+  lastFrame = DISP_getFrameCount();
+  started = 0;
+}
+
+void ANIM_stop(void) {
+  running = NULL;
+}
+
+uint8_t ANIM_isRunning(void) {
+  return running != NULL;
+}
+
+/**
+ * Follows the config, the frame period changes with the timings
+ */
+static uint32_t ANIM_getBudget(void) {
+  uint32_t us = requestedBudgetUs ? requestedBudgetUs : DISP_getFramePeriodUs();
+  return us * (SystemCoreClock / 1000000U);
+}
+
+/**
+ * Frame time is counted from the vblank to the end of the update, a frame done
+ * later than the budget was not ready when the next one started.
+ */
+static void ANIM_record(uint32_t latency, uint32_t cycles, uint8_t late) {
+  uint32_t frameTime = latency + cycles;
+
+  stats.Updates++;
+  stats.LastCycles = cycles;
+  if (cycles > stats.MaxCycles) {
+    stats.MaxCycles = cycles;
+  }
+  if (latency > stats.MaxLatency) {
+    stats.MaxLatency = latency;
+  }
+  if (late || frameTime > stats.Budget) {
+    stats.Overruns++;
+  }
+
+  uint32_t bin = stats.Budget ? (uint32_t) ((uint64_t) frameTime * ANIM_HISTOGRAM_SCALE / stats.Budget) : 0;
+  if (bin >= ANIM_HISTOGRAM_BINS) {
+    bin = ANIM_HISTOGRAM_BINS - 1;
+  }
+  if (stats.Histogram[bin] < UINT16_MAX) {
+    stats.Histogram[bin]++;
+  }
+}
+
+void ANIM_tick(void) {
+  uint32_t frame = DISP_getFrameCount();
+  if (running == NULL || frame == lastFrame) {
+    return;
+  }
+
+  uint32_t start = EVENT_cycles();
+  uint32_t vblank = DISP_getVblankCycles();
+  // Another vblank may have come in between
+  if (DISP_getFrameCount() != frame) {
+    frame = DISP_getFrameCount();
+    vblank = DISP_getVblankCycles();
+    start = EVENT_cycles();
+  }
+
+  // Frames before the first update went to setting up the screen, they are not missed
+  uint32_t frames = started ? frame - lastFrame : 1;
+  stats.Missed += frames - 1;
+  started = 1;
+  stats.Budget = ANIM_getBudget();
+  lastFrame = frame;
+
+  running(frame, frames);
+
+  uint32_t cycles = EVENT_cycles() - start;
+  ANIM_record(start - vblank, cycles, DISP_getFrameCount() != frame);
+}
+
+ANIM_StatsTypeDef ANIM_getStats(void) {
+  return stats;
+}
+
+void ANIM_resetStats(void) {
+  memset(&stats, 0, sizeof(stats));
+}
@@ -1,17 +1,142 @@
+#include <string.h>
 #include "api.h"
 #include "debug_screen.h"
 #include "disp.h"
+#include "sdram.h"
 #include "adv7393.h"
+#include "upload.h"
+#include "capture.h"
+#include "crc.h"
+#include "bandwidth.h"
+#include "spsc.h"
+#include "event.h"
+#include "tile.h"
+#include "raster.h"
+#include "render.h"
+#include "pattern.h"
+#include "rotate.h"
+#include "picture.h"
+#include "pixel.h"
+#include "blend.h"
+#include "dlist.h"
+#include "mfd.h"
+#include "anim.h"
 
 #define PACKET_SIZE 64
 
-static uint8_t rxBuffer[PACKET_SIZE];
+/**
+ * Packet layout (both directions):
+ * [0] - command / data type
+ * [1] - payload size
+ * [2..61] - payload
+ * [62] - sequence id, echoed back in every reply to the packet
+ * [63] - crc
+ */
+#define PAYLOAD_OFFSET 2
+#define PAYLOAD_MAX_SIZE (PACKET_SIZE - 4)
+#define SEQ_OFFSET (PACKET_SIZE - 2)
+
+/**
+ * Received packets are queued so the host can keep several commands in flight.
+ * Bytes arriving while the queue is full are dropped packet-wise.
+ */
+#define RX_QUEUE_SIZE 8
+
+/**
+ * A packet still incomplete after the line was idle this long is dropped, the host
+ * writes a packet at once. Shorter gaps come from USB bridges splitting it across frames.
+ */
+#define RX_RESYNC_MS 5
+#define BATCH_MAX_SIZE 16
+
+/**
+ * Screenshot data is sent from API_Tick, a few packets at a time
+ * so the main loop keeps running during long captures.
+ */
+#define SCREENSHOT_PACKETS_PER_TICK 4
+
+/**
+ * BENCH_BLEND builds its overlay in the SDRAM above the display list slots,
+ * which follow the framebuffer pages, so no page content is lost
+ */
+#define BENCH_SCRATCH_OFFSET (DISP_PAGE_COUNT * DISP_PAGE_SIZE + DLIST_SLOTS * DLIST_SLOT_SIZE)
+#define BENCH_SCRATCH_ADDR (SDRAM_BANK_ADDR + BENCH_SCRATCH_OFFSET)
+#define BENCH_SCRATCH_SIZE (SDRAM_BANK_SIZE - BENCH_SCRATCH_OFFSET)
+
+/**
+ * Scheduled commands run in the order they were scheduled, an entry due earlier waits
+ * for the ones queued before it. Results are sent from API_Tick.
+ */
+#define DEFER_QUEUE_SIZE 8
+
+/**
+ * Frames ahead of its due frame a screen switch starts rendering. The shown screen
+ * stops updating meanwhile, a switch that takes longer is shown late.
+ */
+#define DEFER_PREPARE_FRAMES 3
+
+/**
+ * Where a due command runs. The vblank callback only latches what is cheap and atomic,
+ * anything talking I2C or touching the screen state is left to the main loop.
+ */
+typedef enum {
+  DEFER_VBLANK, // page address, shadow registers, flags and widget values, in the due frame
+  DEFER_MAIN, // from API_Tick once due, stamped with the frame it ran in
+  DEFER_SCREEN, // rendered shortly ahead by the main loop, flipped to from the vblank callback
+} API_DeferKindTypeDef;
+
+typedef struct API_DeferredTypeDef {
+  uint8_t Packet[PACKET_SIZE]; // the wrapped command, with the sequence id of the SCHEDULE packet
+  uint32_t Frame;
+  uint32_t ExecutedFrame;
+  uint8_t Status;
+  volatile uint8_t Prepared; // DEFER_SCREEN, DEBUG_SCREEN_prepare was called for it
+} API_DeferredTypeDef;
+
+static uint8_t rxBuffer[RX_QUEUE_SIZE][PACKET_SIZE];
+static SPSC_QueueTypeDef rxQueue = SPSC_QUEUE_INIT(rxBuffer, PACKET_SIZE, RX_QUEUE_SIZE);
+static uint8_t *rxSlot = NULL; // NULL while dropping the current packet
+static uint8_t rxOffset = 0;
+static uint32_t rxTick = 0; // last bytes received
+
 static uint8_t txBuffer[PACKET_SIZE];
-static UART_HandleTypeDef *uartHandle;
+static const API_TransportTypeDef *transport;
+
+static uint8_t currentSeq = 0;
+
+static uint8_t batchPackets[BATCH_MAX_SIZE][PACKET_SIZE];
+static uint8_t batchSize = 0;
+static uint8_t batchOpen = 0;
+static uint8_t batchOverflow = 0;
+
+static uint8_t screenshotSeq = 0;
+static uint32_t screenshotOffset = 0;
+static uint32_t screenshotCrc = 0;
+static uint16_t screenshotWidth = 0;
+static uint16_t screenshotHeight = 0;
 
-static uint8_t rxDataReady = 0;
+static API_DeferredTypeDef deferQueue[DEFER_QUEUE_SIZE];
+static volatile uint8_t deferHead = 0; // next free entry
+static volatile uint8_t deferExec = 0; // next entry to execute, advanced by whoever runs it
+static volatile uint8_t deferTail = 0; // next result to send
 
+/**
+ * The GET_ commands for counters (GET_LTDC_ERRORS, GET_EVENT_STATS, GET_RASTER_STATS,
+ * GET_MFD_STATS, GET_ANIM_STATS) take an optional [reset u8], non-zero clears the
+ * counters after they are read
+ */
 enum CommandOut {
+  ANIMATE = 0xb6,
+  GET_ANIM_STATS = 0xb7,
+  GET_MFD_STATS = 0xb8,
+  MFD_SET_VALUES = 0xb9,
+  SHOW_LIST = 0xba,
+  DLIST_END = 0xbb,
+  DLIST_CHUNK = 0xbc,
+  DLIST_BEGIN = 0xbd,
+  BENCH_BLEND = 0xbe,
+  BENCH_PIXEL = 0xbf,
+  BENCH_ROTATE = 0xc0, // 0xc1..0xdf are taken, further commands count down from here
   NEXT_SCREEN = 0xc1,
   PREV_SCREEN = 0xc2,
   GET_CONFIG = 0xc3,
@@ -20,6 +145,29 @@ enum CommandOut {
   PUSH_CLK_CONFIG = 0xc6,
   GET_ADV7393_CONFIG = 0xc7,
   PUSH_ADV7393_CONFIG = 0xc8,
+  BATCH_BEGIN = 0xc9,
+  BATCH_COMMIT = 0xca,
+  SET_BAUD_RATE = 0xcb,
+  UPLOAD_BEGIN = 0xcc,
+  UPLOAD_CHUNK = 0xcd,
+  UPLOAD_END = 0xce,
+  GET_UPLOAD_STATUS = 0xcf,
+  SCREENSHOT = 0xd0,
+  GET_CHECKSUM = 0xd1,
+  WATCH_CHECKSUM = 0xd2,
+  GET_CHECKSUM_WATCH = 0xd3,
+  GET_LTDC_ERRORS = 0xd4,
+  SET_THROTTLE = 0xd5,
+  GET_BANDWIDTH = 0xd6,
+  SET_BANDWIDTH_POLICY = 0xd7,
+  SCHEDULE = 0xd8,
+  SHOW_PAGE = 0xd9,
+  GET_EVENT_STATS = 0xda,
+  SET_BEAM_MODE = 0xdb,
+  GET_SCANLINE = 0xdc,
+  SET_RASTER = 0xdd,
+  GET_RASTER_STATS = 0xde,
+  SHOW_PATTERN = 0xdf,
 };
 
 enum DataTypeIn {
@@ -27,40 +175,415 @@ enum DataTypeIn {
   LTDC_CLK_CONFIG = 0xf2,
   ADV7393_CONFIG = 0xf3,
   ADV7393_CHANGESET = 0xf4,
+  ACK = 0xf5,
+  BATCH_RESULT = 0xf6,
+  UPLOAD_STATUS = 0xf7,
+  SCREENSHOT_DATA = 0xf8,
+  SCREENSHOT_END = 0xf9,
+  CHECKSUM = 0xfa,
+  CHECKSUM_WATCH = 0xfb,
+  LTDC_ERRORS = 0xfc,
+  BANDWIDTH = 0xfd,
+  DEFERRED_RESULT = 0xfe,
+  EVENT_STATS = 0xe0, // 0xf1..0xfe are taken, further replies count up from here
+  SCANLINE = 0xe1,
+  RASTER_STATS = 0xe2,
+  PATTERN_TIME = 0xe3,
+  ROTATE_TIME = 0xe4,
+  PIXEL_BENCH = 0xe5,
+  BLEND_TIME = 0xe6,
+  LIST_TIME = 0xe7,
+  MFD_STATS = 0xe8,
+  ANIM_STATS = 0xe9,
 };
 
-void API_Init(UART_HandleTypeDef *huart) {
-  uartHandle = huart;
-  HAL_UART_Receive_IT(uartHandle, rxBuffer, PACKET_SIZE);
+enum Status {
+  STATUS_OK = 0x00,
+  STATUS_UNKNOWN_COMMAND = 0x01,
+  STATUS_BAD_PAYLOAD = 0x02,
+  STATUS_BATCH_OVERFLOW = 0x03,
+  STATUS_NO_BATCH = 0x04,
+  STATUS_NOT_SUPPORTED = 0x05,
+  STATUS_BAD_CRC = 0x06,
+  STATUS_OUT_OF_ORDER = 0x07,
+  STATUS_INCOMPLETE = 0x08,
+  STATUS_NO_UPLOAD = 0x09,
+  STATUS_BANDWIDTH_EXCEEDED = 0x0a, // rejected, the config would starve the LTDC
+  STATUS_LOW_HEADROOM = 0x0b, // applied, but close to the SDRAM bandwidth limit
+  STATUS_QUEUE_FULL = 0x0c,
+};
+
+static uint8_t API_execute(const uint8_t *packet, uint8_t ack);
+
+static void API_onPacket(const EVENT_TypeDef *event);
+
+void API_Init(const API_TransportTypeDef *t) {
+  transport = t;
+  EVENT_subscribe(EVENT_API_PACKET, API_onPacket);
+  if (transport->start() != HAL_OK) {
+    Error_Handler();
+  }
+}
+
+void API_receive(const uint8_t *data, uint16_t size) {
+  uint32_t now = HAL_GetTick();
+  if (rxOffset != 0 && now - rxTick > RX_RESYNC_MS) {
+    API_resetReceive();
+  }
+  rxTick = now;
+
+  for (uint16_t i = 0; i < size; i++) {
+    if (rxOffset == 0) {
+      rxSlot = SPSC_acquire(&rxQueue);
+    }
+
+    if (rxSlot != NULL) {
+      rxSlot[rxOffset] = data[i];
+    }
+
+    rxOffset++;
+
+    if (rxOffset == PACKET_SIZE) {
+      rxOffset = 0;
+      if (rxSlot != NULL) {
+        SPSC_commit(&rxQueue);
+        EVENT_post(EVENT_SOURCE_API, EVENT_API_PACKET, 0);
+      }
+    }
+  }
+}
+
+/**
+ * An acquired slot is only published by SPSC_commit, it is simply filled again
+ */
+void API_resetReceive(void) {
+  rxOffset = 0;
+  rxSlot = NULL;
 }
 
 HAL_StatusTypeDef API_transmit(const uint8_t *pData, uint16_t size) {
   uint8_t crc = 0;
   for (int i = 0; i < PACKET_SIZE - 1; i++) {
-    txBuffer[i] = i < size ? pData[i] : 0xFF;
+    if (i == SEQ_OFFSET) {
+      txBuffer[i] = currentSeq;
+    } else {
+      txBuffer[i] = i < size ? pData[i] : 0xFF;
+    }
     crc += txBuffer[i];
   }
   txBuffer[PACKET_SIZE - 1] = crc;
-  return HAL_UART_Transmit(uartHandle, txBuffer, PACKET_SIZE, 2000);
+  return transport->transmit(txBuffer, PACKET_SIZE);
 }
 
-static uint8_t checkCrc() {
+static void API_transmitAck(uint8_t cmd, uint8_t status) {
+  uint8_t data[4] = {
+      ACK,
+      2,
+      cmd,
+      status,
+  };
+
+  API_transmit(data, 4);
+}
+
+static uint8_t checkCrc(const uint8_t *packet) {
   uint8_t crc = 0;
   for (int i = 0; i < PACKET_SIZE - 1; i++) {
-    crc += rxBuffer[i];
+    crc += packet[i];
   }
-  return crc == rxBuffer[PACKET_SIZE - 1];
+  return crc == packet[PACKET_SIZE - 1];
 }
 
-static void API_parsePacket() {
-  uint8_t crcCorrect = checkCrc();
-  if (!crcCorrect) {
-    return;
+static uint32_t readU32(const uint8_t *data) {
+  return (uint32_t) (data[0] | data[1] << 8 | data[2] << 16 | data[3] << 24);
+}
+
+static uint16_t readU16(const uint8_t *data) {
+  return (uint16_t) (data[0] | data[1] << 8);
+}
+
+static void writeU32(uint8_t *data, uint32_t value) {
+  data[0] = (uint8_t) (value & 0xFF);
+  data[1] = (uint8_t) ((value >> 8) & 0xFF);
+  data[2] = (uint8_t) ((value >> 16) & 0xFF);
+  data[3] = (uint8_t) ((value >> 24) & 0xFF);
+}
+
+static void writeU16(uint8_t *data, uint16_t value) {
+  data[0] = (uint8_t) (value & 0xFF);
+  data[1] = (uint8_t) ((value >> 8) & 0xFF);
+}
+
+/**
+ * [x u16][y u16][width u16][height u16], the whole screen when missing
+ */
+static DISP_RectTypeDef readRect(const uint8_t *payload, uint8_t payloadSize) {
+  DISP_RectTypeDef rect = {
+      .X = 0,
+      .Y = 0,
+      .Width = DISP_getScreenWidth(),
+      .Height = DISP_getScreenHeight(),
+  };
+
+  if (payloadSize >= 8) {
+    rect.X = readU16(&payload[0]);
+    rect.Y = readU16(&payload[2]);
+    rect.Width = readU16(&payload[4]);
+    rect.Height = readU16(&payload[6]);
   }
 
-  uint8_t payloadSize = rxBuffer[1];
+  return rect;
+}
+
+static DISP_LTDC_ConfigTypeDef readLtdcConfig(const uint8_t *payload) {
+  DISP_LTDC_ConfigTypeDef cfg = {
+      .HorizontalSync = readU32(&payload[0]),
+      .VerticalSync = readU32(&payload[4]),
+      .AccumulatedHBP = readU32(&payload[8]),
+      .AccumulatedVBP = readU32(&payload[12]),
+      .AccumulatedActiveW = readU32(&payload[16]),
+      .AccumulatedActiveH = readU32(&payload[20]),
+      .TotalWidth = readU32(&payload[24]),
+      .TotalHeight = readU32(&payload[28]),
+      .ImageWidth = readU32(&payload[32]),
+      .ImageHeight = readU32(&payload[36]),
+  };
+  return cfg;
+}
+
+/**
+ * [PLLSAIN u32][PLLSAIR u32][PLLSAIDivR index u32], the rest is kept from the current config
+ */
+static DISP_LTDC_ClockConfigTypeDef readClockConfig(const uint8_t *payload) {
+  DISP_LTDC_ClockConfigTypeDef cfg = DISP_Get_Clock_Config();
+
+  cfg.PLLSAIN = readU32(&payload[0]);
+  cfg.PLLSAIR = readU32(&payload[4]);
+  cfg.PLLSAIDivR = readU32(&payload[8]);
+
+  switch (cfg.PLLSAIDivR) {
+    case 0:
+      cfg.PLLSAIDivR = RCC_PLLSAIDIVR_2;
+      break;
+    case 1:
+      cfg.PLLSAIDivR = RCC_PLLSAIDIVR_4;
+      break;
+    case 2:
+      cfg.PLLSAIDivR = RCC_PLLSAIDIVR_8;
+      break;
+    case 3:
+      cfg.PLLSAIDivR = RCC_PLLSAIDIVR_16;
+      break;
+    default:
+      break;
+  }
+
+  return cfg;
+}
+
+static uint8_t bandwidthStatus(const DISP_LTDC_ConfigTypeDef *cfg, uint32_t pixelClock) {
+  BANDWIDTH_PolicyTypeDef policy = BANDWIDTH_getPolicy();
+  if (policy == BANDWIDTH_POLICY_OFF) {
+    return STATUS_OK;
+  }
+
+  BANDWIDTH_EstimateTypeDef estimate = BANDWIDTH_estimate(cfg, pixelClock);
+  switch (BANDWIDTH_check(&estimate)) {
+    case BANDWIDTH_EXCEEDED:
+      return policy == BANDWIDTH_POLICY_REJECT ? STATUS_BANDWIDTH_EXCEEDED : STATUS_LOW_HEADROOM;
+    case BANDWIDTH_LOW:
+      return STATUS_LOW_HEADROOM;
+    default:
+      return STATUS_OK;
+  }
+}
+
+static uint8_t uploadStatus(UPLOAD_StatusTypeDef status) {
+  switch (status) {
+    case UPLOAD_OK:
+      return STATUS_OK;
+    case UPLOAD_NOT_ACTIVE:
+      return STATUS_NO_UPLOAD;
+    case UPLOAD_BAD_CRC:
+      return STATUS_BAD_CRC;
+    case UPLOAD_OUT_OF_ORDER:
+      return STATUS_OUT_OF_ORDER;
+    case UPLOAD_INCOMPLETE:
+      return STATUS_INCOMPLETE;
+    default:
+      return STATUS_BAD_PAYLOAD;
+  }
+}
+
+static uint8_t dlistStatus(DLIST_StatusTypeDef status) {
+  switch (status) {
+    case DLIST_OK:
+      return STATUS_OK;
+    case DLIST_NOT_ACTIVE:
+      return STATUS_NO_UPLOAD;
+    case DLIST_BAD_CRC:
+      return STATUS_BAD_CRC;
+    case DLIST_OUT_OF_ORDER:
+      return STATUS_OUT_OF_ORDER;
+    case DLIST_INCOMPLETE:
+      return STATUS_INCOMPLETE;
+    default:
+      return STATUS_BAD_PAYLOAD;
+  }
+}
+
+static uint8_t isResetRequested(const uint8_t *payload, uint8_t payloadSize) {
+  return payloadSize > 0 && payload[0];
+}
+
+/**
+ * Benchmarks draw straight into the shown page. The debug screen stops rendering first,
+ * afterwards it is rendered again over their output.
+ */
+static void API_beginBench(void) {
+  DEBUG_SCREEN_cancelPrepared();
+  RENDER_cancel();
+  TILE_wait();
+}
+
+static void API_endBench(void) {
+  DEBUG_SCREEN_reInit();
+}
+
+/**
+ * Commands that can be scheduled: short and without replies
+ */
+static uint8_t isDeferrable(uint8_t cmd) {
+  switch (cmd) {
+    case NEXT_SCREEN:
+    case PREV_SCREEN:
+    case PUSH_CONFIG:
+    case PUSH_ADV7393_CONFIG:
+    case SET_THROTTLE:
+    case SHOW_PAGE:
+    case SET_BEAM_MODE:
+    case MFD_SET_VALUES:
+    case ANIMATE:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+static API_DeferKindTypeDef deferKind(uint8_t cmd) {
+  switch (cmd) {
+    case NEXT_SCREEN:
+    case PREV_SCREEN:
+      return DEFER_SCREEN;
+    case PUSH_ADV7393_CONFIG:
+    case ANIMATE:
+      return DEFER_MAIN;
+    default:
+      // PUSH_CONFIG writes the timing registers here, DISP_onVblank updates the encoder afterwards
+      return DEFER_VBLANK;
+  }
+}
+
+/**
+ * Commands answering with their own data packet, refused inside a batch where
+ * the only reply is the batch result
+ */
+static uint8_t hasReply(uint8_t cmd) {
+  switch (cmd) {
+    case GET_CONFIG:
+    case GET_CLK_CONFIG:
+    case GET_ADV7393_CONFIG:
+    case GET_UPLOAD_STATUS:
+    case SCREENSHOT:
+    case GET_CHECKSUM:
+    case GET_CHECKSUM_WATCH:
+    case GET_LTDC_ERRORS:
+    case GET_BANDWIDTH:
+    case GET_EVENT_STATS:
+    case GET_SCANLINE:
+    case GET_RASTER_STATS:
+    case SHOW_PATTERN:
+    case BENCH_ROTATE:
+    case BENCH_PIXEL:
+    case BENCH_BLEND:
+    case SHOW_LIST:
+    case GET_MFD_STATS:
+    case GET_ANIM_STATS:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+/**
+ * Frame 0 runs the command at the next vertical blanking
+ */
+static uint8_t API_schedule(uint32_t frame, uint8_t cmd, const uint8_t *payload, uint8_t payloadSize) {
+  uint8_t next = (deferHead + 1) % DEFER_QUEUE_SIZE;
+  if (next == deferTail) {
+    return STATUS_QUEUE_FULL;
+  }
+
+  API_DeferredTypeDef *entry = &deferQueue[deferHead];
+  entry->Packet[0] = cmd;
+  entry->Packet[1] = payloadSize;
+  memcpy(&entry->Packet[PAYLOAD_OFFSET], payload, payloadSize);
+  entry->Packet[SEQ_OFFSET] = currentSeq;
+  entry->Frame = frame ? frame : DISP_getFrameCount() + 1;
+  entry->Prepared = 0;
+
+  deferHead = next;
+  return STATUS_OK;
+}
+
+static uint8_t API_batchCommit(void) {
+  uint8_t data[PACKET_SIZE] = {
+      BATCH_RESULT,
+  };
+
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < batchSize; i++) {
+    uint8_t commitSeq = currentSeq;
+    currentSeq = batchPackets[i][SEQ_OFFSET];
+    uint8_t status = hasReply(batchPackets[i][0]) ? STATUS_NOT_SUPPORTED : API_execute(batchPackets[i], 0);
+    currentSeq = commitSeq;
 
-  switch (rxBuffer[0]) {
+    data[3 + count * 2] = batchPackets[i][SEQ_OFFSET];
+    data[4 + count * 2] = status;
+    count++;
+  }
+
+  uint8_t status = batchOverflow ? STATUS_BATCH_OVERFLOW : STATUS_OK;
+
+  data[1] = 1 + count * 2;
+  data[2] = status;
+
+  batchOpen = 0;
+  batchSize = 0;
+  batchOverflow = 0;
+
+  API_transmit(data, data[1] + 2);
+  return status;
+}
+
+/**
+ * Executes a single command packet.
+ * Commands that don't return data are acknowledged with an ACK packet unless
+ * ack is 0, which is the case for commands executed as part of a batch.
+ */
+static uint8_t API_execute(const uint8_t *packet, uint8_t ack) {
+  const uint8_t *payload = packet + PAYLOAD_OFFSET;
+  uint8_t payloadSize = packet[1];
+  uint8_t status = STATUS_OK;
+
+  if (payloadSize > PAYLOAD_MAX_SIZE) {
+    if (ack) {
+      API_transmitAck(packet[0], STATUS_BAD_PAYLOAD);
+    }
+    return STATUS_BAD_PAYLOAD;
+  }
+
+  switch (packet[0]) {
     case NEXT_SCREEN: {
       DEBUG_SCREEN_next();
       break;
@@ -98,23 +621,24 @@ static void API_parsePacket() {
       }
 
       API_transmit(data, 42);
-      break;
+      return STATUS_OK;
     }
     case PUSH_CONFIG: {
-      DISP_LTDC_ConfigTypeDef cfg = {
-          .HorizontalSync = (uint32_t) (rxBuffer[2] | rxBuffer[3] << 8 | rxBuffer[4] << 16 | rxBuffer[5] << 24),
-          .VerticalSync = (uint32_t) (rxBuffer[6] | rxBuffer[7] << 8 | rxBuffer[8] << 16 | rxBuffer[9] << 24),
-          .AccumulatedHBP = (uint32_t) (rxBuffer[10] | rxBuffer[11] << 8 | rxBuffer[12] << 16 | rxBuffer[13] << 24),
-          .AccumulatedVBP = (uint32_t) (rxBuffer[14] | rxBuffer[15] << 8 | rxBuffer[16] << 16 | rxBuffer[17] << 24),
-          .AccumulatedActiveW = (uint32_t) (rxBuffer[18] | rxBuffer[19] << 8 | rxBuffer[20] << 16 | rxBuffer[21] << 24),
-          .AccumulatedActiveH = (uint32_t) (rxBuffer[22] | rxBuffer[23] << 8 | rxBuffer[24] << 16 | rxBuffer[25] << 24),
-          .TotalWidth = (uint32_t) (rxBuffer[26] | rxBuffer[27] << 8 | rxBuffer[28] << 16 | rxBuffer[29] << 24),
-          .TotalHeight = (uint32_t) (rxBuffer[30] | rxBuffer[31] << 8 | rxBuffer[32] << 16 | rxBuffer[33] << 24),
-          .ImageWidth = (uint32_t) (rxBuffer[34] | rxBuffer[35] << 8 | rxBuffer[36] << 16 | rxBuffer[37] << 24),
-          .ImageHeight = (uint32_t) (rxBuffer[38] | rxBuffer[39] << 8 | rxBuffer[40] << 16 | rxBuffer[41] << 24),
-      };
+      if (payloadSize < 40) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      DISP_LTDC_ConfigTypeDef cfg = readLtdcConfig(payload);
+
+      status = bandwidthStatus(&cfg, DISP_getLtdcPixelClockFreq());
+      if (status == STATUS_BANDWIDTH_EXCEEDED) {
+        break;
+      }
 
-      DISP_reInit(&cfg);
+      if (DISP_applyConfig(&cfg) != HAL_OK) {
+        status = STATUS_BAD_PAYLOAD;
+      }
       break;
     }
     case GET_CLK_CONFIG: {
@@ -142,36 +666,30 @@ static void API_parsePacket() {
       }
 
       API_transmit(data, size + 2);
-      break;
+      return STATUS_OK;
     }
     case PUSH_CLK_CONFIG: {
-      DISP_LTDC_ClockConfigTypeDef cfg = {
-          .PLLSAIN = (uint32_t) (rxBuffer[2] | rxBuffer[3] << 8 | rxBuffer[4] << 16 | rxBuffer[5] << 24),
-          .PLLSAIR = (uint32_t) (rxBuffer[6] | rxBuffer[7] << 8 | rxBuffer[8] << 16 | rxBuffer[9] << 24),
-          .PLLSAIDivR = (uint32_t) (rxBuffer[10] | rxBuffer[11] << 8 | rxBuffer[12] << 16 | rxBuffer[13] << 24),
-      };
+      if (payloadSize < 12) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
 
-      switch (cfg.PLLSAIDivR) {
-        case 0:
-          cfg.PLLSAIDivR = RCC_PLLSAIDIVR_2;
-          break;
-        case 1:
-          cfg.PLLSAIDivR = RCC_PLLSAIDIVR_4;
-          break;
-        case 2:
-          cfg.PLLSAIDivR = RCC_PLLSAIDIVR_8;
-          break;
-        case 3:
-          cfg.PLLSAIDivR = RCC_PLLSAIDIVR_16;
-          break;
-        default:
-          break;
+      DISP_LTDC_ClockConfigTypeDef cfg = readClockConfig(payload);
+      DISP_LTDC_ConfigTypeDef ltdcCfg = DISP_getCurrentCfg();
+
+      status = bandwidthStatus(&ltdcCfg, DISP_calcPixelClockFreq(&cfg));
+      if (status == STATUS_BANDWIDTH_EXCEEDED) {
+        break;
       }
 
       DISP_Set_Clock_Config(&cfg);
       break;
     }
     case GET_ADV7393_CONFIG: {
+      if (payloadSize > PAYLOAD_MAX_SIZE / 2) {
+        payloadSize = PAYLOAD_MAX_SIZE / 2;
+      }
+
       uint8_t size = payloadSize * 2;
       uint8_t data[PACKET_SIZE] = {
           ADV7393_CONFIG,
@@ -179,12 +697,12 @@ static void API_parsePacket() {
       };
 
       for (uint8_t i = 0; i < payloadSize; i++) {
-        data[2 + i * 2] = rxBuffer[2 + i];
-        data[3 + i * 2] = ADV7393_readReg(rxBuffer[2 + i]);
+        data[2 + i * 2] = payload[i];
+        data[3 + i * 2] = ADV7393_readReg(payload[i]);
       }
 
       API_transmit(data, size + 2);
-      break;
+      return STATUS_OK;
     }
     case PUSH_ADV7393_CONFIG: {
       uint8_t data[PACKET_SIZE] = {
@@ -194,9 +712,9 @@ static void API_parsePacket() {
       uint8_t size = 0;
 
       for (uint8_t i = 0; i < payloadSize / 2; i++) {
-        uint8_t reg = rxBuffer[2 + i * 2];
+        uint8_t reg = payload[i * 2];
         uint8_t currValue = ADV7393_readReg(reg);
-        uint8_t newValue = rxBuffer[3 + i * 2];
+        uint8_t newValue = payload[i * 2 + 1];
         if (newValue != currValue) {
           data[2 + size] = reg;
           ADV7393_writeReg(reg, newValue);
@@ -206,30 +724,865 @@ static void API_parsePacket() {
 
       data[1] = size;
 
-      API_transmit(data, size + 2);
+      if (ack) {
+        API_transmit(data, size + 2);
+      }
+      return STATUS_OK;
+    }
+    case SET_BAUD_RATE: {
+      if (payloadSize < 4) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      uint32_t baudRate = readU32(&payload[0]);
+
+      // Not allowed inside a batch, the batch result would go out at the new rate
+      if (!ack || transport->setBaudRate == NULL || !transport->isBaudRateSupported(baudRate)) {
+        status = STATUS_NOT_SUPPORTED;
+        break;
+      }
+
+      // Acknowledge at the current rate, the host switches after receiving the reply
+      API_transmitAck(packet[0], STATUS_OK);
+      if (transport->setBaudRate(baudRate) != HAL_OK) {
+        Error_Handler();
+      }
+      return STATUS_OK;
+    }
+    case UPLOAD_BEGIN: {
+      if (payloadSize < 16) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      UPLOAD_HeaderTypeDef header = {
+          .Page = payload[0],
+          .Encoding = payload[1],
+          .Show = payload[2],
+          .X = readU16(&payload[4]),
+          .Y = readU16(&payload[6]),
+          .Width = readU16(&payload[8]),
+          .Height = readU16(&payload[10]),
+          .Size = readU32(&payload[12]),
+      };
+
+      status = uploadStatus(UPLOAD_begin(&header));
+      break;
+    }
+    case UPLOAD_CHUNK: {
+      // [offset u32][crc u32][data]
+      if (payloadSize < 8) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      status = uploadStatus(UPLOAD_chunk(readU32(&payload[0]), &payload[8], payloadSize - 8, readU32(&payload[4])));
+      break;
+    }
+    case UPLOAD_END: {
+      status = uploadStatus(UPLOAD_end());
+      // The shown upload stays until the next screen change, the debug screen no longer draws to it
+      if (status == STATUS_OK && UPLOAD_getInfo().Show) {
+        DEBUG_SCREEN_showExternal();
+      }
+      break;
+    }
+    case GET_UPLOAD_STATUS: {
+      UPLOAD_InfoTypeDef info = UPLOAD_getInfo();
+
+      uint32_t width = DISP_getScreenWidth();
+      uint32_t height = DISP_getScreenHeight();
+
+      uint8_t data[21] = {
+          UPLOAD_STATUS,
+          19,
+          info.State,
+          info.Page,
+          DISP_getActivePage(),
+      };
+
+      writeU32(&data[5], info.Offset);
+      writeU32(&data[9], info.Size);
+      writeU32(&data[13], info.Pixels);
+      writeU16(&data[17], width);
+      writeU16(&data[19], height);
+
+      API_transmit(data, 21);
+      return STATUS_OK;
+    }
+    case SCREENSHOT: {
+      DISP_RectTypeDef rect = readRect(payload, payloadSize);
+
+      if (!CAPTURE_begin(rect.X, rect.Y, rect.Width, rect.Height)) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      screenshotSeq = currentSeq;
+      screenshotOffset = 0;
+      screenshotCrc = CRC_INIT;
+      screenshotWidth = rect.Width;
+      screenshotHeight = rect.Height;
+      break;
+    }
+    case GET_CHECKSUM: {
+      DISP_RectTypeDef rect = readRect(payload, payloadSize);
+      uint32_t checksum = DISP_frameChecksum(rect);
+
+      uint8_t data[10] = {
+          CHECKSUM,
+          8,
+      };
+
+      writeU32(&data[2], checksum);
+      writeU32(&data[6], DISP_getFrameCount());
+
+      API_transmit(data, 10);
+      return STATUS_OK;
+    }
+    case WATCH_CHECKSUM: {
+      // [rect][interval u16]
+      if (payloadSize < 10) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      DISP_watchChecksum(readRect(payload, payloadSize), readU16(&payload[8]));
+      break;
+    }
+    case GET_CHECKSUM_WATCH: {
+      DISP_ChecksumWatchTypeDef watch = DISP_getChecksumWatch();
+
+      uint8_t data[28] = {
+          CHECKSUM_WATCH,
+          26,
+      };
+
+      writeU16(&data[2], watch.Rect.X);
+      writeU16(&data[4], watch.Rect.Y);
+      writeU16(&data[6], watch.Rect.Width);
+      writeU16(&data[8], watch.Rect.Height);
+      writeU16(&data[10], watch.Interval);
+      writeU32(&data[12], watch.Golden);
+      writeU32(&data[16], watch.Last);
+      writeU32(&data[20], watch.Checks);
+      writeU32(&data[24], watch.Mismatches);
+
+      API_transmit(data, 28);
+      return STATUS_OK;
+    }
+    case GET_LTDC_ERRORS: {
+      DISP_ErrorStatsTypeDef stats = DISP_getErrorStats();
+
+      uint8_t data[20] = {
+          LTDC_ERRORS,
+          18,
+      };
+
+      writeU32(&data[2], stats.UnderrunFrames);
+      writeU32(&data[6], stats.TransferErrorFrames);
+      writeU32(&data[10], stats.LastErrorFrame);
+      writeU32(&data[14], stats.Frame);
+      data[18] = stats.Throttle;
+      data[19] = stats.Throttled;
+
+      if (isResetRequested(payload, payloadSize)) {
+        DISP_resetErrorStats();
+      }
+
+      API_transmit(data, 20);
+      return STATUS_OK;
+    }
+    case SET_THROTTLE: {
+      if (payloadSize < 1 || payload[0] > DISP_THROTTLE_AUTO) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      DISP_setThrottle(payload[0]);
       break;
     }
+    case SCHEDULE: {
+      // [frame u32][command u8][command payload]
+      if (payloadSize < 5) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+      if (!isDeferrable(payload[4])) {
+        status = STATUS_NOT_SUPPORTED;
+        break;
+      }
+
+      status = API_schedule(readU32(&payload[0]), payload[4], &payload[5], payloadSize - 5);
+      break;
+    }
+    case SHOW_PAGE: {
+      if (payloadSize < 1 || payload[0] >= DISP_PAGE_COUNT) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      DISP_showPage(payload[0]);
+      break;
+    }
+    case GET_BANDWIDTH: {
+      // Optional candidate [timing config, 40 bytes][clock config, 12 bytes], evaluated without applying
+      DISP_LTDC_ConfigTypeDef cfg = payloadSize >= 40 ? readLtdcConfig(payload) : DISP_getCurrentCfg();
+      uint32_t pixelClock = DISP_getLtdcPixelClockFreq();
+
+      if (payloadSize >= 52) {
+        DISP_LTDC_ClockConfigTypeDef clkCfg = readClockConfig(&payload[40]);
+        pixelClock = DISP_calcPixelClockFreq(&clkCfg);
+      }
+
+      BANDWIDTH_EstimateTypeDef estimate = BANDWIDTH_estimate(&cfg, pixelClock);
+
+      uint8_t data[29] = {
+          BANDWIDTH,
+          27,
+      };
+
+      writeU32(&data[2], estimate.Available);
+      writeU32(&data[6], estimate.ScanoutPeak);
+      writeU32(&data[10], estimate.ScanoutAverage);
+      writeU32(&data[14], estimate.DrawReserve);
+      writeU32(&data[18], (uint32_t) estimate.Headroom);
+      writeU32(&data[22], pixelClock);
+      data[26] = BANDWIDTH_check(&estimate);
+      data[27] = BANDWIDTH_getPolicy();
+      data[28] = BANDWIDTH_getDrawReservePercent();
+
+      API_transmit(data, 29);
+      return STATUS_OK;
+    }
+    case SET_BANDWIDTH_POLICY: {
+      // [policy u8][draw reserve percent u8]
+      if (payloadSize < 2 || payload[0] > BANDWIDTH_POLICY_REJECT || payload[1] > 100) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      BANDWIDTH_setPolicy(payload[0], payload[1]);
+      break;
+    }
+    case GET_EVENT_STATS: {
+      EVENT_StatsTypeDef stats = EVENT_getStats();
+
+      uint8_t data[30] = {
+          EVENT_STATS,
+          28,
+      };
+
+      writeU32(&data[2], stats.Dispatched);
+      writeU32(&data[6], stats.Dropped);
+      writeU32(&data[10], stats.LastLatency);
+      writeU32(&data[14], stats.MinLatency);
+      writeU32(&data[18], stats.MaxLatency);
+      writeU32(&data[22], stats.MaxHandler);
+      writeU32(&data[26], SystemCoreClock);
+
+      if (isResetRequested(payload, payloadSize)) {
+        EVENT_resetStats();
+      }
+
+      API_transmit(data, 30);
+      return STATUS_OK;
+    }
+    case SET_BEAM_MODE: {
+      if (payloadSize < 1 || payload[0] > 1) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      TILE_setBeamMode(payload[0]);
+      break;
+    }
+    case GET_SCANLINE: {
+      // Sampled first, the rest only puts it in context
+      uint16_t scanline = DISP_getScanline();
+      uint32_t frame = DISP_getFrameCount();
+      DISP_LTDC_ConfigTypeDef cfg = DISP_getCurrentCfg();
+
+      uint8_t data[15] = {
+          SCANLINE,
+          13,
+      };
+
+      writeU16(&data[2], scanline);
+      writeU16(&data[4], cfg.AccumulatedVBP);
+      writeU16(&data[6], cfg.AccumulatedActiveH);
+      writeU16(&data[8], cfg.TotalHeight);
+      writeU32(&data[10], frame);
+      data[14] = TILE_getBeamMode();
+
+      API_transmit(data, 15);
+      return STATUS_OK;
+    }
+    case SET_RASTER: {
+      if (payloadSize < 1) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      uint8_t ok = 0;
+      switch (payload[0]) {
+        case RASTER_NONE: {
+          RASTER_clear();
+          ok = 1;
+          break;
+        }
+        case RASTER_RAMP: {
+          // [from RGB888 u32][to RGB888 u32][hide layer u8]
+          ok = payloadSize >= 10 && RASTER_ramp(readU32(&payload[1]), readU32(&payload[5]), payload[9]);
+          break;
+        }
+        case RASTER_BANDS: {
+          // [hide layer u8][count u8][RGB888 u32 per band]
+          if (payloadSize < 3 || payload[2] > RASTER_MAX_BANDS || payloadSize < 3 + payload[2] * 4) {
+            break;
+          }
+
+          uint32_t colors[RASTER_MAX_BANDS];
+          for (uint8_t i = 0; i < payload[2]; i++) {
+            colors[i] = readU32(&payload[3 + i * 4]);
+          }
+          ok = RASTER_bands(colors, payload[2], payload[1]);
+          break;
+        }
+        case RASTER_FADE: {
+          // [background RGB888 u32][from alpha u8][to alpha u8]
+          ok = payloadSize >= 7 && RASTER_fade(readU32(&payload[1]), payload[5], payload[6]);
+          break;
+        }
+        default:
+          break;
+      }
+
+      if (!ok) {
+        status = STATUS_BAD_PAYLOAD;
+      }
+      break;
+    }
+    case GET_RASTER_STATS: {
+      RASTER_StatsTypeDef stats = RASTER_getStats();
+
+      uint8_t data[26] = {
+          RASTER_STATS,
+          24,
+      };
+
+      writeU32(&data[2], stats.Applied);
+      writeU32(&data[6], stats.Late);
+      writeU32(&data[10], stats.LastLatency);
+      writeU32(&data[14], stats.MinLatency);
+      writeU32(&data[18], stats.MaxLatency);
+      writeU32(&data[22], DISP_getLtdcPixelClockFreq());
+
+      if (isResetRequested(payload, payloadSize)) {
+        RASTER_resetStats();
+      }
+
+      API_transmit(data, 26);
+      return STATUS_OK;
+    }
+    case SHOW_PATTERN: {
+      if (payloadSize < 1 || payload[0] >= PATTERN_COUNT) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      // Rendered synchronously so the reply carries the generation time of the whole screen
+      DEBUG_SCREEN_cancelPrepared();
+      RENDER_cancel();
+      TILE_clear();
+      TILE_pattern(payload[0]);
+
+      uint32_t start = EVENT_cycles();
+      TILE_renderAll();
+      uint32_t cycles = EVENT_cycles() - start;
+
+      uint32_t framePeriod = DISP_getFramePeriodUs();
+
+      uint8_t data[15] = {
+          PATTERN_TIME,
+          13,
+          payload[0],
+      };
+
+      writeU32(&data[3], cycles);
+      writeU32(&data[7], SystemCoreClock);
+      writeU32(&data[11], framePeriod);
+
+      API_transmit(data, 15);
+      return STATUS_OK;
+    }
+    case BENCH_ROTATE: {
+      if (payloadSize < 2 || payload[0] > ROTATE_270) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      // A square region reads and writes the same pixel count at any angle
+      uint16_t size = 240;
+      if (size > DISP_getScreenWidth()) size = DISP_getScreenWidth();
+      if (size > DISP_getScreenHeight()) size = DISP_getScreenHeight();
+
+      API_beginBench();
+
+      uint16_t *fb = (uint16_t *) DISP_getDrawAddress();
+      uint32_t start = EVENT_cycles();
+      ROTATE_copy(get_fox_240x320(), 240, 320, ROTATE_0, 0, 0, 0, size, size, fb, DISP_getScreenWidth());
+      uint32_t copyCycles = EVENT_cycles() - start;
+
+      start = EVENT_cycles();
+      ROTATE_copy(get_fox_240x320(), 240, 320, payload[0], payload[1], 0, 0, size, size, fb, DISP_getScreenWidth());
+      uint32_t rotateCycles = EVENT_cycles() - start;
+
+      API_endBench();
+
+      uint8_t data[18] = {
+          ROTATE_TIME,
+          16,
+          payload[0],
+          payload[1],
+      };
+
+      writeU16(&data[4], size);
+      writeU32(&data[6], copyCycles);
+      writeU32(&data[10], rotateCycles);
+      writeU32(&data[14], SystemCoreClock);
+
+      API_transmit(data, 18);
+      return STATUS_OK;
+    }
+    case BENCH_BLEND: {
+      if (payloadSize < 2 || payload[0] > BLEND_ARGB8888) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      BLEND_FormatTypeDef format = payload[0];
+      uint16_t width = DISP_getScreenWidth();
+      uint16_t height = DISP_getScreenHeight();
+      uint32_t rowBytes = (uint32_t) width * BLEND_getPixelSize(format);
+      if (height * rowBytes > BENCH_SCRATCH_SIZE) {
+        height = BENCH_SCRATCH_SIZE / rowBytes;
+      }
+
+      API_beginBench();
+
+      uint32_t overlay = BENCH_SCRATCH_ADDR;
+      for (uint16_t y = 0; y < height; y++) {
+        for (uint16_t x = 0; x < width; x++) {
+          // Alpha ramps up from left to right, the color changes every 16 rows
+          uint32_t a = (uint32_t) x * 255 / width;
+          uint32_t i = (uint32_t) y * width + x;
+          if (format == BLEND_ARGB8888) {
+            ((uint32_t *) overlay)[i] = a << 24 | (y & 16 ? 0x00FFFF00 : 0x0000FFFF);
+          } else if (format == BLEND_ARGB4444) {
+            ((uint16_t *) overlay)[i] = (uint16_t) ((a >> 4) << 12 | (y & 16 ? 0x0FF0 : 0x00FF));
+          } else {
+            ((uint16_t *) overlay)[i] = y & 16 ? 0xFFE0 : 0x07FF;
+          }
+        }
+      }
+
+      uint16_t *fb = (uint16_t *) DISP_getDrawAddress();
+      uint32_t start = EVENT_cycles();
+      HAL_StatusTypeDef result = BLEND_rect(fb, width, (const void *) overlay, width, format, payload[1], width,
+                                            height);
+      uint32_t dmaCycles = EVENT_cycles() - start;
+
+      start = EVENT_cycles();
+      BLEND_rectCpu(fb, width, (const void *) overlay, width, format, payload[1], width, height);
+      uint32_t cpuCycles = EVENT_cycles() - start;
+
+      API_endBench();
+
+      uint8_t data[23] = {
+          BLEND_TIME,
+          21,
+          payload[0],
+          payload[1],
+          result,
+      };
+
+      writeU16(&data[5], height);
+      writeU32(&data[7], dmaCycles);
+      writeU32(&data[11], cpuCycles);
+      writeU32(&data[15], SystemCoreClock);
+      writeU32(&data[19], DISP_getFramePeriodUs());
+
+      API_transmit(data, 23);
+      return STATUS_OK;
+    }
+    case DLIST_BEGIN: {
+      // [slot u8][size u32]
+      if (payloadSize < 5) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      status = dlistStatus(DLIST_begin(payload[0], readU32(&payload[1])));
+      break;
+    }
+    case DLIST_CHUNK: {
+      // [offset u32][crc u32][data]
+      if (payloadSize < 8) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      status = dlistStatus(DLIST_chunk(readU32(&payload[0]), &payload[8], payloadSize - 8, readU32(&payload[4])));
+      break;
+    }
+    case DLIST_END: {
+      // The list is checked here, a refused op is a bad payload
+      status = dlistStatus(DLIST_end());
+      break;
+    }
+    case SHOW_LIST: {
+      if (payloadSize < 1 || DLIST_getSize(payload[0]) == 0) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      // Rendered synchronously so the reply carries the build and generation time
+      DEBUG_SCREEN_cancelPrepared();
+      RENDER_cancel();
+      TILE_clear();
+
+      uint32_t start = EVENT_cycles();
+      DLIST_StatusTypeDef result = DLIST_buildSlot(payload[0]);
+      uint32_t buildCycles = EVENT_cycles() - start;
+
+      uint32_t renderCycles = 0;
+      if (result == DLIST_OK) {
+        start = EVENT_cycles();
+        TILE_renderAll();
+        renderCycles = EVENT_cycles() - start;
+
+        DEBUG_SCREEN_showList(payload[0], 1);
+      } else {
+        // The status goes back in the reply, the screen shown before is rebuilt over the partial build
+        DEBUG_SCREEN_reInit();
+      }
+
+      uint8_t data[24] = {
+          LIST_TIME,
+          22,
+          result,
+          payload[0],
+      };
+
+      writeU32(&data[4], DLIST_getSize(payload[0]));
+      writeU32(&data[8], buildCycles);
+      writeU32(&data[12], renderCycles);
+      writeU32(&data[16], SystemCoreClock);
+      writeU32(&data[20], DISP_getFramePeriodUs());
+
+      API_transmit(data, 24);
+      return STATUS_OK;
+    }
+    case MFD_SET_VALUES: {
+      // [count u8][count x ([widget u8][value i32])], applied up to the first unknown widget
+      if (payloadSize < 1 || payloadSize < 1 + payload[0] * 5) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      for (uint8_t i = 0; i < payload[0]; i++) {
+        const uint8_t *entry = &payload[1 + i * 5];
+        if (!MFD_setValue(entry[0], (int32_t) readU32(&entry[1]))) {
+          status = STATUS_BAD_PAYLOAD;
+          break;
+        }
+      }
+      break;
+    }
+    case GET_MFD_STATS: {
+      MFD_StatsTypeDef stats = MFD_getStats();
+
+      uint8_t data[23] = {
+          MFD_STATS,
+          21,
+          MFD_getCount(),
+      };
+
+      writeU32(&data[3], stats.Redraws);
+      writeU32(&data[7], stats.Pixels);
+      writeU32(&data[11], stats.Cycles);
+      writeU32(&data[15], stats.MaxCycles);
+      writeU32(&data[19], SystemCoreClock);
+
+      if (isResetRequested(payload, payloadSize)) {
+        MFD_resetStats();
+      }
+
+      API_transmit(data, 23);
+      return STATUS_OK;
+    }
+    case ANIMATE: {
+      // [animation u8][speed u8][budget us u32], speed in pixels per frame and budget 0 for the defaults
+      uint32_t budgetUs = payloadSize >= 6 ? readU32(&payload[2]) : 0;
+      if (payloadSize < 2 || !DEBUG_SCREEN_animate(payload[0], payload[1], budgetUs)) {
+        status = STATUS_BAD_PAYLOAD;
+      }
+      break;
+    }
+    case GET_ANIM_STATS: {
+      ANIM_StatsTypeDef stats = ANIM_getStats();
+
+      uint8_t data[62] = {
+          ANIM_STATS,
+          60,
+      };
+
+      writeU32(&data[2], stats.Updates);
+      writeU32(&data[6], stats.Missed);
+      writeU32(&data[10], stats.Overruns);
+      writeU32(&data[14], stats.Budget);
+      writeU32(&data[18], stats.MaxCycles);
+      writeU32(&data[22], stats.MaxLatency);
+      writeU32(&data[26], SystemCoreClock);
+      for (uint8_t i = 0; i < ANIM_HISTOGRAM_BINS; i++) {
+        writeU16(&data[30 + i * 2], stats.Histogram[i]);
+      }
+
+      if (isResetRequested(payload, payloadSize)) {
+        ANIM_resetStats();
+      }
+
+      API_transmit(data, 62);
+      return STATUS_OK;
+    }
+    case BENCH_PIXEL: {
+      if (payloadSize < 1 || payload[0] >= PIXEL_KERNEL_COUNT) {
+        status = STATUS_BAD_PAYLOAD;
+        break;
+      }
+
+      uint32_t refCycles = 0;
+      uint32_t simdCycles = 0;
+      uint8_t match = PIXEL_check(payload[0], &refCycles, &simdCycles);
+
+      uint8_t data[18] = {
+          PIXEL_BENCH,
+          16,
+          payload[0],
+          match,
+      };
+
+      writeU16(&data[4], PIXEL_CHECK_PIXELS);
+      writeU32(&data[6], refCycles);
+      writeU32(&data[10], simdCycles);
+      writeU32(&data[14], SystemCoreClock);
+
+      API_transmit(data, 18);
+      return STATUS_OK;
+    }
+    case BATCH_BEGIN: {
+      batchOpen = 1;
+      batchSize = 0;
+      batchOverflow = 0;
+      break;
+    }
+    case BATCH_COMMIT: {
+      if (!batchOpen) {
+        status = STATUS_NO_BATCH;
+        break;
+      }
+      return API_batchCommit();
+    }
     default:
+      status = STATUS_UNKNOWN_COMMAND;
       break;
   }
+
+  if (ack) {
+    API_transmitAck(packet[0], status);
+  }
+
+  return status;
 }
 
-void API_Tick(void) {
-  if (rxDataReady) {
-    API_parsePacket();
-    rxDataReady = 0;
-    // __HAL_UART_CLEAR_OREFLAG(uartHandle);
-    HAL_StatusTypeDef status = HAL_UART_Receive_IT(uartHandle, rxBuffer, PACKET_SIZE);
-    if (status != HAL_OK) {
-      Error_Handler();
+/**
+ * SCREENSHOT_DATA - [offset u32][ops]
+ * SCREENSHOT_END - [width u16][height u16][size u32][crc u32 of the whole stream]
+ */
+static void API_streamScreenshot(void) {
+  uint8_t seq = currentSeq;
+  currentSeq = screenshotSeq;
+
+  for (uint8_t i = 0; i < SCREENSHOT_PACKETS_PER_TICK && CAPTURE_isActive(); i++) {
+    uint8_t data[PACKET_SIZE] = {
+        SCREENSHOT_DATA,
+    };
+
+    uint8_t size = CAPTURE_read(&data[6], PAYLOAD_MAX_SIZE - 4);
+    if (size > 0) {
+      data[1] = size + 4;
+      writeU32(&data[2], screenshotOffset);
+      screenshotCrc = CRC_calc(screenshotCrc, &data[6], size);
+      screenshotOffset += size;
+      API_transmit(data, size + 6);
+      continue;
+    }
+
+    data[0] = SCREENSHOT_END;
+    data[1] = 12;
+    writeU16(&data[2], screenshotWidth);
+    writeU16(&data[4], screenshotHeight);
+    writeU32(&data[6], screenshotOffset);
+    writeU32(&data[10], screenshotCrc);
+    API_transmit(data, 14);
+  }
+
+  currentSeq = seq;
+}
+
+/**
+ * Latches the scheduled commands that are due, up to the first one left to the main loop.
+ * A screen switch that is not rendered yet waits, it is stamped with the frame it was shown in.
+ */
+void DISP_VblankCallback(uint32_t frame) {
+  while (deferExec != deferHead) {
+    API_DeferredTypeDef *entry = &deferQueue[deferExec];
+    if ((int32_t) (frame - entry->Frame) < 0) {
+      break;
     }
+
+    API_DeferKindTypeDef kind = deferKind(entry->Packet[0]);
+    if (kind == DEFER_MAIN) {
+      break;
+    }
+
+    if (kind == DEFER_SCREEN) {
+      if (!entry->Prepared || !DEBUG_SCREEN_showPrepared()) {
+        break;
+      }
+      entry->Status = STATUS_OK;
+    } else {
+      entry->Status = API_execute(entry->Packet, 0);
+    }
+
+    entry->ExecutedFrame = frame;
+    deferExec = (deferExec + 1) % DEFER_QUEUE_SIZE;
+  }
+}
+
+/**
+ * The main loop part of the queue: runs the due commands the vblank callback leaves,
+ * and starts rendering a screen switch once it is next in line and DEFER_PREPARE_FRAMES from due
+ */
+static void API_runDeferred(void) {
+  while (deferExec != deferHead) {
+    API_DeferredTypeDef *entry = &deferQueue[deferExec];
+    uint8_t cmd = entry->Packet[0];
+    API_DeferKindTypeDef kind = deferKind(cmd);
+
+    if (kind == DEFER_VBLANK) {
+      return;
+    }
+
+    if (kind == DEFER_SCREEN) {
+      if (!entry->Prepared) {
+        if ((int32_t) (DISP_getFrameCount() + DEFER_PREPARE_FRAMES - entry->Frame) < 0) {
+          return;
+        }
+        DEBUG_SCREEN_prepare(cmd == NEXT_SCREEN);
+        entry->Prepared = 1;
+        return;
+      }
+      if (DEBUG_SCREEN_isPreparing()) {
+        return;
+      }
+      // Another screen change dropped it before it was shown
+      entry->Status = STATUS_INCOMPLETE;
+    } else {
+      if ((int32_t) (DISP_getFrameCount() - entry->Frame) < 0) {
+        return;
+      }
+      entry->Status = API_execute(entry->Packet, 0);
+    }
+
+    entry->ExecutedFrame = DISP_getFrameCount();
+    deferExec = (deferExec + 1) % DEFER_QUEUE_SIZE;
   }
 }
 
-void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart) {
-  if (huart->Instance != uartHandle->Instance) {
+/**
+ * DEFERRED_RESULT - [command u8][status u8][frame u32][executed frame u32],
+ * sent with the sequence id of the SCHEDULE packet
+ */
+static void API_sendDeferredResults(void) {
+  uint8_t seq = currentSeq;
+
+  while (deferTail != deferExec) {
+    API_DeferredTypeDef *entry = &deferQueue[deferTail];
+
+    uint8_t data[12] = {
+        DEFERRED_RESULT,
+        10,
+        entry->Packet[0],
+        entry->Status,
+    };
+
+    writeU32(&data[4], entry->Frame);
+    writeU32(&data[8], entry->ExecutedFrame);
+
+    currentSeq = entry->Packet[SEQ_OFFSET];
+    API_transmit(data, 12);
+    deferTail = (deferTail + 1) % DEFER_QUEUE_SIZE;
+  }
+
+  currentSeq = seq;
+}
+
+static void API_parsePacket(const uint8_t *packet) {
+  uint8_t crcCorrect = checkCrc(packet);
+  if (!crcCorrect) {
     return;
   }
 
-  rxDataReady = 1;
+  currentSeq = packet[SEQ_OFFSET];
+
+  if (batchOpen && packet[0] != BATCH_COMMIT && packet[0] != BATCH_BEGIN) {
+    if (batchSize < BATCH_MAX_SIZE) {
+      memcpy(batchPackets[batchSize], packet, PACKET_SIZE);
+      batchSize++;
+    } else {
+      batchOverflow = 1;
+    }
+    return;
+  }
+
+  API_execute(packet, 1);
+}
+
+/**
+ * Drains the whole queue, events of packets handled by an earlier call find it empty
+ */
+static void API_onPacket(const EVENT_TypeDef *event) {
+  UNUSED(event);
+
+  uint8_t *packet;
+  while ((packet = SPSC_front(&rxQueue)) != NULL) {
+    API_parsePacket(packet);
+    SPSC_release(&rxQueue);
+  }
+}
+
+uint8_t API_isIdle(void) {
+  return SPSC_isEmpty(&rxQueue) && !CAPTURE_isActive() && deferTail == deferExec;
+}
+
+void API_Tick(void) {
+  API_runDeferred();
+  API_sendDeferredResults();
+
+  if (CAPTURE_isActive()) {
+    API_streamScreenshot();
+  }
 }
@@ -0,0 +1,50 @@
+#include "api_transport.h"
+#include "api.h"
+
+#define TX_BUFFER_SIZE 1024
+
+static uint8_t txBuffer[TX_BUFFER_SIZE];
+static uint16_t txHead = 0;
+static uint16_t txTail = 0;
+
+static HAL_StatusTypeDef LOOPBACK_start(void) {
+  txHead = 0;
+  txTail = 0;
+  return HAL_OK;
+}
+
+static HAL_StatusTypeDef LOOPBACK_transmit(const uint8_t *data, uint16_t size) {
+  for (uint16_t i = 0; i < size; i++) {
+    uint16_t next = (txHead + 1) % TX_BUFFER_SIZE;
+    if (next == txTail) {
+      return HAL_ERROR;
+    }
+    txBuffer[txHead] = data[i];
+    txHead = next;
+  }
+  return HAL_OK;
+}
+
+static const API_TransportTypeDef loopbackTransport = {
+    .start = LOOPBACK_start,
+    .transmit = LOOPBACK_transmit,
+    .isBaudRateSupported = NULL,
+    .setBaudRate = NULL,
+};
+
+const API_TransportTypeDef *API_TRANSPORT_loopback(void) {
+  return &loopbackTransport;
+}
+
+void API_TRANSPORT_loopbackWrite(const uint8_t *data, uint16_t size) {
+  API_receive(data, size);
+}
+
+uint16_t API_TRANSPORT_loopbackRead(uint8_t *data, uint16_t size) {
+  uint16_t count = 0;
+  while (count < size && txTail != txHead) {
+    data[count++] = txBuffer[txTail];
+    txTail = (txTail + 1) % TX_BUFFER_SIZE;
+  }
+  return count;
+}
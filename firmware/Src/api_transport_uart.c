@@ -0,0 +1,113 @@
+#include "api_transport.h"
+#include "api.h"
+
+#define RX_BUFFER_SIZE 256
+#define TX_TIMEOUT 2000
+
+static const uint32_t supportedBaudRates[] = {
+    115200,
+    230400,
+    460800,
+    921600,
+    1000000,
+    2000000,
+    3000000,
+};
+
+static UART_HandleTypeDef *uartHandle;
+static uint8_t rxBuffer[RX_BUFFER_SIZE];
+static uint16_t rxPos = 0;
+
+static HAL_StatusTypeDef UART_start(void) {
+  rxPos = 0;
+  HAL_StatusTypeDef status = HAL_UARTEx_ReceiveToIdle_DMA(uartHandle, rxBuffer, RX_BUFFER_SIZE);
+  // Half transfer events are not needed, idle and transfer complete flush the buffer often enough
+  __HAL_DMA_DISABLE_IT(uartHandle->hdmarx, DMA_IT_HT);
+  return status;
+}
+
+static HAL_StatusTypeDef UART_transmit(const uint8_t *data, uint16_t size) {
+  return HAL_UART_Transmit(uartHandle, (uint8_t *) data, size, TX_TIMEOUT);
+}
+
+static uint32_t UART_getPclk(void) {
+  return uartHandle->Instance == USART1 || uartHandle->Instance == USART6 ? HAL_RCC_GetPCLK2Freq()
+                                                                          : HAL_RCC_GetPCLK1Freq();
+}
+
+static uint8_t UART_isBaudRateSupported(uint32_t baudRate) {
+  if (baudRate > UART_getPclk() / 8) {
+    return 0;
+  }
+
+  for (uint32_t i = 0; i < sizeof(supportedBaudRates) / sizeof(supportedBaudRates[0]); i++) {
+    if (supportedBaudRates[i] == baudRate) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Must be called once the last reply has left the shift register,
+ * HAL_UART_Transmit returns only after the TC flag is set.
+ */
+static HAL_StatusTypeDef UART_setBaudRate(uint32_t baudRate) {
+  if (!UART_isBaudRateSupported(baudRate)) {
+    return HAL_ERROR;
+  }
+
+  HAL_UART_AbortReceive(uartHandle);
+
+  uartHandle->Init.BaudRate = baudRate;
+  uartHandle->Init.OverSampling = baudRate > UART_getPclk() / 16 ? UART_OVERSAMPLING_8 : UART_OVERSAMPLING_16;
+  if (HAL_UART_Init(uartHandle) != HAL_OK) {
+    return HAL_ERROR;
+  }
+
+  return UART_start();
+}
+
+static const API_TransportTypeDef uartTransport = {
+    .start = UART_start,
+    .transmit = UART_transmit,
+    .isBaudRateSupported = UART_isBaudRateSupported,
+    .setBaudRate = UART_setBaudRate,
+};
+
+const API_TransportTypeDef *API_TRANSPORT_uart(UART_HandleTypeDef *huart) {
+  uartHandle = huart;
+  return &uartTransport;
+}
+
+/**
+ * Size is the write position of the DMA in the circular buffer.
+ */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size) {
+  if (huart->Instance != uartHandle->Instance) {
+    return;
+  }
+
+  if (Size < rxPos) {
+    API_receive(&rxBuffer[rxPos], RX_BUFFER_SIZE - rxPos);
+    rxPos = 0;
+  }
+
+  if (Size > rxPos) {
+    API_receive(&rxBuffer[rxPos], Size - rxPos);
+  }
+
+  rxPos = Size == RX_BUFFER_SIZE ? 0 : Size;
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) {
+  if (huart->Instance != uartHandle->Instance) {
+    return;
+  }
+
+  // Reception is stopped on errors, drop whatever is in flight and restart at a packet boundary
+  __HAL_UART_CLEAR_OREFLAG(huart);
+  HAL_UART_AbortReceive(uartHandle);
+  API_resetReceive();
+  UART_start();
+}
@@ -0,0 +1,111 @@
+#include "bandwidth.h"
+
+// LTDC fetches 64 byte AHB bursts, 32 transfers on the 16 bit SDRAM bus
+#define LTDC_BURST_HALFWORDS 32
+#define SDRAM_BANK 1
+
+static BANDWIDTH_PolicyTypeDef policy = BANDWIDTH_POLICY_WARN;
+static uint8_t drawReservePercent = 25;
+
+static const uint8_t bytesPerPixel[] = {
+    4, // ARGB8888
+    3, // RGB888
+    2, // RGB565
+    2, // ARGB1555
+    2, // ARGB4444
+    1, // L8
+    1, // AL44
+    2, // AL88
+};
+
+/**
+ * Every burst pays the CAS latency and read pipe delay, every row
+ * change a precharge and activate, refresh steals tRC per refresh period.
+ */
+static uint32_t BANDWIDTH_sdramAvailable(void) {
+  uint32_t sdcr1 = FMC_Bank5_6->SDCR[0];
+  uint32_t sdcr = FMC_Bank5_6->SDCR[SDRAM_BANK];
+  uint32_t sdtr1 = FMC_Bank5_6->SDTR[0];
+  uint32_t sdtr = FMC_Bank5_6->SDTR[SDRAM_BANK];
+
+  uint32_t sdclkDiv = (sdcr1 & FMC_SDCR1_SDCLK) >> FMC_SDCR1_SDCLK_Pos;
+  if (sdclkDiv < 2) {
+    return 0;
+  }
+
+  uint32_t sdclk = HAL_RCC_GetHCLKFreq() / sdclkDiv;
+  uint32_t cas = (sdcr & FMC_SDCR1_CAS) >> FMC_SDCR1_CAS_Pos;
+  uint32_t rpipe = (sdcr1 & FMC_SDCR1_RPIPE) >> FMC_SDCR1_RPIPE_Pos;
+  uint32_t rowHalfwords = 256U << ((sdcr & FMC_SDCR1_NC) >> FMC_SDCR1_NC_Pos);
+  uint32_t trp = ((sdtr1 & FMC_SDTR1_TRP) >> FMC_SDTR1_TRP_Pos) + 1;
+  uint32_t trc = ((sdtr1 & FMC_SDTR1_TRC) >> FMC_SDTR1_TRC_Pos) + 1;
+  uint32_t trcd = ((sdtr & FMC_SDTR1_TRCD) >> FMC_SDTR1_TRCD_Pos) + 1;
+  uint32_t refreshPeriod = ((FMC_Bank5_6->SDRTR & FMC_SDRTR_COUNT) >> FMC_SDRTR_COUNT_Pos) + 1;
+
+  uint32_t rowCycles = rowHalfwords / LTDC_BURST_HALFWORDS * (LTDC_BURST_HALFWORDS + cas + rpipe) + trp + trcd;
+  uint64_t available = (uint64_t) sdclk * 2 * rowHalfwords / rowCycles;
+
+  return (uint32_t) (available - available * trc / refreshPeriod);
+}
+
+/**
+ * Bytes fetched per line by the enabled layers, the first layer spans
+ * the image width, a second one its window.
+ */
+static uint32_t BANDWIDTH_bytesPerLine(const DISP_LTDC_ConfigTypeDef *cfg) {
+  uint32_t bytes = cfg->ImageWidth * bytesPerPixel[LTDC_Layer1->PFCR & LTDC_LxPFCR_PF];
+
+  if (LTDC_Layer2->CR & LTDC_LxCR_LEN) {
+    uint32_t start = LTDC_Layer2->WHPCR & LTDC_LxWHPCR_WHSTPOS;
+    uint32_t stop = (LTDC_Layer2->WHPCR & LTDC_LxWHPCR_WHSPPOS) >> LTDC_LxWHPCR_WHSPPOS_Pos;
+    if (stop >= start) {
+      bytes += (stop - start + 1) * bytesPerPixel[LTDC_Layer2->PFCR & LTDC_LxPFCR_PF];
+    }
+  }
+
+  return bytes;
+}
+
+BANDWIDTH_EstimateTypeDef BANDWIDTH_estimate(const DISP_LTDC_ConfigTypeDef *cfg, uint32_t pixelClock) {
+  BANDWIDTH_EstimateTypeDef estimate = {0};
+
+  uint32_t activeWidth = cfg->AccumulatedActiveW - cfg->AccumulatedHBP;
+  uint32_t totalPixels = (cfg->TotalWidth + 1) * (cfg->TotalHeight + 1);
+  uint32_t bytesPerLine = BANDWIDTH_bytesPerLine(cfg);
+
+  estimate.Available = BANDWIDTH_sdramAvailable();
+  estimate.DrawReserve = estimate.Available / 100 * drawReservePercent;
+
+  if (activeWidth > 0 && totalPixels > 0) {
+    // A line worth of data is fetched within the active part of the line
+    estimate.ScanoutPeak = (uint32_t) ((uint64_t) pixelClock * bytesPerLine / activeWidth);
+    estimate.ScanoutAverage = (uint32_t) ((uint64_t) pixelClock * bytesPerLine * cfg->ImageHeight / totalPixels);
+  }
+
+  estimate.Headroom = (int32_t) estimate.Available - (int32_t) estimate.ScanoutPeak - (int32_t) estimate.DrawReserve;
+
+  return estimate;
+}
+
+BANDWIDTH_ResultTypeDef BANDWIDTH_check(const BANDWIDTH_EstimateTypeDef *estimate) {
+  if (estimate->Headroom < 0) {
+    return BANDWIDTH_EXCEEDED;
+  }
+  if ((uint32_t) estimate->Headroom < estimate->Available / 100 * BANDWIDTH_LOW_HEADROOM_PERCENT) {
+    return BANDWIDTH_LOW;
+  }
+  return BANDWIDTH_OK;
+}
+
+void BANDWIDTH_setPolicy(BANDWIDTH_PolicyTypeDef p, uint8_t reservePercent) {
+  policy = p;
+  drawReservePercent = reservePercent > 100 ? 100 : reservePercent;
+}
+
+BANDWIDTH_PolicyTypeDef BANDWIDTH_getPolicy(void) {
+  return policy;
+}
+
+uint8_t BANDWIDTH_getDrawReservePercent(void) {
+  return drawReservePercent;
+}
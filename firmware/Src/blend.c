@@ -0,0 +1,104 @@
+#include "blend.h"
+#include "pixel.h"
+#include "tile.h"
+#include "disp.h"
+
+#define BLEND_TIMEOUT 50
+
+#define CCM_START 0x10000000U
+#define CCM_END 0x10010000U
+
+#define DMA2D_IFCR_ALL (DMA2D_IFCR_CTEIF | DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTWIF | DMA2D_IFCR_CAECIF | \
+                        DMA2D_IFCR_CCTCIF | DMA2D_IFCR_CCEIF)
+
+// FGPFCCR color modes
+#define DMA2D_CM_ARGB8888 0x0U
+#define DMA2D_CM_RGB565 0x2U
+#define DMA2D_CM_ARGB4444 0x4U
+
+uint8_t BLEND_getPixelSize(BLEND_FormatTypeDef format) {
+  return format == BLEND_ARGB8888 ? 4 : 2;
+}
+
+void BLEND_row(uint16_t *dst, const void *src, BLEND_FormatTypeDef format, uint8_t alpha, uint32_t count) {
+  switch (format) {
+    case BLEND_RGB565: {
+      PIXEL_blend(dst, src, dst, alpha, count);
+      break;
+    }
+    case BLEND_ARGB4444: {
+      PIXEL_blendArgb4444(dst, src, alpha, count);
+      break;
+    }
+    case BLEND_ARGB8888: {
+      PIXEL_blendArgb8888(dst, src, alpha, count);
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+}
+
+void BLEND_rectCpu(uint16_t *dst, uint32_t dstStride, const void *src, uint32_t srcStride,
+                   BLEND_FormatTypeDef format, uint8_t alpha, uint16_t width, uint16_t height) {
+  uint32_t srcRowBytes = srcStride * BLEND_getPixelSize(format);
+
+  for (uint16_t y = 0; y < height; y++) {
+    DISP_throttle();
+    BLEND_row(&dst[y * dstStride], (const uint8_t *) src + y * srcRowBytes, format, alpha, width);
+  }
+}
+
+/**
+ * Foreground is the source, background and output the destination rect
+ */
+HAL_StatusTypeDef BLEND_rect(uint16_t *dst, uint32_t dstStride, const void *src, uint32_t srcStride,
+                             BLEND_FormatTypeDef format, uint8_t alpha, uint16_t width, uint16_t height) {
+  if (width == 0 || height == 0) {
+    return HAL_OK;
+  }
+
+  if ((uint32_t) src >= CCM_START && (uint32_t) src < CCM_END) {
+    BLEND_rectCpu(dst, dstStride, src, srcStride, format, alpha, width, height);
+    return HAL_OK;
+  }
+
+  // DMA2D is shared with the tile flush
+  TILE_wait();
+
+  uint32_t fgpfccr = DMA2D_CM_RGB565 | DMA2D_FGPFCCR_AM_0 | (uint32_t) alpha << DMA2D_FGPFCCR_ALPHA_Pos;
+  if (format != BLEND_RGB565) {
+    fgpfccr = (format == BLEND_ARGB8888 ? DMA2D_CM_ARGB8888 : DMA2D_CM_ARGB4444) |
+              (alpha == 255 ? 0 : DMA2D_FGPFCCR_AM_1 | (uint32_t) alpha << DMA2D_FGPFCCR_ALPHA_Pos);
+  }
+
+  DMA2D->IFCR = DMA2D_IFCR_ALL;
+  DMA2D->CR = DMA2D_CR_MODE_1; // memory to memory with blending
+  DMA2D->FGMAR = (uint32_t) src;
+  DMA2D->FGOR = srcStride - width;
+  DMA2D->FGPFCCR = fgpfccr;
+  DMA2D->BGMAR = (uint32_t) dst;
+  DMA2D->BGOR = dstStride - width;
+  DMA2D->BGPFCCR = DMA2D_BGPFCCR_CM_1; // RGB565
+  DMA2D->OMAR = (uint32_t) dst;
+  DMA2D->OOR = dstStride - width;
+  DMA2D->OPFCCR = DMA2D_OPFCCR_CM_1;
+  DMA2D->NLR = ((uint32_t) width << DMA2D_NLR_PL_Pos) | height;
+
+  DISP_throttle();
+
+  DMA2D->CR |= DMA2D_CR_START;
+
+  uint32_t start = HAL_GetTick();
+  while (DMA2D->CR & DMA2D_CR_START) {
+    if (HAL_GetTick() - start > BLEND_TIMEOUT) {
+      DMA2D->CR |= DMA2D_CR_ABORT;
+      return HAL_TIMEOUT;
+    }
+  }
+
+  uint32_t isr = DMA2D->ISR;
+  DMA2D->IFCR = DMA2D_IFCR_ALL;
+  return isr & (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF) ? HAL_ERROR : HAL_OK;
+}
@@ -0,0 +1,117 @@
+#include "capture.h"
+#include "disp.h"
+#include "upload.h"
+
+#define OP_SHIFT 6
+#define OP_EXTENDED 0x20
+#define OP_COUNT_MASK 0x1F
+#define OP_COUNT_BITS 5
+#define OP_MAX_COUNT 8192
+#define LITERAL_MAX_COUNT 32
+#define MIN_RUN 3
+
+static uint8_t active = 0;
+static uint32_t pageAddr;
+static uint32_t stride;
+static uint16_t rectX;
+static uint16_t rectY;
+static uint16_t rectWidth;
+static uint32_t pos;
+static uint32_t total;
+
+static uint16_t CAPTURE_pixel(uint32_t i) {
+  uint32_t row = i / rectWidth;
+  uint32_t col = i - row * rectWidth;
+  uint32_t addr = pageAddr + ((rectY + row) * stride + rectX + col) * 2;
+  return DISP_SwapRedBlue(*(__IO uint16_t *) addr);
+}
+
+static uint32_t CAPTURE_runLength(uint32_t i, uint32_t max) {
+  uint16_t color = CAPTURE_pixel(i);
+  uint32_t n = 1;
+  while (i + n < total && n < max && CAPTURE_pixel(i + n) == color) {
+    n++;
+  }
+  return n;
+}
+
+uint8_t CAPTURE_begin(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+  uint32_t screenWidth = DISP_getScreenWidth();
+  uint32_t screenHeight = DISP_getScreenHeight();
+
+  if (width == 0 || height == 0 || x + width > screenWidth || y + height > screenHeight) {
+    active = 0;
+    return 0;
+  }
+
+  pageAddr = DISP_getPageAddress(DISP_getActivePage());
+  stride = screenWidth;
+  rectX = x;
+  rectY = y;
+  rectWidth = width;
+  pos = 0;
+  total = (uint32_t) width * height;
+  active = 1;
+  return 1;
+}
+
+uint8_t CAPTURE_read(uint8_t *data, uint8_t size) {
+  uint8_t n = 0;
+
+  while (active && pos < total) {
+    uint32_t run = CAPTURE_runLength(pos, OP_MAX_COUNT);
+    uint16_t color = CAPTURE_pixel(pos);
+
+    if (run >= MIN_RUN) {
+      uint32_t count = run - 1;
+      uint8_t opSize = count > OP_COUNT_MASK ? 4 : 3;
+      if (n + opSize > size) {
+        break;
+      }
+
+      if (count > OP_COUNT_MASK) {
+        data[n++] = UPLOAD_OP_RUN << OP_SHIFT | OP_EXTENDED | (count & OP_COUNT_MASK);
+        data[n++] = count >> OP_COUNT_BITS;
+      } else {
+        data[n++] = UPLOAD_OP_RUN << OP_SHIFT | count;
+      }
+      data[n++] = color & 0xFF;
+      data[n++] = color >> 8;
+      pos += run;
+      continue;
+    }
+
+    // Literals stop where the next run starts, kept short enough to never span reads
+    uint32_t max = (size - n - 1) / 2;
+    if (max > LITERAL_MAX_COUNT) {
+      max = LITERAL_MAX_COUNT;
+    }
+    if (max == 0) {
+      break;
+    }
+
+    uint32_t count = 0;
+    while (count < max && pos + count < total &&
+           (count == 0 || CAPTURE_runLength(pos + count, MIN_RUN) < MIN_RUN)) {
+      count++;
+    }
+
+    data[n++] = UPLOAD_OP_LITERAL << OP_SHIFT | (count - 1);
+    for (uint32_t i = 0; i < count; i++) {
+      color = CAPTURE_pixel(pos + i);
+      data[n++] = color & 0xFF;
+      data[n++] = color >> 8;
+    }
+    pos += count;
+  }
+
+  if (n == 0) {
+    active = 0;
+  }
+
+  return n;
+}
+
+uint8_t CAPTURE_isActive(void) {
+  return active;
+}
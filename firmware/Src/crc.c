@@ -0,0 +1,59 @@
+#include "crc.h"
+
+// NDTR is 16 bit and must stay a multiple of two halfwords
+#define DMA_MAX_HALFWORDS 0xFFFE
+#define DMA_TIMEOUT 100
+
+static DMA_HandleTypeDef *dma;
+
+static const uint32_t nibbleTable[16] = {
+    0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9,
+    0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+    0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61,
+    0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
+};
+
+uint32_t CRC_calc(uint32_t crc, const uint8_t *data, uint32_t size) {
+  for (uint32_t i = 0; i < size; i++) {
+    crc ^= (uint32_t) data[i] << 24;
+    crc = (crc << 4) ^ nibbleTable[crc >> 28];
+    crc = (crc << 4) ^ nibbleTable[crc >> 28];
+  }
+  return crc;
+}
+
+void CRC_hwInit(DMA_HandleTypeDef *hdma) {
+  dma = hdma;
+  __HAL_RCC_CRC_CLK_ENABLE();
+}
+
+void CRC_hwReset(void) {
+  CRC->CR = CRC_CR_RESET;
+}
+
+HAL_StatusTypeDef CRC_hwFeed16(uint32_t addr, uint32_t count) {
+  while (count >= 2) {
+    uint32_t n = count > DMA_MAX_HALFWORDS ? DMA_MAX_HALFWORDS : count & ~1UL;
+
+    // Polled, the stream has no interrupt enabled that could clear the flags first
+    if (HAL_DMA_Start(dma, addr, (uint32_t) &CRC->DR, n) != HAL_OK) {
+      return HAL_ERROR;
+    }
+    if (HAL_DMA_PollForTransfer(dma, HAL_DMA_FULL_TRANSFER, DMA_TIMEOUT) != HAL_OK) {
+      return HAL_ERROR;
+    }
+
+    addr += n * 2;
+    count -= n;
+  }
+
+  if (count) {
+    CRC->DR = *(__IO uint16_t *) addr;
+  }
+
+  return HAL_OK;
+}
+
+uint32_t CRC_hwResult(void) {
+  return CRC->DR;
+}
@@ -1,15 +1,43 @@
+#include <math.h>
+#include <string.h>
 #include "debug_screen.h"
 #include "disp.h"
 #include "nec_decode.h"
+#include "event.h"
+#include "render.h"
+#include "tile.h"
+#include "pattern.h"
+#include "scale.h"
+#include "rotate.h"
+#include "blend.h"
+#include "vector.h"
+#include "adv7393.h"
+#include "dlist.h"
+#include "mfd.h"
+#include "anim.h"
 
-#include "philips_pm5544_320_240.h"
-#include "smpte_color_bars_320_240.h"
 #include "screen_mfd_single_317_186.h"
 #include "screen_mfd_multi_317_185.h"
 #include "picture.h"
+#include "font_mono_12.h"
+#include "font_mono_bold_16.h"
 
 #define SCREEN_INIT 0
-#define SCREEN_MAX 12
+#define SCREEN_STATUS 19
+#define SCREEN_GEOMETRY 20
+#define SCREEN_TEST_CARD 21
+#define SCREEN_MFD 22
+#define SCREEN_MOVING_BARS 23
+#define SCREEN_SCROLLING_ZONE_PLATE 24
+#define SCREEN_MAX 25
+#define SCREEN_LIST 0xFE // an uploaded display list, outside of the prev / next cycle
+#define SCREEN_EXTERNAL 0xFD // a page drawn outside of the debug screen, e.g. by an upload
+
+// Screen switch rendered ahead of time to a page that is not shown
+#define PREPARE_NONE 0
+#define PREPARE_RENDERING 1
+#define PREPARE_READY 2
+#define PREPARE_SHOWN 3 // flipped at vblank, taken over as the current screen by DEBUG_SCREEN_tick
 
 #define NEC_ADDR 0x87
 #define NEC_CMD_JC 0x1E
@@ -26,33 +54,150 @@
 #define NEC_CMD_5 0x05
 #define NEC_CMD_6 0x04
 #define NEC_CMD_7 0x40
+#define NEC_CMD_NONE 0xFF
+
+#define MARKER_SIZE 48
+#define MARKER_RADIUS 20.0f
+
+#define STAR_POINTS 10
+#define SPOKES 8
+
+#define STATUS_FIELDS 9
+#define STATUS_LENGTH 24
+#define STATUS_TOP 32
+#define STATUS_VALUE_X 104
+
+#define MFD_WIDTH 317
+#define MFD_HEIGHT 186
+
+#define MOTION_SCREENS 2
+#define MOTION_SPEED 2 // pixels per frame
+#define MOTION_BAR 16
+
+#define NEC_DEBOUNCE_MS 150
+#define NEC_REPEAT_DELAY_MS 400
+#define NEC_REPEAT_INTERVAL_MS 200
 
 static RNG_HandleTypeDef *rngHandle;
 static TIM_HandleTypeDef *htimHandle;
 static NEC nec;
 static uint8_t currentScreen = 0xFF;
 static uint8_t nextScreen = SCREEN_INIT;
+static uint8_t restartScreen = 0; // rebuilt by the tick even though it is already shown
+
+static uint16_t marker[MARKER_SIZE * MARKER_SIZE];
+static VECTOR_PointTypeDef star[STAR_POINTS];
+
+static uint8_t listSlot;
+
+static volatile uint8_t prepareState = PREPARE_NONE;
+static uint8_t preparedScreen;
+static uint8_t preparedPage;
+
+static uint8_t motionSpeed = MOTION_SPEED;
+static uint32_t motionBudgetUs = 0;
+static uint32_t motionPosition;
+static char motionText[12];
+
+/**
+ * Test card kept in flash as a display list, laid out for 360x240
+ */
+static const uint8_t testCard[] = {
+    DLIST_OP_PALETTE, DLIST_COLOR_GRAY, 1, DLIST_U16(0x2104),
+    DLIST_OP_FILL, DLIST_COLOR_GRAY,
+    // Bars, 75% colors replaced by the full ones
+    DLIST_OP_RECT, DLIST_U16(0), DLIST_U16(24), DLIST_U16(44), DLIST_U16(63), DLIST_COLOR_WHITE,
+    DLIST_OP_RECT, DLIST_U16(45), DLIST_U16(24), DLIST_U16(89), DLIST_U16(63), DLIST_COLOR_YELLOW,
+    DLIST_OP_RECT, DLIST_U16(90), DLIST_U16(24), DLIST_U16(134), DLIST_U16(63), DLIST_COLOR_CYAN,
+    DLIST_OP_RECT, DLIST_U16(135), DLIST_U16(24), DLIST_U16(179), DLIST_U16(63), DLIST_COLOR_GREEN,
+    DLIST_OP_RECT, DLIST_U16(180), DLIST_U16(24), DLIST_U16(224), DLIST_U16(63), DLIST_COLOR_MAGENTA,
+    DLIST_OP_RECT, DLIST_U16(225), DLIST_U16(24), DLIST_U16(269), DLIST_U16(63), DLIST_COLOR_RED,
+    DLIST_OP_RECT, DLIST_U16(270), DLIST_U16(24), DLIST_U16(314), DLIST_U16(63), DLIST_COLOR_BLUE,
+    DLIST_OP_RECT, DLIST_U16(315), DLIST_U16(24), DLIST_U16(359), DLIST_U16(63), DLIST_COLOR_BLACK,
+    // Gray steps
+    DLIST_OP_RECT, DLIST_U16(0), DLIST_U16(64), DLIST_U16(44), DLIST_U16(79), DLIST_COLOR_GRAY + 1,
+    DLIST_OP_RECT, DLIST_U16(45), DLIST_U16(64), DLIST_U16(89), DLIST_U16(79), DLIST_COLOR_GRAY + 2,
+    DLIST_OP_RECT, DLIST_U16(90), DLIST_U16(64), DLIST_U16(134), DLIST_U16(79), DLIST_COLOR_GRAY + 3,
+    DLIST_OP_RECT, DLIST_U16(135), DLIST_U16(64), DLIST_U16(179), DLIST_U16(79), DLIST_COLOR_GRAY + 4,
+    DLIST_OP_RECT, DLIST_U16(180), DLIST_U16(64), DLIST_U16(224), DLIST_U16(79), DLIST_COLOR_GRAY + 5,
+    DLIST_OP_RECT, DLIST_U16(225), DLIST_U16(64), DLIST_U16(269), DLIST_U16(79), DLIST_COLOR_GRAY + 6,
+    DLIST_OP_RECT, DLIST_U16(270), DLIST_U16(64), DLIST_U16(314), DLIST_U16(79), DLIST_COLOR_GRAY + 7,
+    DLIST_OP_RECT, DLIST_U16(315), DLIST_U16(64), DLIST_U16(359), DLIST_U16(79), DLIST_COLOR_WHITE,
+    // Circle with a crosshair
+    DLIST_OP_CIRCLE, DLIST_U16(180), DLIST_U16(160), DLIST_U16(70), 0, DLIST_COLOR_WHITE,
+    DLIST_OP_LINE, DLIST_U16(100), DLIST_U16(160), DLIST_U16(260), DLIST_U16(160), 1, DLIST_COLOR_WHITE,
+    DLIST_OP_LINE, DLIST_U16(180), DLIST_U16(86), DLIST_U16(180), DLIST_U16(234), 1, DLIST_COLOR_WHITE,
+    DLIST_OP_CIRCLE, DLIST_U16(180), DLIST_U16(160), DLIST_U16(6), 1, DLIST_COLOR_RED,
+    DLIST_OP_POLYGON, 3, DLIST_COLOR_YELLOW,
+    DLIST_U16(30), DLIST_U16(225), DLIST_U16(60), DLIST_U16(95), DLIST_U16(90), DLIST_U16(225),
+    DLIST_OP_LINE, DLIST_U16(110), DLIST_U16(100), DLIST_U16(250), DLIST_U16(220), 4, DLIST_COLOR_GREEN,
+    DLIST_OP_BLIT_SCALED, DLIST_ASSET_FOX, DLIST_U16(280), DLIST_U16(100), DLIST_U16(60), DLIST_U16(80),
+    SCALE_BILINEAR,
+    DLIST_OP_TEXT, DLIST_FONT_MONO_BOLD_16, DLIST_U16(8), DLIST_U16(3), DLIST_COLOR_WHITE, DLIST_COLOR_GRAY, 0,
+    'D', 'i', 's', 'p', 'l', 'a', 'y', ' ', 'l', 'i', 's', 't', 0,
+    DLIST_OP_END,
+};
+
+static const char *const statusLabels[STATUS_FIELDS] = {
+    "Pixel clock", "Active", "Total", "Sync", "Back porch", "Front porch", "Frame rate", "FSC", "Frame",
+};
+static char statusShown[STATUS_FIELDS][STATUS_LENGTH];
+static uint32_t statusFrame;
+static uint32_t statusFsc;
 
-static volatile uint16_t nec_address;
-static volatile uint8_t nec_cmd;
-static volatile uint8_t nec_need_read = 0;
-static volatile uint8_t nec_error = 0;
-static volatile uint8_t nec_repeat = 0;
-static uint32_t nec_time = 0;
+static uint8_t nec_last_cmd = NEC_CMD_NONE;
+static uint32_t nec_frame_time = 0;
+static uint32_t nec_press_time = 0;
+static uint32_t nec_step_time = 0;
 
 void myNecDecodedCallback(uint16_t address, uint8_t cmd);
 void myNecErrorCallback(void);
 void myNecRepeatCallback();
 
+static void necOnEvent(const EVENT_TypeDef *event);
+
+/**
+ * Yellow ring with a center dot in ARGB4444, edge pixels get the alpha of their coverage
+ */
+static void initMarker(void) {
+  float center = (MARKER_SIZE - 1) / 2.0f;
+
+  for (uint16_t y = 0; y < MARKER_SIZE; y++) {
+    for (uint16_t x = 0; x < MARKER_SIZE; x++) {
+      float d = sqrtf((x - center) * (x - center) + (y - center) * (y - center));
+      float ring = 1.5f - fabsf(d - MARKER_RADIUS);
+      float dot = 3.0f - d;
+      float coverage = ring > dot ? ring : dot;
+      if (coverage < 0.0f) coverage = 0.0f;
+      if (coverage > 1.0f) coverage = 1.0f;
+
+      // Framebuffer channel order, the red nibble is the lowest
+      marker[y * MARKER_SIZE + x] = (uint16_t) ((uint16_t) (coverage * 15.0f + 0.5f) << 12 | 0x00FF);
+    }
+  }
+}
+
+/**
+ * Boost gauge of the single MFD screen, widget coordinates are on the 317x186 bitmap.
+ * Values are kPa, the needle runs from -50 at the bottom clockwise to 200 on the right.
+ */
+static void initMfd(void) {
+  MFD_clear();
+  MFD_gauge(179, 38, 110, 110, -50, 200, 180, 270, 0xFA20);
+  MFD_readout(252, 156, &font_mono_12, 5, 2, -50, 200, DISP_COLOR_WHITE);
+  MFD_bar(50, 4, 100, 6, 0, 100, 0, 0x07E0);
+  MFD_bar(140, 20, 8, 128, -50, 200, 1, 0xFA20);
+}
+
 void DEBUG_SCREEN_init(RNG_HandleTypeDef *h, TIM_HandleTypeDef *ht) {
   rngHandle = h;
   htimHandle = ht;
 
-  init_philips_pm5544_320_240();
-  init_smpte_color_bars_320_240();
   init_screen_mfd_single_317x186();
   init_screen_mfd_multi_317_185();
   init_fox_240x320();
+  initMarker();
+  initMfd();
 
   nec.timerHandle = ht;
   nec.timerChannel = TIM_CHANNEL_1;
@@ -63,171 +208,620 @@ void DEBUG_SCREEN_init(RNG_HandleTypeDef *h, TIM_HandleTypeDef *ht) {
   nec.NEC_DecodedCallback = myNecDecodedCallback;
   nec.NEC_ErrorCallback = myNecErrorCallback;
   nec.NEC_RepeatCallback = myNecRepeatCallback;
+
+  EVENT_subscribe(EVENT_NEC_DECODED, necOnEvent);
+  EVENT_subscribe(EVENT_NEC_REPEAT, necOnEvent);
+  EVENT_subscribe(EVENT_NEC_ERROR, necOnEvent);
+
   NEC_Read(&nec);
 }
 
-static void necTick() {
-  if (nec_need_read) {
-    nec_need_read = 0;
-
-    // TODO: handle with separate timer
-    if (HAL_GetTick() - nec_time > 10) {
-      nec_time = HAL_GetTick();
-
-      if (nec_error) {
-        // handle error
-        nec_error = 0;
-        HAL_Delay(10);
-      } else if (nec_repeat) {
-        // handle repeat
-        nec_repeat = 0;
-        HAL_Delay(10);
-      } else if (nec_address == NEC_ADDR) {
-        switch (nec_cmd) {
-          case NEC_CMD_JR:
-          case NEC_CMD_JB: {
-            DEBUG_SCREEN_next();
-            break;
-          }
-          case NEC_CMD_JL:
-          case NEC_CMD_JT:{
-            DEBUG_SCREEN_prev();
-            break;
-          }
-          case NEC_CMD_1: {
-            nextScreen = 0;
-            break;
-          }
-          case NEC_CMD_2: {
-            nextScreen = 1;
-            break;
-          }
-          case NEC_CMD_3: {
-            nextScreen = 2;
-            break;
-          }
-          case NEC_CMD_4: {
-            nextScreen = 3;
-            break;
-          }
-          case NEC_CMD_5: {
-            nextScreen = 4;
-            break;
-          }
-          case NEC_CMD_6: {
-            nextScreen = 5;
-            break;
-          }
-          case NEC_CMD_7: {
-            nextScreen = 6;
-            break;
-          }
-          default: {
-            break;
-          }
-        }
-      }
+static void necCommand(uint8_t cmd) {
+  switch (cmd) {
+    case NEC_CMD_JR:
+    case NEC_CMD_JB: {
+      DEBUG_SCREEN_next();
+      break;
+    }
+    case NEC_CMD_JL:
+    case NEC_CMD_JT:{
+      DEBUG_SCREEN_prev();
+      break;
+    }
+    case NEC_CMD_1: {
+      nextScreen = 0;
+      break;
+    }
+    case NEC_CMD_2: {
+      nextScreen = 1;
+      break;
+    }
+    case NEC_CMD_3: {
+      nextScreen = 2;
+      break;
+    }
+    case NEC_CMD_4: {
+      nextScreen = 3;
+      break;
+    }
+    case NEC_CMD_5: {
+      nextScreen = 4;
+      break;
+    }
+    case NEC_CMD_6: {
+      nextScreen = 5;
+      break;
+    }
+    case NEC_CMD_7: {
+      nextScreen = 6;
+      break;
+    }
+    default: {
+      break;
     }
-
-    NEC_Read(&nec);
   }
 }
 
-void DEBUG_SCREEN_tick() {
-  necTick();
+static uint8_t necIsStep(uint8_t cmd) {
+  return cmd == NEC_CMD_JR || cmd == NEC_CMD_JB || cmd == NEC_CMD_JL || cmd == NEC_CMD_JT;
+}
 
-  if (currentScreen != nextScreen) {
-    switch (nextScreen) {
-      case 0: {
-        DISP_drawRects(DISP_getScreenWidth(), DISP_getScreenHeight(), 10);
-        break;
-      }
-      case 1: {
-        DISP_drawRects(DISP_getScreenWidth(), DISP_getScreenHeight(), 4);
-        break;
-      }
-      case 2: {
-        DISP_drawRects(DISP_getScreenWidth(), DISP_getScreenHeight(), 1);
-        break;
-      }
-      case 3: {
-        DISP_FillScreen(DISP_COLOR_RED);
-        break;
-      }
-      case 4: {
-        DISP_FillScreen(DISP_COLOR_GREEN);
-        break;
-      }
-      case 5: {
-        DISP_FillScreen(DISP_COLOR_BLUE);
-        break;
-      }
-      case 6: {
-        DISP_FillScreen(DISP_COLOR_BLUE);
-        DISP_DrawBitmap(get_philips_pm5544_320_240(), 320, 240, 0, 1);
-        break;
-      }
-      case 7: {
-        DISP_FillScreen(DISP_COLOR_RED);
-        DISP_DrawBitmap(get_smpte_color_bars_320_240(), 320, 240, 0, 1);
-        break;
-      }
-      case 8: {
-        DISP_FillScreen(DISP_COLOR_BLACK);
-        DISP_DrawBitmap(get_screen_mfd_single_317x186(), 317, 186, 0, 1);
+/**
+ * Holding a next / prev key steps through the screens once the repeat delay has passed.
+ * Remotes resending the whole frame while held count as a single press.
+ */
+static void necOnEvent(const EVENT_TypeDef *event) {
+  uint32_t now = HAL_GetTick();
+
+  switch (event->Type) {
+    case EVENT_NEC_DECODED: {
+      uint16_t address = event->Arg >> 8;
+      uint8_t cmd = event->Arg & 0xFF;
+
+      if (address != NEC_ADDR) {
+        nec_last_cmd = NEC_CMD_NONE;
         break;
       }
-      case 9: {
-        DISP_FillScreen(DISP_COLOR_BLACK);
-        DISP_DrawBitmap(get_screen_mfd_multi_317_185(), 317, 185, 0, 1);
+
+      if (cmd == nec_last_cmd && now - nec_frame_time < NEC_DEBOUNCE_MS) {
+        nec_frame_time = now;
         break;
       }
-      case 10: {
-        DISP_FillScreen(DISP_COLOR_RED);
-        DISP_DrawBitmap(get_fox_240x320(), 240, 320, 1, 0);
-        break;
+
+      nec_last_cmd = cmd;
+      nec_frame_time = now;
+      nec_press_time = now;
+      nec_step_time = now;
+      necCommand(cmd);
+      break;
+    }
+    case EVENT_NEC_REPEAT: {
+      nec_frame_time = now;
+      if (necIsStep(nec_last_cmd) && now - nec_press_time >= NEC_REPEAT_DELAY_MS &&
+          now - nec_step_time >= NEC_REPEAT_INTERVAL_MS) {
+        nec_step_time = now;
+        necCommand(nec_last_cmd);
       }
-      case 11: {
-        for (uint16_t i = 0; i < 100; i++) {
-          DISP_FillRect(
-              HAL_RNG_GetRandomNumber(rngHandle) % DISP_getScreenWidth(),
-              HAL_RNG_GetRandomNumber(rngHandle) % DISP_getScreenHeight(),
-              HAL_RNG_GetRandomNumber(rngHandle) % DISP_getScreenWidth(),
-              HAL_RNG_GetRandomNumber(rngHandle) % DISP_getScreenHeight(),
-              (uint16_t) HAL_RNG_GetRandomNumber(rngHandle)
-          );
-
-          // HAL_Delay(10);
-        }
-        break;
+      break;
+    }
+    default: {
+      nec_last_cmd = NEC_CMD_NONE;
+      break;
+    }
+  }
+}
+
+/**
+ * Scales a stored image to the largest size with its aspect ratio that fits the active area, centered
+ */
+static void bitmapFit(uint16_t *bitmap, uint16_t width, uint16_t height, SCALE_FilterTypeDef filter) {
+  uint32_t screenWidth = DISP_getScreenWidth();
+  uint32_t screenHeight = DISP_getScreenHeight();
+
+  uint32_t w = screenWidth;
+  uint32_t h = (uint32_t) height * screenWidth / width;
+  if (h > screenHeight) {
+    h = screenHeight;
+    w = (uint32_t) width * screenHeight / height;
+  }
+
+  TILE_bitmapScaled(bitmap, width, height, (screenWidth - w) / 2, (screenHeight - h) / 2, w, h, filter);
+}
+
+/**
+ * Grid centered on the screen with cells of an eighth of its height, diagonals, a circle,
+ * a star and spokes of widths 1 to SPOKES, all sized from the resolution
+ */
+static void geometry(void) {
+  int16_t w = DISP_getScreenWidth();
+  int16_t h = DISP_getScreenHeight();
+  int16_t cell = h / 8;
+  int16_t cx = w / 2;
+  int16_t cy = h / 2;
+
+  TILE_fill(DISP_COLOR_BLACK);
+  for (int16_t x = cx % cell; x < w; x += cell) {
+    TILE_line(x, 0, x, h - 1, 1, DISP_COLOR_WHITE);
+  }
+  for (int16_t y = cy % cell; y < h; y += cell) {
+    TILE_line(0, y, w - 1, y, 1, DISP_COLOR_WHITE);
+  }
+  TILE_line(0, 0, w - 1, h - 1, 1, DISP_COLOR_GREEN);
+  TILE_line(w - 1, 0, 0, h - 1, 1, DISP_COLOR_GREEN);
+
+  TILE_circle(cx, cy, cell * 7 / 2, 0, DISP_COLOR_WHITE);
+  TILE_circle(cell / 2, cell / 2, cell / 2, 1, DISP_COLOR_RED);
+  TILE_circle(w - 1 - cell / 2, cell / 2, cell / 2, 1, DISP_COLOR_RED);
+  TILE_circle(cell / 2, h - 1 - cell / 2, cell / 2, 1, DISP_COLOR_RED);
+  TILE_circle(w - 1 - cell / 2, h - 1 - cell / 2, cell / 2, 1, DISP_COLOR_RED);
+
+  for (uint8_t i = 0; i < STAR_POINTS; i++) {
+    float angle = i * 2.0f * (float) M_PI / STAR_POINTS;
+    float radius = i & 1 ? cell * 0.8f : cell * 2.0f;
+    star[i].X = (int16_t) lroundf(cx + radius * sinf(angle));
+    star[i].Y = (int16_t) lroundf(cy - radius * cosf(angle));
+  }
+  TILE_polygon(star, STAR_POINTS, DISP_COLOR_RED | DISP_COLOR_GREEN);
+
+  for (uint8_t i = 0; i < SPOKES; i++) {
+    float angle = (i + 0.5f) * 2.0f * (float) M_PI / SPOKES;
+    TILE_line((int16_t) lroundf(cx + cell * 2.4f * sinf(angle)), (int16_t) lroundf(cy - cell * 2.4f * cosf(angle)),
+              (int16_t) lroundf(cx + cell * 3.2f * sinf(angle)), (int16_t) lroundf(cy - cell * 3.2f * cosf(angle)),
+              i + 1, DISP_COLOR_BLUE);
+  }
+}
+
+static char *formatU32(char *p, uint32_t value, uint8_t minDigits) {
+  char digits[10];
+  uint8_t count = 0;
+  do {
+    digits[count++] = (char) ('0' + value % 10);
+    value /= 10;
+  } while (value > 0 || count < minDigits);
+
+  while (count > 0) {
+    *p++ = digits[--count];
+  }
+  *p = 0;
+  return p;
+}
+
+static char *formatHex(char *p, uint32_t value) {
+  *p++ = '0';
+  *p++ = 'x';
+  for (int8_t shift = 28; shift >= 0; shift -= 4) {
+    *p++ = "0123456789ABCDEF"[value >> shift & 0x0F];
+  }
+  *p = 0;
+  return p;
+}
+
+static char *formatPair(char *p, uint32_t a, uint32_t b) {
+  p = formatU32(p, a, 1);
+  *p++ = ' ';
+  *p++ = 'x';
+  *p++ = ' ';
+  return formatU32(p, b, 1);
+}
+
+/**
+ * Live values of the status screen, only the glyphs that changed since the last update are redrawn,
+ * usually the last digits of the frame counter
+ */
+static void updateStatus(void) {
+  char values[STATUS_FIELDS][STATUS_LENGTH];
+  DISP_LTDC_ConfigTypeDef cfg = DISP_getCurrentCfg();
+  uint32_t pixelClock = DISP_getLtdcPixelClockFreq();
+  uint32_t totalWidth = cfg.TotalWidth + 1;
+  uint32_t totalHeight = cfg.TotalHeight + 1;
+  uint32_t milliHz = (uint32_t) ((uint64_t) pixelClock * 1000 / (totalWidth * totalHeight));
+  char *p;
+
+  p = formatU32(values[0], pixelClock / 1000000, 1);
+  *p++ = '.';
+  p = formatU32(p, pixelClock / 1000 % 1000, 3);
+  *p++ = ' ';
+  *p++ = 'M';
+  *p++ = 'H';
+  *p++ = 'z';
+  *p = 0;
+
+  formatPair(values[1], cfg.ImageWidth, cfg.ImageHeight);
+  formatPair(values[2], totalWidth, totalHeight);
+  formatPair(values[3], cfg.HorizontalSync + 1, cfg.VerticalSync + 1);
+  formatPair(values[4], cfg.AccumulatedHBP - cfg.HorizontalSync, cfg.AccumulatedVBP - cfg.VerticalSync);
+  formatPair(values[5], cfg.TotalWidth - cfg.AccumulatedActiveW, cfg.TotalHeight - cfg.AccumulatedActiveH);
+
+  p = formatU32(values[6], milliHz / 1000, 1);
+  *p++ = '.';
+  p = formatU32(p, milliHz % 1000, 3);
+  *p++ = ' ';
+  *p++ = 'H';
+  *p++ = 'z';
+  *p = 0;
+
+  formatHex(values[7], statusFsc);
+  formatU32(values[8], statusFrame, 1);
+
+  for (uint8_t i = 0; i < STATUS_FIELDS; i++) {
+    DISP_UpdateString(&font_mono_12, statusShown[i], values[i], STATUS_VALUE_X,
+                      STATUS_TOP + i * font_mono_12.Height, DISP_COLOR_WHITE, DISP_COLOR_BLACK);
+    memcpy(statusShown[i], values[i], STATUS_LENGTH);
+  }
+}
+
+/**
+ * Frame counter in the corner of the motion screens, a camera or a capture shows which frames were skipped
+ */
+static void motionFrame(uint32_t frame) {
+  formatU32(motionText, frame, 8);
+  TILE_text(&font_mono_12, motionText, 4, DISP_getScreenHeight() - font_mono_12.Height - 4, DISP_COLOR_WHITE,
+            DISP_COLOR_BLACK, 1);
+}
+
+/**
+ * Vertical bar sweeping right at motionSpeed pixels per frame and horizontal bar sweeping down at half that,
+ * over a grid. Judder shows as uneven steps against the grid lines.
+ */
+static void movingBars(uint32_t frame, uint32_t frames) {
+  uint16_t w = DISP_getScreenWidth();
+  uint16_t h = DISP_getScreenHeight();
+  uint16_t cell = h >= 8 ? h / 8 : 1;
+  // A bar as wide as the screen stays in place
+  uint16_t xRange = w > MOTION_BAR ? w - MOTION_BAR : 1;
+  uint16_t yRange = h > MOTION_BAR ? h - MOTION_BAR : 1;
+
+  motionPosition += frames * motionSpeed;
+  uint16_t x = motionPosition % xRange;
+  uint16_t y = motionPosition / 2 % yRange;
+
+  TILE_fill(DISP_COLOR_BLACK);
+  for (uint16_t i = cell; i < w; i += cell) {
+    TILE_rect(i, 0, i, h - 1, 0x4208);
+  }
+  for (uint16_t i = cell; i < h; i += cell) {
+    TILE_rect(0, i, w - 1, i, 0x4208);
+  }
+  TILE_rect(0, y, w - 1, y + MOTION_BAR - 1, DISP_COLOR_BLUE);
+  TILE_rect(x, 0, x + MOTION_BAR - 1, h - 1, DISP_COLOR_WHITE);
+  motionFrame(frame);
+}
+
+/**
+ * Zone plate moving up by motionSpeed rows per frame, every row is generated again each frame
+ */
+static void scrollingZonePlate(uint32_t frame, uint32_t frames) {
+  motionPosition += frames * motionSpeed;
+  TILE_patternScrolled(PATTERN_ZONE_PLATE, motionPosition % DISP_getScreenHeight());
+  motionFrame(frame);
+}
+
+/**
+ * Animation frames are drawn to the page that is not shown, without beam pacing, and switched
+ * to at the vblank after they are done, so a frame never tears. The other page loses its contents.
+ */
+static void renderFlipped(void) {
+  uint8_t page = DISP_getActivePage() ^ 1;
+  DISP_setDrawPage(page);
+  TILE_renderAll();
+  DISP_setDrawPage(DISP_PAGE_COUNT);
+  DISP_showPage(page);
+}
+
+static void updateMovingBars(uint32_t frame, uint32_t frames) {
+  TILE_clear();
+  movingBars(frame, frames);
+  renderFlipped();
+}
+
+static void updateScrollingZonePlate(uint32_t frame, uint32_t frames) {
+  TILE_clear();
+  scrollingZonePlate(frame, frames);
+  renderFlipped();
+}
+
+/**
+ * Primitives of a screen, rendered by the caller
+ */
+static void buildScreen(uint8_t screen) {
+  switch (screen) {
+    case 0: {
+      TILE_nestedRects(DISP_getScreenWidth(), DISP_getScreenHeight(), 10);
+      break;
+    }
+    case 1: {
+      TILE_nestedRects(DISP_getScreenWidth(), DISP_getScreenHeight(), 4);
+      break;
+    }
+    case 2: {
+      TILE_nestedRects(DISP_getScreenWidth(), DISP_getScreenHeight(), 1);
+      break;
+    }
+    case 3: {
+      TILE_fill(DISP_COLOR_RED);
+      break;
+    }
+    case 4: {
+      TILE_fill(DISP_COLOR_GREEN);
+      break;
+    }
+    case 5: {
+      TILE_fill(DISP_COLOR_BLUE);
+      break;
+    }
+    case 6: {
+      TILE_pattern(PATTERN_CIRCLE_CHART);
+      break;
+    }
+    case 7: {
+      TILE_pattern(PATTERN_SMPTE_BARS);
+      break;
+    }
+    case 8: {
+      TILE_fill(DISP_COLOR_BLACK);
+      bitmapFit(get_screen_mfd_single_317x186(), 317, 186, SCALE_BILINEAR);
+      break;
+    }
+    case 9: {
+      TILE_fill(DISP_COLOR_BLACK);
+      bitmapFit(get_screen_mfd_multi_317_185(), 317, 185, SCALE_NEAREST);
+      break;
+    }
+    case 10: {
+      // Portrait image turned to landscape, centered when the screen is larger
+      uint16_t x = DISP_getScreenWidth() > 320 ? (DISP_getScreenWidth() - 320) / 2 : 0;
+      uint16_t y = DISP_getScreenHeight() > 240 ? (DISP_getScreenHeight() - 240) / 2 : 0;
+      TILE_fill(DISP_COLOR_RED);
+      TILE_bitmapRotated(get_fox_240x320(), 240, 320, x, y, ROTATE_90, 0);
+      break;
+    }
+    case 11: {
+      // Drawn over the previous screen, it is read back from the framebuffer first
+      TILE_framebuffer();
+      for (uint16_t i = 0; i < 100; i++) {
+        TILE_rect(
+            HAL_RNG_GetRandomNumber(rngHandle) % DISP_getScreenWidth(),
+            HAL_RNG_GetRandomNumber(rngHandle) % DISP_getScreenHeight(),
+            HAL_RNG_GetRandomNumber(rngHandle) % DISP_getScreenWidth(),
+            HAL_RNG_GetRandomNumber(rngHandle) % DISP_getScreenHeight(),
+            (uint16_t) HAL_RNG_GetRandomNumber(rngHandle)
+        );
       }
-      case SCREEN_MAX: {
-        DISP_FillScreen((uint16_t) HAL_RNG_GetRandomNumber(rngHandle));
-        break;
+      break;
+    }
+    case 12: {
+      TILE_pattern(PATTERN_MULTIBURST);
+      break;
+    }
+    case 13: {
+      TILE_pattern(PATTERN_LUMA_RAMP);
+      break;
+    }
+    case 14: {
+      TILE_pattern(PATTERN_PLUGE);
+      break;
+    }
+    case 15: {
+      TILE_pattern(PATTERN_CROSSHATCH);
+      break;
+    }
+    case 16: {
+      TILE_pattern(PATTERN_CHECKERBOARD);
+      break;
+    }
+    case 17: {
+      TILE_pattern(PATTERN_ZONE_PLATE);
+      break;
+    }
+    case 18: {
+      // Overlay over a ramp, the corner markers also at half constant alpha
+      uint16_t w = DISP_getScreenWidth();
+      uint16_t h = DISP_getScreenHeight();
+      TILE_pattern(PATTERN_LUMA_RAMP);
+      TILE_bitmapBlend(marker, BLEND_ARGB4444, MARKER_SIZE, MARKER_SIZE, (w - MARKER_SIZE) / 2,
+                       (h - MARKER_SIZE) / 2, 255);
+      TILE_bitmapBlend(marker, BLEND_ARGB4444, MARKER_SIZE, MARKER_SIZE, w / 4 - MARKER_SIZE / 2,
+                       h / 4 - MARKER_SIZE / 2, 128);
+      TILE_bitmapBlend(marker, BLEND_ARGB4444, MARKER_SIZE, MARKER_SIZE, w * 3 / 4 - MARKER_SIZE / 2,
+                       h / 4 - MARKER_SIZE / 2, 128);
+      TILE_bitmapBlend(marker, BLEND_ARGB4444, MARKER_SIZE, MARKER_SIZE, w / 4 - MARKER_SIZE / 2,
+                       h * 3 / 4 - MARKER_SIZE / 2, 128);
+      TILE_bitmapBlend(marker, BLEND_ARGB4444, MARKER_SIZE, MARKER_SIZE, w * 3 / 4 - MARKER_SIZE / 2,
+                       h * 3 / 4 - MARKER_SIZE / 2, 128);
+      break;
+    }
+    case SCREEN_STATUS: {
+      // Labels only, the values are drawn over the finished screen by updateStatus
+      TILE_fill(DISP_COLOR_BLACK);
+      TILE_text(&font_mono_bold_16, "LTDC status", 8, 8, DISP_COLOR_WHITE, DISP_COLOR_BLACK, 0);
+      for (uint8_t i = 0; i < STATUS_FIELDS; i++) {
+        TILE_text(&font_mono_12, statusLabels[i], 8, STATUS_TOP + i * font_mono_12.Height, 0x8410, DISP_COLOR_BLACK,
+                  0);
+        statusShown[i][0] = 0;
       }
-      default: {
-        break;
+      statusFsc = ADV7393_readFsc();
+      statusFrame = DISP_getFrameCount() - 1;
+      break;
+    }
+    case SCREEN_GEOMETRY: {
+      geometry();
+      break;
+    }
+    case SCREEN_TEST_CARD: {
+      DLIST_build(testCard, sizeof(testCard));
+      break;
+    }
+    case SCREEN_MFD: {
+      // Widgets are drawn over it by MFD_tick once the screen is done
+      uint16_t x = DISP_getScreenWidth() > MFD_WIDTH ? (DISP_getScreenWidth() - MFD_WIDTH) / 2 : 0;
+      uint16_t y = DISP_getScreenHeight() > MFD_HEIGHT ? (DISP_getScreenHeight() - MFD_HEIGHT) / 2 : 0;
+      TILE_fill(DISP_COLOR_BLACK);
+      TILE_bitmapRotated(get_screen_mfd_single_317x186(), MFD_WIDTH, MFD_HEIGHT, x, y, ROTATE_0, 0);
+      MFD_setBackground(get_screen_mfd_single_317x186(), MFD_WIDTH, MFD_HEIGHT, x, y);
+      break;
+    }
+    case SCREEN_MOVING_BARS: {
+      // The first frame is rendered as any screen, ANIM_tick takes over once it is done
+      motionPosition = 0;
+      movingBars(DISP_getFrameCount(), 0);
+      ANIM_start(updateMovingBars, motionBudgetUs);
+      break;
+    }
+    case SCREEN_SCROLLING_ZONE_PLATE: {
+      motionPosition = 0;
+      scrollingZonePlate(DISP_getFrameCount(), 0);
+      ANIM_start(updateScrollingZonePlate, motionBudgetUs);
+      break;
+    }
+    case SCREEN_LIST: {
+      // Built from SDRAM again on every reInit, so it follows config changes
+      if (DLIST_buildSlot(listSlot) != DLIST_OK) {
+        TILE_clear();
+        TILE_fill(DISP_COLOR_BLACK);
       }
+      break;
+    }
+    case SCREEN_MAX: {
+      TILE_fill((uint16_t) HAL_RNG_GetRandomNumber(rngHandle));
+      break;
     }
+    default: {
+      break;
+    }
+  }
+}
 
+/**
+ * Drawing goes to the shown page again, returns the state it was in. A screen the vblank
+ * callback has just flipped to is shown whatever the caller does next.
+ */
+static uint8_t endPrepare(void) {
+  __disable_irq();
+  uint8_t state = prepareState;
+  prepareState = PREPARE_NONE;
+  __enable_irq();
+
+  if (state != PREPARE_NONE) {
+    DISP_setDrawPage(DISP_PAGE_COUNT);
+  }
+  return state;
+}
+
+/**
+ * Screens are composed in SRAM by the tile renderer and drawn a band per render step,
+ * a screen change drops whatever is left of the previous one and of a prepared one.
+ */
+static void startScreen(uint8_t screen) {
+  endPrepare();
+
+  ANIM_stop();
+  RENDER_cancel();
+  TILE_clear();
+  // Rendering even an empty screen would clear the page
+  if (screen == SCREEN_EXTERNAL) {
+    return;
+  }
+  buildScreen(screen);
+  RENDER_tiles();
+}
+
+static uint8_t screenAfter(uint8_t screen) {
+  return screen >= SCREEN_MAX ? 0 : screen + 1;
+}
+
+static uint8_t screenBefore(uint8_t screen) {
+  return screen == 0 || screen > SCREEN_MAX ? SCREEN_MAX : screen - 1;
+}
+
+void DEBUG_SCREEN_tick() {
+  NEC_Poll(&nec);
+
+  if (prepareState == PREPARE_SHOWN) {
+    endPrepare();
+    nextScreen = preparedScreen;
+    currentScreen = preparedScreen;
+    restartScreen = 0;
+  }
+
+  if (currentScreen != nextScreen || restartScreen) {
+    restartScreen = 0;
+    startScreen(nextScreen);
     currentScreen = nextScreen;
   }
+
+  RENDER_tick(RENDER_BUDGET_US);
+
+  // The shown screen is left as it is until the prepared one replaces it
+  if (prepareState != PREPARE_NONE) {
+    if (prepareState == PREPARE_RENDERING && RENDER_isIdle()) {
+      TILE_wait();
+      prepareState = PREPARE_READY;
+    }
+    return;
+  }
+
+  if (currentScreen == SCREEN_STATUS && RENDER_isIdle() && DISP_getFrameCount() != statusFrame) {
+    statusFrame = DISP_getFrameCount();
+    updateStatus();
+  }
+
+  if (currentScreen == SCREEN_MFD && RENDER_isIdle()) {
+    MFD_tick();
+  }
+
+  if (RENDER_isIdle()) {
+    ANIM_tick();
+  }
 }
 
 void DEBUG_SCREEN_prev(void) {
-  if (nextScreen == 0) {
-    nextScreen = SCREEN_MAX;
-  } else {
-    nextScreen--;
-  }
+  nextScreen = screenBefore(nextScreen);
 }
 
 void DEBUG_SCREEN_next(void) {
-  if (nextScreen == SCREEN_MAX) {
-    nextScreen = 0;
-  } else {
-    nextScreen++;
+  nextScreen = screenAfter(nextScreen);
+}
+
+/**
+ * Pages 0 / 1 and 2 / 3 are the pairs animations flip between, the prepared screen goes to the other pair
+ */
+void DEBUG_SCREEN_prepare(uint8_t next) {
+  uint8_t screen = next ? screenAfter(nextScreen) : screenBefore(nextScreen);
+
+  ANIM_stop();
+  RENDER_cancel();
+  TILE_clear();
+
+  preparedScreen = screen;
+  preparedPage = DISP_getActivePage() ^ 2;
+  DISP_setDrawPage(preparedPage);
+  buildScreen(screen);
+  RENDER_tiles();
+  prepareState = PREPARE_RENDERING;
+}
+
+void DEBUG_SCREEN_cancelPrepared(void) {
+  uint8_t state = endPrepare();
+  if (state == PREPARE_RENDERING) {
+    RENDER_cancel();
+  } else if (state == PREPARE_SHOWN) {
+    nextScreen = preparedScreen;
+    currentScreen = preparedScreen;
+  }
+}
+
+uint8_t DEBUG_SCREEN_isPreparing(void) {
+  return prepareState != PREPARE_NONE;
+}
+
+uint8_t DEBUG_SCREEN_showPrepared(void) {
+  if (prepareState != PREPARE_READY) {
+    return 0;
   }
+
+  DISP_showPage(preparedPage);
+  prepareState = PREPARE_SHOWN;
+  return 1;
 }
 
 void DEBUG_SCREEN_reInit(void) {
@@ -235,20 +829,51 @@ void DEBUG_SCREEN_reInit(void) {
   currentScreen = 0xFF;
 }
 
+void DEBUG_SCREEN_showList(uint8_t slot, uint8_t rendered) {
+  ANIM_stop();
+  listSlot = slot;
+  nextScreen = SCREEN_LIST;
+  if (rendered) {
+    currentScreen = SCREEN_LIST;
+  }
+}
+
+void DEBUG_SCREEN_showExternal(void) {
+  endPrepare();
+  ANIM_stop();
+  RENDER_cancel();
+  restartScreen = 0;
+  nextScreen = SCREEN_EXTERNAL;
+  currentScreen = SCREEN_EXTERNAL;
+}
+
+uint8_t DEBUG_SCREEN_animate(uint8_t animation, uint8_t speed, uint32_t budgetUs) {
+  if (animation >= MOTION_SCREENS) {
+    return 0;
+  }
+
+  motionSpeed = speed ? speed : MOTION_SPEED;
+  motionBudgetUs = budgetUs;
+  nextScreen = SCREEN_MOVING_BARS + animation;
+  // Already running, restarted for the new budget
+  restartScreen = currentScreen == nextScreen;
+  return 1;
+}
+
+uint8_t DEBUG_SCREEN_isIdle(void) {
+  return currentScreen == nextScreen && !restartScreen && RENDER_isIdle();
+}
+
 void myNecDecodedCallback(uint16_t address, uint8_t cmd) {
-  nec_address = address;
-  nec_cmd = cmd;
-  nec_need_read = 1;
+  EVENT_post(EVENT_SOURCE_IR, EVENT_NEC_DECODED, (uint32_t) address << 8 | cmd);
 }
 
 void myNecErrorCallback() {
-  nec_error = 1;
-  nec_need_read = 1;
+  EVENT_post(EVENT_SOURCE_IR, EVENT_NEC_ERROR, 0);
 }
 
 void myNecRepeatCallback() {
-  nec_repeat = 1;
-  nec_need_read = 1;
+  EVENT_post(EVENT_SOURCE_IR, EVENT_NEC_REPEAT, 0);
 }
 
 void HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef *htim) {
@@ -256,3 +881,9 @@ void HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef *htim) {
     NEC_TIM_IC_CaptureCallback(&nec);
   }
 }
+
+void HAL_TIM_IC_CaptureHalfCpltCallback(TIM_HandleTypeDef *htim) {
+  if (htim == htimHandle) {
+    NEC_TIM_IC_CaptureCallback(&nec);
+  }
+}
@@ -5,18 +5,54 @@
 #include "sdram.h"
 #include "ili9341_mod.h"
 #include "debug_screen.h"
-
-#define FRAME_BUFFER_ADDR SDRAM_BANK_ADDR
+#include "crc.h"
+#include "event.h"
+#include "tile.h"
+#include "scale.h"
+#include "rotate.h"
+#include "blend.h"
+#include "vector.h"
 
 #define swap(a, b) { int16_t t = a; a = b; b = t; }
 
 static LTDC_HandleTypeDef *ltdc;
+static uint8_t activePage = 0;
+static uint8_t drawPage = DISP_PAGE_COUNT; // none, drawing follows the shown page
+static volatile uint32_t frameCount = 0;
+static volatile uint8_t inVblank = 0;
+static volatile uint32_t vblankCycles = 0;
+
+// Config follow-ups left to the main loop by DISP_applyConfig from the vblank callback
+static volatile uint8_t pendingFsc = 0;
+static volatile uint8_t pendingReInit = 0;
+
+// Frames the automatic throttle stays engaged after an LTDC error
+#define THROTTLE_AUTO_FRAMES 50
+
+// Longest wait for the vblank line event, a frame is 20 ms at 50 Hz
+#define VBLANK_TIMEOUT 50
+
+static volatile uint32_t underrunFrames = 0;
+static volatile uint32_t transferErrorFrames = 0;
+static volatile uint32_t lastErrorFrame = 0;
+static DISP_ThrottleTypeDef throttleMode = DISP_THROTTLE_OFF;
+static volatile uint8_t throttled = 0;
+static volatile uint32_t throttleUntilFrame = 0;
+
+static DISP_ChecksumWatchTypeDef watch = {0};
+static uint32_t watchNextFrame = 0;
+
+static void DISP_onVblank(const EVENT_TypeDef *event);
 
 void DISP_FillScreen(uint16_t color) {
   uint32_t i;
-  uint32_t n = ltdc->LayerCfg[0].ImageHeight * ltdc->LayerCfg[0].ImageWidth;
+  uint32_t width = ltdc->LayerCfg[0].ImageWidth;
+  uint32_t n = ltdc->LayerCfg[0].ImageHeight * width;
   for (i = 0; i < n; i++) {
-    *(__IO uint16_t *) (ltdc->LayerCfg[0].FBStartAdress + (i * 2)) = DISP_SwapRedBlue(color);
+    if (i % width == 0) {
+      DISP_throttle();
+    }
+    *(__IO uint16_t *) (DISP_getDrawAddress() + (i * 2)) = DISP_SwapRedBlue(color);
   }
 }
 
@@ -33,10 +69,11 @@ void DISP_FillRect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
   if (y2 >= screenHeight) y2 = screenHeight - 1;
 
   uint16_t swappedColor = DISP_SwapRedBlue(color);
-  uint32_t startAddr = ltdc->LayerCfg[0].FBStartAdress;
+  uint32_t startAddr = DISP_getDrawAddress();
   uint32_t imgWidth = ltdc->LayerCfg[0].ImageWidth;
 
   for (uint32_t ypos = y1; ypos <= y2; ypos++) {
+    DISP_throttle();
     uint32_t rowAddr = startAddr + (2 * ypos * imgWidth) + (2 * x1);
     for (uint32_t xpos = x1; xpos <= x2; xpos++) {
       *(__IO uint16_t *)(rowAddr) = swappedColor;
@@ -46,18 +83,27 @@ void DISP_FillRect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
 }
 
 void DISP_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint16_t color) {
-  *(__IO uint16_t *) (ltdc->LayerCfg[0].FBStartAdress +
+  *(__IO uint16_t *) (DISP_getDrawAddress() +
                       (2 * (Ypos * ltdc->LayerCfg[0].ImageWidth + Xpos))) = DISP_SwapRedBlue(color);
 }
 
 void DISP_DrawBitmap(uint16_t *ptr_image, uint16_t img_width, uint16_t img_height, uint8_t tile, uint8_t center) {
+  DISP_DrawBitmapRows(ptr_image, img_width, img_height, tile, center, 0, ltdc->LayerCfg[0].ImageHeight);
+}
+
+void DISP_DrawBitmapRows(uint16_t *ptr_image, uint16_t img_width, uint16_t img_height, uint8_t tile, uint8_t center,
+                         uint16_t first_row, uint16_t row_count) {
   uint16_t screen_width = ltdc->LayerCfg[0].ImageWidth;
   uint16_t screen_height = ltdc->LayerCfg[0].ImageHeight;
 
   int16_t offset_x = center && img_width < screen_width ? (screen_width - img_width) / 2 : 0;
   int16_t offset_y = center && img_height < screen_height ? (screen_height - img_height) / 2 : 0;
 
-  for (uint16_t y = 0; y < screen_height; y++) {
+  uint32_t end_row = (uint32_t) first_row + row_count;
+  if (end_row > screen_height) end_row = screen_height;
+
+  for (uint16_t y = first_row; y < end_row; y++) {
+    DISP_throttle();
     for (uint16_t x = 0; x < screen_width; x++) {
       uint16_t src_x = tile ? (x - offset_x) % img_width : (x - offset_x);
       uint16_t src_y = tile ? (y - offset_y) % img_height : (y - offset_y);
@@ -66,7 +112,7 @@ void DISP_DrawBitmap(uint16_t *ptr_image, uint16_t img_width, uint16_t img_heigh
         continue;
       }
 
-      uint32_t addr = ltdc->LayerCfg[0].FBStartAdress + (y * screen_width + x) * 2;
+      uint32_t addr = DISP_getDrawAddress() + (y * screen_width + x) * 2;
       uint16_t pixel = DISP_SwapRedBlue(ptr_image[src_y * img_width + src_x]);
 
       *(__IO uint16_t *) addr = pixel;
@@ -74,6 +120,155 @@ void DISP_DrawBitmap(uint16_t *ptr_image, uint16_t img_width, uint16_t img_heigh
   }
 }
 
+void DISP_DrawBitmapScaled(uint16_t *ptr_image, uint16_t img_width, uint16_t img_height, uint16_t x, uint16_t y,
+                           uint16_t width, uint16_t height, uint8_t filter) {
+  uint16_t screen_width = ltdc->LayerCfg[0].ImageWidth;
+  uint16_t screen_height = ltdc->LayerCfg[0].ImageHeight;
+
+  if (x >= screen_width || y >= screen_height ||
+      !SCALE_begin(ptr_image, img_width, img_height, width, height, filter)) {
+    return;
+  }
+
+  uint16_t visible_width = x + width > screen_width ? screen_width - x : width;
+  uint16_t visible_height = y + height > screen_height ? screen_height - y : height;
+
+  for (uint16_t row = 0; row < visible_height; row++) {
+    const uint16_t *src = SCALE_getRow(row);
+    DISP_throttle();
+
+    uint32_t addr = DISP_getDrawAddress() + ((uint32_t) (y + row) * screen_width + x) * 2;
+    for (uint16_t col = 0; col < visible_width; col++) {
+      *(__IO uint16_t *) (addr + col * 2) = src[col];
+    }
+  }
+}
+
+void DISP_DrawBitmapRotated(uint16_t *ptr_image, uint16_t img_width, uint16_t img_height, uint16_t x, uint16_t y,
+                            uint8_t rotation, uint8_t mirror) {
+  uint16_t screen_width = ltdc->LayerCfg[0].ImageWidth;
+  uint16_t screen_height = ltdc->LayerCfg[0].ImageHeight;
+
+  uint16_t width, height;
+  ROTATE_getSize(img_width, img_height, rotation, &width, &height);
+  if (x >= screen_width || y >= screen_height) {
+    return;
+  }
+
+  uint16_t visible_width = x + width > screen_width ? screen_width - x : width;
+  uint16_t visible_height = y + height > screen_height ? screen_height - y : height;
+  uint16_t *fb = (uint16_t *) DISP_getDrawAddress();
+
+  for (uint16_t row = 0; row < visible_height; row += ROTATE_BLOCK) {
+    uint16_t rows = visible_height - row < ROTATE_BLOCK ? visible_height - row : ROTATE_BLOCK;
+    DISP_throttle();
+    ROTATE_copy(ptr_image, img_width, img_height, rotation, mirror, 0, row, visible_width, rows,
+                &fb[(uint32_t) (y + row) * screen_width + x], screen_width);
+  }
+}
+
+void DISP_DrawBitmapBlend(const void *ptr_image, uint8_t format, uint16_t img_width, uint16_t img_height,
+                          uint16_t x, uint16_t y, uint8_t alpha) {
+  uint16_t screen_width = ltdc->LayerCfg[0].ImageWidth;
+  uint16_t screen_height = ltdc->LayerCfg[0].ImageHeight;
+
+  if (x >= screen_width || y >= screen_height) {
+    return;
+  }
+
+  uint16_t visible_width = x + img_width > screen_width ? screen_width - x : img_width;
+  uint16_t visible_height = y + img_height > screen_height ? screen_height - y : img_height;
+  uint16_t *fb = (uint16_t *) DISP_getDrawAddress();
+
+  BLEND_rect(&fb[(uint32_t) y * screen_width + x], screen_width, ptr_image, img_width, format, alpha,
+             visible_width, visible_height);
+}
+
+/**
+ * The shown layer as a vector target. Shapes take microseconds, so they wait for the tile
+ * renderer and the throttle once rather than per row.
+ */
+static VECTOR_TargetTypeDef DISP_beginVector(void) {
+  TILE_wait();
+  DISP_throttle();
+
+  VECTOR_TargetTypeDef target = {
+      .Buffer = (uint16_t *) DISP_getDrawAddress(),
+      .Stride = ltdc->LayerCfg[0].ImageWidth,
+      .X1 = 0,
+      .Y1 = 0,
+      .X2 = (int32_t) ltdc->LayerCfg[0].ImageWidth - 1,
+      .Y2 = (int32_t) ltdc->LayerCfg[0].ImageHeight - 1,
+  };
+  return target;
+}
+
+void DISP_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t width, uint16_t color) {
+  VECTOR_TargetTypeDef target = DISP_beginVector();
+  VECTOR_thickLine(&target, x1, y1, x2, y2, width, DISP_SwapRedBlue(color));
+}
+
+void DISP_DrawCircle(int16_t cx, int16_t cy, uint16_t radius, uint16_t color) {
+  VECTOR_TargetTypeDef target = DISP_beginVector();
+  VECTOR_circle(&target, cx, cy, radius, 0, DISP_SwapRedBlue(color));
+}
+
+void DISP_FillCircle(int16_t cx, int16_t cy, uint16_t radius, uint16_t color) {
+  VECTOR_TargetTypeDef target = DISP_beginVector();
+  VECTOR_circle(&target, cx, cy, radius, 1, DISP_SwapRedBlue(color));
+}
+
+void DISP_FillPolygon(const VECTOR_PointTypeDef *points, uint8_t count, uint16_t color) {
+  VECTOR_TargetTypeDef target = DISP_beginVector();
+  VECTOR_polygon(&target, points, count, DISP_SwapRedBlue(color));
+}
+
+/**
+ * Text rows in [x1, x2) of the screen, the text origin is at x, y
+ */
+static void DISP_drawStringRows(const FONT_TypeDef *font, const char *text, uint16_t x, uint16_t y, int32_t x1,
+                                int32_t x2, uint16_t color, uint16_t background, uint8_t opaque) {
+  uint16_t screen_width = ltdc->LayerCfg[0].ImageWidth;
+  uint16_t screen_height = ltdc->LayerCfg[0].ImageHeight;
+
+  if (x2 > screen_width) x2 = screen_width;
+  if (x1 >= x2 || y >= screen_height) {
+    return;
+  }
+
+  // The tile renderer may still be flushing over these rows
+  TILE_wait();
+
+  uint16_t rows = y + font->Height > screen_height ? screen_height - y : font->Height;
+  uint16_t *fb = (uint16_t *) DISP_getDrawAddress();
+  uint16_t swappedColor = DISP_SwapRedBlue(color);
+  uint16_t swappedBackground = DISP_SwapRedBlue(background);
+
+  for (uint16_t row = 0; row < rows; row++) {
+    DISP_throttle();
+    FONT_drawRow(font, text, row, &fb[(uint32_t) (y + row) * screen_width], x, x1, x2, swappedColor,
+                 swappedBackground, opaque);
+  }
+}
+
+void DISP_DrawString(const FONT_TypeDef *font, const char *text, uint16_t x, uint16_t y, uint16_t color,
+                     uint16_t background, uint8_t opaque) {
+  DISP_drawStringRows(font, text, x, y, x, x + FONT_measure(font, text), color, background, opaque);
+}
+
+DISP_RectTypeDef DISP_UpdateString(const FONT_TypeDef *font, const char *oldText, const char *newText, uint16_t x,
+                                   uint16_t y, uint16_t color, uint16_t background) {
+  DISP_RectTypeDef rect = {.X = x, .Y = y, .Width = 0, .Height = font->Height};
+  uint32_t x1, x2;
+
+  if (FONT_diff(font, oldText, newText, &x1, &x2)) {
+    rect.X = x + x1;
+    rect.Width = x2 - x1;
+    DISP_drawStringRows(font, newText, x, y, x + x1, x + x2, color, background, 1);
+  }
+  return rect;
+}
+
 /**
  * 0x001F - Blue channel bitmask
  * 0xF800 - Red channel bitmask
@@ -117,6 +312,14 @@ uint32_t DISP_getScreenHeight() {
   return ltdc->LayerCfg[0].ImageHeight;
 }
 
+uint32_t DISP_getDrawAddress(void) {
+  return drawPage < DISP_PAGE_COUNT ? DISP_getPageAddress(drawPage) : ltdc->LayerCfg[0].FBStartAdress;
+}
+
+void DISP_setDrawPage(uint8_t page) {
+  drawPage = page;
+}
+
 DISP_LTDC_ConfigTypeDef DISP_getCurrentCfg() {
   DISP_LTDC_ConfigTypeDef cfg = {
       .HorizontalSync = ltdc->Init.HorizontalSync,
@@ -147,10 +350,28 @@ uint32_t DISP_getLtdcPixelClockFreq(void) {
   ltdc_div = (RCC->DCKCFGR & RCC_DCKCFGR_PLLSAIDIVR) >> RCC_DCKCFGR_PLLSAIDIVR_Pos;
   uint32_t pllsai_vco_freq = (pllsai_source_freq / pllm) * pllsain;
   uint32_t pllsai_r_freq = pllsai_vco_freq / pllsair;
-  uint32_t ltdc_pixel_clock_freq = pllsai_r_freq / (ltdc_div == 0 ? 2 : (ltdc_div == 1 ? 4 : 8));
+  uint32_t ltdc_pixel_clock_freq = pllsai_r_freq / (2U << ltdc_div);
   return ltdc_pixel_clock_freq;
 }
 
+uint32_t DISP_getFramePeriodUs(void) {
+  DISP_LTDC_ConfigTypeDef cfg = DISP_getCurrentCfg();
+  uint32_t pixelClock = DISP_getLtdcPixelClockFreq();
+  if (pixelClock == 0) {
+    return 0;
+  }
+  return (uint32_t) ((uint64_t) (cfg.TotalWidth + 1) * (cfg.TotalHeight + 1) * 1000000U / pixelClock);
+}
+
+uint32_t DISP_calcPixelClockFreq(const DISP_LTDC_ClockConfigTypeDef *cfg) {
+  if (cfg->PLLM == 0 || cfg->PLLSAIR == 0) {
+    return 0;
+  }
+  uint32_t ltdc_div = cfg->PLLSAIDivR >> RCC_DCKCFGR_PLLSAIDIVR_Pos;
+  uint32_t pllsai_vco_freq = (cfg->OSCSourceValue / cfg->PLLM) * cfg->PLLSAIN;
+  return pllsai_vco_freq / cfg->PLLSAIR / (2U << ltdc_div);
+}
+
 static void DISP_updateFsc() {
   // Init FSC
   // Default for ntsc: 569408543 0x21F07C1F
@@ -180,16 +401,68 @@ static void DISP_updateFsc() {
   ADV7393_writeFsc(newFsc);
 }
 
-void DISP_init(SDRAM_HandleTypeDef *hsdram, LTDC_HandleTypeDef *hltdc, SPI_HandleTypeDef *hspi, I2C_HandleTypeDef *hi2c) {
+/**
+ * The vblank line event fires on the first line after the active area
+ */
+static uint32_t DISP_getVblankLine(void) {
+  uint32_t line = ltdc->Init.AccumulatedActiveH + 1;
+  if (line > ltdc->Init.TotalHeigh) {
+    line = ltdc->Init.TotalHeigh;
+  }
+  return line;
+}
+
+/**
+ * Registers are written directly, the handle may be locked when called from the line event
+ */
+static void DISP_programLineEvent(uint32_t line) {
+  __HAL_LTDC_DISABLE_IT(ltdc, LTDC_IT_LI);
+  ltdc->Instance->LIPCR = line;
+  __HAL_LTDC_ENABLE_IT(ltdc, LTDC_IT_LI);
+}
+
+static void DISP_programVblankEvent(void) {
+  DISP_programLineEvent(DISP_getVblankLine());
+}
+
+/**
+ * Same as HAL_LTDC_SetWindowSize_NoReload for the 16 bpp layer, without taking the handle lock.
+ * The window is placed relative to the back porch currently in BPCR.
+ */
+static void DISP_setWindowSize(uint32_t width, uint32_t height) {
+  LTDC_LayerCfgTypeDef *layer = &ltdc->LayerCfg[0];
+  uint32_t ahbp = (ltdc->Instance->BPCR & LTDC_BPCR_AHBP) >> 16U;
+  uint32_t avbp = ltdc->Instance->BPCR & LTDC_BPCR_AVBP;
+
+  layer->WindowX1 = layer->WindowX0 + width;
+  layer->WindowY1 = layer->WindowY0 + height;
+  layer->ImageWidth = width;
+  layer->ImageHeight = height;
+
+  LTDC_Layer1->WHPCR = ((layer->WindowX1 + ahbp) << 16U) | (layer->WindowX0 + ahbp + 1U);
+  LTDC_Layer1->WVPCR = ((layer->WindowY1 + avbp) << 16U) | (layer->WindowY0 + avbp + 1U);
+  LTDC_Layer1->CFBLR = ((width * 2U) << 16U) | (((layer->WindowX1 - layer->WindowX0) * 2U) + 3U);
+  LTDC_Layer1->CFBLNR = height;
+}
+
+void DISP_init(SDRAM_HandleTypeDef *hsdram, LTDC_HandleTypeDef *hltdc, SPI_HandleTypeDef *hspi, I2C_HandleTypeDef *hi2c,
+               DMA_HandleTypeDef *hdma) {
   ltdc = hltdc;
 
+  CRC_hwInit(hdma);
+  TILE_init();
+
   IS42S16400J_Init(hsdram);
   ILI9341_init(hspi);
   adv7393_init(hi2c);
 
   DISP_updateFsc();
 
-  HAL_LTDC_SetAddress(hltdc, FRAME_BUFFER_ADDR, LTDC_LAYER_1);
+  HAL_LTDC_SetAddress(hltdc, DISP_getPageAddress(activePage), LTDC_LAYER_1);
+
+  DISP_programVblankEvent();
+
+  EVENT_subscribe(EVENT_VBLANK, DISP_onVblank);
 }
 
 void DISP_reInit(DISP_LTDC_ConfigTypeDef *newCfg) {
@@ -225,12 +498,122 @@ void DISP_reInit(DISP_LTDC_ConfigTypeDef *newCfg) {
     Error_Handler();
   }
 
-  HAL_LTDC_SetAddress(ltdc, FRAME_BUFFER_ADDR, LTDC_LAYER_1);
+  HAL_LTDC_SetAddress(ltdc, DISP_getPageAddress(activePage), LTDC_LAYER_1);
+  DISP_programVblankEvent();
 
   DISP_updateFsc();
   DEBUG_SCREEN_reInit();
 }
 
+/**
+ * The image has to fit a page, a larger one would run into the next page
+ */
+static uint8_t DISP_isValidTiming(const DISP_LTDC_ConfigTypeDef *cfg) {
+  return cfg->HorizontalSync < cfg->AccumulatedHBP && cfg->AccumulatedHBP < cfg->AccumulatedActiveW &&
+         cfg->AccumulatedActiveW < cfg->TotalWidth && cfg->VerticalSync < cfg->AccumulatedVBP &&
+         cfg->AccumulatedVBP < cfg->AccumulatedActiveH && cfg->AccumulatedActiveH < cfg->TotalHeight &&
+         cfg->TotalWidth <= 0xFFF && cfg->TotalHeight <= 0x7FF && cfg->ImageWidth > 0 && cfg->ImageHeight > 0 &&
+         (uint64_t) cfg->ImageWidth * cfg->ImageHeight * 2 <= DISP_PAGE_SIZE;
+}
+
+/**
+ * Returns right after the vblank line event, the rest of the blanking
+ * interval is left for register writes.
+ */
+static void DISP_waitForVblank(void) {
+  uint32_t frame = frameCount;
+  uint32_t start = HAL_GetTick();
+  while (frameCount == frame && HAL_GetTick() - start < VBLANK_TIMEOUT) {
+  }
+}
+
+/**
+ * Timing registers are not shadowed and take effect on the next pixel,
+ * so every changed register is written together in vertical blanking.
+ * The layer window is placed relative to the back porch, it is rewritten
+ * after the timing and reloaded immediately while still in blanking.
+ * From the vblank callback the registers are written right away.
+ */
+HAL_StatusTypeDef DISP_applyConfig(DISP_LTDC_ConfigTypeDef *newCfg) {
+  if (!DISP_isValidTiming(newCfg)) {
+    return HAL_ERROR;
+  }
+
+  if (!(ltdc->Instance->GCR & LTDC_GCR_LTDCEN)) {
+    DISP_reInit(newCfg);
+    return HAL_OK;
+  }
+
+  // The diff is taken in blanking too, the vblank callback may have applied a scheduled config meanwhile
+  if (!inVblank) {
+    DISP_waitForVblank();
+  }
+  __disable_irq();
+
+  DISP_LTDC_ConfigTypeDef cfg = DISP_getCurrentCfg();
+
+  uint8_t syncChanged = newCfg->HorizontalSync != cfg.HorizontalSync || newCfg->VerticalSync != cfg.VerticalSync;
+  uint8_t backPorchChanged =
+      newCfg->AccumulatedHBP != cfg.AccumulatedHBP || newCfg->AccumulatedVBP != cfg.AccumulatedVBP;
+  uint8_t activeChanged =
+      newCfg->AccumulatedActiveW != cfg.AccumulatedActiveW || newCfg->AccumulatedActiveH != cfg.AccumulatedActiveH;
+  uint8_t totalChanged = newCfg->TotalWidth != cfg.TotalWidth || newCfg->TotalHeight != cfg.TotalHeight;
+  uint8_t imageChanged = newCfg->ImageWidth != cfg.ImageWidth || newCfg->ImageHeight != cfg.ImageHeight;
+
+  if (!syncChanged && !backPorchChanged && !activeChanged && !totalChanged && !imageChanged) {
+    __enable_irq();
+    return HAL_OK;
+  }
+
+  ltdc->Init.HorizontalSync = newCfg->HorizontalSync;
+  ltdc->Init.VerticalSync = newCfg->VerticalSync;
+  ltdc->Init.AccumulatedHBP = newCfg->AccumulatedHBP;
+  ltdc->Init.AccumulatedVBP = newCfg->AccumulatedVBP;
+  ltdc->Init.AccumulatedActiveW = newCfg->AccumulatedActiveW;
+  ltdc->Init.AccumulatedActiveH = newCfg->AccumulatedActiveH;
+  ltdc->Init.TotalWidth = newCfg->TotalWidth;
+  ltdc->Init.TotalHeigh = newCfg->TotalHeight;
+
+  if (syncChanged) {
+    ltdc->Instance->SSCR = (newCfg->HorizontalSync << 16U) | newCfg->VerticalSync;
+  }
+  if (backPorchChanged) {
+    ltdc->Instance->BPCR = (newCfg->AccumulatedHBP << 16U) | newCfg->AccumulatedVBP;
+  }
+  if (activeChanged) {
+    ltdc->Instance->AWCR = (newCfg->AccumulatedActiveW << 16U) | newCfg->AccumulatedActiveH;
+  }
+  if (totalChanged) {
+    ltdc->Instance->TWCR = (newCfg->TotalWidth << 16U) | newCfg->TotalHeight;
+  }
+  if (backPorchChanged || imageChanged) {
+    DISP_setWindowSize(newCfg->ImageWidth, newCfg->ImageHeight);
+    ltdc->Instance->SRCR = LTDC_SRCR_IMR;
+  }
+
+  __enable_irq();
+
+  if (activeChanged || totalChanged) {
+    DISP_programVblankEvent();
+  }
+
+  // I2C and rebuilding the screen are too long for the interrupt, DISP_onVblank does them
+  if (inVblank) {
+    pendingFsc |= totalChanged;
+    pendingReInit |= imageChanged;
+    return HAL_OK;
+  }
+
+  if (totalChanged) {
+    DISP_updateFsc();
+  }
+  if (imageChanged) {
+    DEBUG_SCREEN_reInit();
+  }
+
+  return HAL_OK;
+}
+
 void DISP_Set_Clock_Config(DISP_LTDC_ClockConfigTypeDef *cfg) {
   RCC_PeriphCLKInitTypeDef PeriphClkInitStruct = {0};
 
@@ -255,3 +638,250 @@ DISP_LTDC_ClockConfigTypeDef DISP_Get_Clock_Config(void) {
   };
   return cfg;
 }
+
+uint32_t DISP_getPageAddress(uint8_t page) {
+  return SDRAM_BANK_ADDR + page * DISP_PAGE_SIZE;
+}
+
+uint8_t DISP_getActivePage(void) {
+  return activePage;
+}
+
+/**
+ * The new address is latched into the shadow register and picked up
+ * at the next vertical blanking, so the switch never tears.
+ * From the vblank callback it is reloaded immediately, still inside the blanking.
+ * Drawing functions target the new page right away.
+ */
+void DISP_showPage(uint8_t page) {
+  if (page >= DISP_PAGE_COUNT) {
+    return;
+  }
+
+  activePage = page;
+
+  if (inVblank) {
+    ltdc->LayerCfg[0].FBStartAdress = DISP_getPageAddress(page);
+    LTDC_Layer1->CFBAR = DISP_getPageAddress(page);
+    ltdc->Instance->SRCR = LTDC_SRCR_IMR;
+    return;
+  }
+
+  HAL_LTDC_SetAddress_NoReload(ltdc, DISP_getPageAddress(page), LTDC_LAYER_1);
+  HAL_LTDC_Reload(ltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+}
+
+/**
+ * The single line event is shared: vblank always fires, the lines requested
+ * by DISP_LineCallback are scheduled in between. HAL disables the line interrupt
+ * after each event, it is re-enabled directly as the handle may be locked by
+ * the interrupted code.
+ */
+void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc) {
+  uint32_t line = hltdc->Instance->LIPCR & LTDC_LIPCR_LIPOS;
+  uint32_t vblankLine = DISP_getVblankLine();
+  uint8_t vblank = line == vblankLine;
+
+  if (vblank) {
+    vblankCycles = EVENT_cycles();
+    frameCount++;
+    __HAL_LTDC_ENABLE_IT(hltdc, LTDC_IT_FU | LTDC_IT_TE);
+
+    if (throttleMode == DISP_THROTTLE_AUTO && throttled && (int32_t) (frameCount - throttleUntilFrame) >= 0) {
+      throttled = 0;
+    }
+
+    inVblank = 1;
+    DISP_VblankCallback(frameCount);
+    inVblank = 0;
+
+    EVENT_post(EVENT_SOURCE_LTDC, EVENT_VBLANK, frameCount);
+
+    // A scheduled config may have changed the timings in the callback, the old vblank line can be past the
+    // new total height and would never fire again
+    vblankLine = DISP_getVblankLine();
+  }
+
+  uint32_t next = DISP_LineCallback(line, vblank);
+
+  // A line already passed would only fire in the next frame, in place of vblank
+  while (next != 0 && next < vblankLine) {
+    uint32_t scanline = DISP_getScanline();
+    if (scanline >= vblankLine || scanline < next) {
+      break;
+    }
+    next = DISP_LineCallback(scanline, 0);
+  }
+
+  DISP_programLineEvent(next != 0 && next < vblankLine ? next : vblankLine);
+}
+
+__weak void DISP_VblankCallback(uint32_t frame) {
+  UNUSED(frame);
+}
+
+__weak uint32_t DISP_LineCallback(uint32_t scanline, uint8_t vblank) {
+  UNUSED(scanline);
+  UNUSED(vblank);
+  return 0;
+}
+
+/**
+ * HAL disables the failing interrupt before calling back, an underrun
+ * would otherwise repeat on every line of the frame.
+ */
+void HAL_LTDC_ErrorCallback(LTDC_HandleTypeDef *hltdc) {
+  if (hltdc->ErrorCode & HAL_LTDC_ERROR_FU) {
+    underrunFrames++;
+  }
+  if (hltdc->ErrorCode & HAL_LTDC_ERROR_TE) {
+    transferErrorFrames++;
+  }
+  hltdc->ErrorCode = HAL_LTDC_ERROR_NONE;
+  lastErrorFrame = frameCount;
+
+  if (throttleMode == DISP_THROTTLE_AUTO) {
+    throttled = 1;
+    throttleUntilFrame = frameCount + THROTTLE_AUTO_FRAMES;
+  }
+}
+
+DISP_ErrorStatsTypeDef DISP_getErrorStats(void) {
+  DISP_ErrorStatsTypeDef stats = {
+      .UnderrunFrames = underrunFrames,
+      .TransferErrorFrames = transferErrorFrames,
+      .LastErrorFrame = lastErrorFrame,
+      .Frame = frameCount,
+      .Throttle = throttleMode,
+      .Throttled = throttled,
+  };
+  return stats;
+}
+
+void DISP_resetErrorStats(void) {
+  underrunFrames = 0;
+  transferErrorFrames = 0;
+  lastErrorFrame = 0;
+}
+
+void DISP_setThrottle(DISP_ThrottleTypeDef mode) {
+  throttleMode = mode;
+  throttled = mode == DISP_THROTTLE_ON;
+}
+
+uint8_t DISP_isThrottled(void) {
+  return throttled && (LTDC->CDSR & LTDC_CDSR_VDES);
+}
+
+void DISP_throttle(void) {
+  if (!throttled) {
+    return;
+  }
+
+  // VDES is cleared during vertical blanking
+  while ((LTDC->CDSR & LTDC_CDSR_VDES) && throttled) {
+  }
+}
+
+uint32_t DISP_getFrameCount(void) {
+  return frameCount;
+}
+
+uint32_t DISP_getVblankCycles(void) {
+  return vblankCycles;
+}
+
+uint16_t DISP_getScanline(void) {
+  return (LTDC->CPSR & LTDC_CPSR_CYPOS) >> LTDC_CPSR_CYPOS_Pos;
+}
+
+int32_t DISP_getBeamRow(void) {
+  if (!(LTDC->GCR & LTDC_GCR_LTDCEN)) {
+    return ltdc->LayerCfg[0].ImageHeight;
+  }
+
+  return (int32_t) DISP_getScanline() - (int32_t) DISP_getFirstImageLine();
+}
+
+uint32_t DISP_getFirstImageLine(void) {
+  // Line 0 is the start of vertical sync, the layer starts after the back porch
+  return ltdc->Init.AccumulatedVBP + 1U + ltdc->LayerCfg[0].WindowY0;
+}
+
+static DISP_RectTypeDef DISP_clipRect(DISP_RectTypeDef rect) {
+  uint16_t screenWidth = ltdc->LayerCfg[0].ImageWidth;
+  uint16_t screenHeight = ltdc->LayerCfg[0].ImageHeight;
+
+  if (rect.X >= screenWidth || rect.Y >= screenHeight) {
+    rect.Width = 0;
+    rect.Height = 0;
+    return rect;
+  }
+  if (rect.Width > screenWidth - rect.X) rect.Width = screenWidth - rect.X;
+  if (rect.Height > screenHeight - rect.Y) rect.Height = screenHeight - rect.Y;
+  return rect;
+}
+
+uint32_t DISP_frameChecksum(DISP_RectTypeDef rect) {
+  rect = DISP_clipRect(rect);
+
+  uint32_t imgWidth = ltdc->LayerCfg[0].ImageWidth;
+  uint32_t startAddr = DISP_getPageAddress(activePage) + (rect.Y * imgWidth + rect.X) * 2;
+
+  CRC_hwReset();
+
+  // Full even rows are contiguous and pack the same as row by row
+  if (rect.X == 0 && rect.Width == imgWidth && rect.Width % 2 == 0) {
+    if (CRC_hwFeed16(startAddr, (uint32_t) rect.Width * rect.Height) != HAL_OK) {
+      Error_Handler();
+    }
+    return CRC_hwResult();
+  }
+
+  for (uint32_t row = 0; row < rect.Height; row++) {
+    if (CRC_hwFeed16(startAddr + row * imgWidth * 2, rect.Width) != HAL_OK) {
+      Error_Handler();
+    }
+  }
+
+  return CRC_hwResult();
+}
+
+void DISP_watchChecksum(DISP_RectTypeDef rect, uint16_t interval) {
+  watch.Rect = DISP_clipRect(rect);
+  watch.Interval = interval;
+  watch.Checks = 0;
+  watch.Mismatches = 0;
+
+  if (interval) {
+    watch.Golden = DISP_frameChecksum(watch.Rect);
+    watch.Last = watch.Golden;
+    watchNextFrame = frameCount + interval;
+  }
+}
+
+DISP_ChecksumWatchTypeDef DISP_getChecksumWatch(void) {
+  return watch;
+}
+
+static void DISP_onVblank(const EVENT_TypeDef *event) {
+  UNUSED(event);
+
+  if (pendingFsc) {
+    pendingFsc = 0;
+    DISP_updateFsc();
+  }
+  if (pendingReInit) {
+    pendingReInit = 0;
+    DEBUG_SCREEN_reInit();
+  }
+
+  if (watch.Interval && (int32_t) (frameCount - watchNextFrame) >= 0) {
+    watch.Last = DISP_frameChecksum(watch.Rect);
+    watch.Checks++;
+    if (watch.Last != watch.Golden) {
+      watch.Mismatches++;
+    }
+    watchNextFrame = frameCount + watch.Interval;
+  }
+}
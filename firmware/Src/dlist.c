@@ -0,0 +1,342 @@
+#include <string.h>
+#include "dlist.h"
+#include "disp.h"
+#include "sdram.h"
+#include "tile.h"
+#include "pattern.h"
+#include "scale.h"
+#include "rotate.h"
+#include "crc.h"
+#include "picture.h"
+#include "screen_mfd_single_317_186.h"
+#include "screen_mfd_multi_317_185.h"
+#include "font_mono_12.h"
+#include "font_mono_bold_16.h"
+
+// Slots follow the framebuffer pages
+#define SLOTS_ADDR (SDRAM_BANK_ADDR + DISP_PAGE_COUNT * DISP_PAGE_SIZE)
+
+#define GRAY(v) ((uint16_t) (((v) >> 3) << 11 | ((v) >> 2) << 5 | (v) >> 3))
+
+typedef struct {
+  uint16_t *(*Get)(void);
+  uint16_t Width;
+  uint16_t Height;
+} DLIST_AssetInfoTypeDef;
+
+static const uint16_t defaultPalette[DLIST_PALETTE_SIZE] = {
+    DISP_COLOR_BLACK, DISP_COLOR_WHITE, DISP_COLOR_RED, DISP_COLOR_GREEN, DISP_COLOR_BLUE,
+    DISP_COLOR_RED | DISP_COLOR_GREEN, DISP_COLOR_GREEN | DISP_COLOR_BLUE, DISP_COLOR_RED | DISP_COLOR_BLUE,
+    GRAY(16), GRAY(48), GRAY(80), GRAY(112), GRAY(144), GRAY(176), GRAY(208), GRAY(240),
+};
+
+static const DLIST_AssetInfoTypeDef assets[DLIST_ASSET_COUNT] = {
+    {get_fox_240x320, 240, 320},
+    {get_screen_mfd_single_317x186, 317, 186},
+    {get_screen_mfd_multi_317_185, 317, 185},
+};
+
+static const FONT_TypeDef *const fonts[DLIST_FONT_COUNT] = {
+    &font_mono_12,
+    &font_mono_bold_16,
+};
+
+static VECTOR_PointTypeDef points[DLIST_MAX_POINTS];
+
+static uint32_t slotSizes[DLIST_SLOTS];
+static uint8_t uploading = 0;
+static uint8_t uploadSlot;
+static uint32_t uploadSize;
+static uint32_t uploadOffset;
+
+static int16_t readI16(const uint8_t *data) {
+  return (int16_t) (data[0] | data[1] << 8);
+}
+
+static uint16_t readU16(const uint8_t *data) {
+  return (uint16_t) (data[0] | data[1] << 8);
+}
+
+static uint8_t *DLIST_getSlot(uint8_t slot) {
+  return (uint8_t *) (SLOTS_ADDR + slot * DLIST_SLOT_SIZE);
+}
+
+/**
+ * Operand bytes of every op with a fixed size, 0 for the variable ones
+ */
+static uint8_t DLIST_getOperandSize(uint8_t op) {
+  switch (op) {
+    case DLIST_OP_FILL:
+      return 1;
+    case DLIST_OP_PATTERN:
+      return 1;
+    case DLIST_OP_RECT:
+      return 9;
+    case DLIST_OP_LINE:
+      return 10;
+    case DLIST_OP_CIRCLE:
+      return 8;
+    case DLIST_OP_BLIT:
+      return 5;
+    case DLIST_OP_BLIT_SCALED:
+      return 10;
+    default:
+      return 0;
+  }
+}
+
+/**
+ * Walks the list once, primitives are only added when build is set. Everything is
+ * validated in both modes, so a list DLIST_check accepts always builds.
+ */
+static DLIST_StatusTypeDef DLIST_run(const uint8_t *list, uint32_t size, uint8_t build, uint16_t *primitives) {
+  uint16_t palette[DLIST_PALETTE_SIZE];
+  uint16_t count = 0;
+  uint16_t pointCount = 0;
+  uint32_t pos = 0;
+
+  memcpy(palette, defaultPalette, sizeof(palette));
+  *primitives = 0;
+
+  while (pos < size && list[pos] != DLIST_OP_END) {
+    uint8_t op = list[pos++];
+    const uint8_t *p = &list[pos];
+    uint32_t left = size - pos;
+    uint8_t fixed = DLIST_getOperandSize(op);
+    uint8_t added = 1;
+
+    if (left < fixed) {
+      return DLIST_TRUNCATED;
+    }
+
+    switch (op) {
+      case DLIST_OP_PALETTE: {
+        if (left < 2 || p[0] + p[1] > DLIST_PALETTE_SIZE) {
+          return left < 2 ? DLIST_TRUNCATED : DLIST_BAD_OP;
+        }
+        if (left < 2U + p[1] * 2U) {
+          return DLIST_TRUNCATED;
+        }
+        for (uint8_t i = 0; i < p[1]; i++) {
+          palette[p[0] + i] = readU16(&p[2 + i * 2]);
+        }
+        pos += 2U + p[1] * 2U;
+        continue;
+      }
+      case DLIST_OP_FILL: {
+        if (p[0] >= DLIST_PALETTE_SIZE) {
+          return DLIST_BAD_OP;
+        }
+        if (build) {
+          added = TILE_fill(palette[p[0]]);
+        }
+        break;
+      }
+      case DLIST_OP_PATTERN: {
+        if (p[0] >= PATTERN_COUNT) {
+          return DLIST_BAD_OP;
+        }
+        if (build) {
+          added = TILE_pattern(p[0]);
+        }
+        break;
+      }
+      case DLIST_OP_RECT: {
+        int16_t x1 = readI16(&p[0]);
+        int16_t y1 = readI16(&p[2]);
+        int16_t x2 = readI16(&p[4]);
+        int16_t y2 = readI16(&p[6]);
+        if (p[8] >= DLIST_PALETTE_SIZE) {
+          return DLIST_BAD_OP;
+        }
+        // Left of or above the screen, negative corners are clamped to it
+        if ((x1 < 0 && x2 < 0) || (y1 < 0 && y2 < 0)) {
+          pos += fixed;
+          continue;
+        }
+        if (build) {
+          added = TILE_rect(x1 > 0 ? x1 : 0, y1 > 0 ? y1 : 0, x2 > 0 ? x2 : 0, y2 > 0 ? y2 : 0, palette[p[8]]);
+        }
+        break;
+      }
+      case DLIST_OP_LINE: {
+        if (p[9] >= DLIST_PALETTE_SIZE) {
+          return DLIST_BAD_OP;
+        }
+        if (build) {
+          added = TILE_line(readI16(&p[0]), readI16(&p[2]), readI16(&p[4]), readI16(&p[6]), p[8], palette[p[9]]);
+        }
+        break;
+      }
+      case DLIST_OP_CIRCLE: {
+        if (p[7] >= DLIST_PALETTE_SIZE) {
+          return DLIST_BAD_OP;
+        }
+        if (build) {
+          added = TILE_circle(readI16(&p[0]), readI16(&p[2]), readU16(&p[4]), p[6], palette[p[7]]);
+        }
+        break;
+      }
+      case DLIST_OP_POLYGON: {
+        if (left < 2) {
+          return DLIST_TRUNCATED;
+        }
+        uint8_t n = p[0];
+        if (n < 3 || n > VECTOR_MAX_POINTS || p[1] >= DLIST_PALETTE_SIZE) {
+          return DLIST_BAD_OP;
+        }
+        if (left < 2U + n * 4U) {
+          return DLIST_TRUNCATED;
+        }
+        if (pointCount + n > DLIST_MAX_POINTS) {
+          return DLIST_FULL;
+        }
+        if (build) {
+          // Copied, the list has no alignment
+          for (uint8_t i = 0; i < n; i++) {
+            points[pointCount + i].X = readI16(&p[2 + i * 4]);
+            points[pointCount + i].Y = readI16(&p[4 + i * 4]);
+          }
+          added = TILE_polygon(&points[pointCount], n, palette[p[1]]);
+        }
+        pointCount += n;
+        fixed = 2 + n * 4;
+        break;
+      }
+      case DLIST_OP_BLIT: {
+        if (p[0] >= DLIST_ASSET_COUNT) {
+          return DLIST_BAD_OP;
+        }
+        if (build) {
+          const DLIST_AssetInfoTypeDef *asset = &assets[p[0]];
+          added = TILE_bitmapRotated(asset->Get(), asset->Width, asset->Height, readU16(&p[1]), readU16(&p[3]),
+                                     ROTATE_0, 0);
+        }
+        break;
+      }
+      case DLIST_OP_BLIT_SCALED: {
+        uint16_t width = readU16(&p[5]);
+        uint16_t height = readU16(&p[7]);
+        if (p[0] >= DLIST_ASSET_COUNT || width == 0 || height == 0 || p[9] > SCALE_BILINEAR) {
+          return DLIST_BAD_OP;
+        }
+        if (build) {
+          const DLIST_AssetInfoTypeDef *asset = &assets[p[0]];
+          added = TILE_bitmapScaled(asset->Get(), asset->Width, asset->Height, readU16(&p[1]), readU16(&p[3]),
+                                    width, height, p[9]);
+        }
+        break;
+      }
+      case DLIST_OP_TEXT: {
+        if (left < 9) {
+          return DLIST_TRUNCATED;
+        }
+        const char *text = (const char *) &p[8];
+        const char *end = memchr(text, 0, left - 8);
+        if (end == NULL) {
+          return DLIST_TRUNCATED;
+        }
+        if (p[0] >= DLIST_FONT_COUNT || p[5] >= DLIST_PALETTE_SIZE || p[6] >= DLIST_PALETTE_SIZE) {
+          return DLIST_BAD_OP;
+        }
+        fixed = 8 + (end - text) + 1;
+        if (end == text) {
+          pos += fixed;
+          continue;
+        }
+        if (build) {
+          added = TILE_text(fonts[p[0]], text, readU16(&p[1]), readU16(&p[3]), palette[p[5]], palette[p[6]], p[7]);
+        }
+        break;
+      }
+      default: {
+        return DLIST_BAD_OP;
+      }
+    }
+
+    pos += fixed;
+    count++;
+    if (!added || count > TILE_MAX_PRIMITIVES) {
+      return DLIST_FULL;
+    }
+  }
+
+  *primitives = count;
+  return DLIST_OK;
+}
+
+DLIST_StatusTypeDef DLIST_build(const uint8_t *list, uint32_t size) {
+  uint16_t primitives;
+  return DLIST_run(list, size, 1, &primitives);
+}
+
+DLIST_StatusTypeDef DLIST_check(const uint8_t *list, uint32_t size, uint16_t *primitives) {
+  return DLIST_run(list, size, 0, primitives);
+}
+
+DLIST_StatusTypeDef DLIST_begin(uint8_t slot, uint32_t size) {
+  uploading = 0;
+  if (slot >= DLIST_SLOTS || size == 0 || size > DLIST_SLOT_SIZE) {
+    return DLIST_BAD_SLOT;
+  }
+
+  slotSizes[slot] = 0;
+  uploading = 1;
+  uploadSlot = slot;
+  uploadSize = size;
+  uploadOffset = 0;
+  return DLIST_OK;
+}
+
+DLIST_StatusTypeDef DLIST_chunk(uint32_t offset, const uint8_t *data, uint8_t size, uint32_t crc) {
+  if (!uploading) {
+    return DLIST_NOT_ACTIVE;
+  }
+
+  if (CRC_calc(CRC_INIT, data, size) != crc) {
+    return DLIST_BAD_CRC;
+  }
+
+  if (offset > uploadOffset || offset + size > uploadSize) {
+    return DLIST_OUT_OF_ORDER;
+  }
+
+  // Skip the part that was already accepted from a previous attempt
+  if (offset + size > uploadOffset) {
+    uint32_t skip = uploadOffset - offset;
+    memcpy(DLIST_getSlot(uploadSlot) + uploadOffset, data + skip, size - skip);
+    uploadOffset = offset + size;
+  }
+
+  return DLIST_OK;
+}
+
+DLIST_StatusTypeDef DLIST_end(void) {
+  if (!uploading) {
+    return DLIST_NOT_ACTIVE;
+  }
+
+  if (uploadOffset != uploadSize) {
+    return DLIST_INCOMPLETE;
+  }
+
+  uploading = 0;
+
+  uint16_t primitives;
+  DLIST_StatusTypeDef status = DLIST_check(DLIST_getSlot(uploadSlot), uploadSize, &primitives);
+  if (status == DLIST_OK) {
+    slotSizes[uploadSlot] = uploadSize;
+  }
+  return status;
+}
+
+DLIST_StatusTypeDef DLIST_buildSlot(uint8_t slot) {
+  if (slot >= DLIST_SLOTS || slotSizes[slot] == 0) {
+    return DLIST_BAD_SLOT;
+  }
+  return DLIST_build(DLIST_getSlot(slot), slotSizes[slot]);
+}
+
+uint32_t DLIST_getSize(uint8_t slot) {
+  return slot < DLIST_SLOTS ? slotSizes[slot] : 0;
+}
@@ -0,0 +1,127 @@
+#include "event.h"
+#include "spsc.h"
+
+// Per source, one slot stays free
+#define EVENT_QUEUE_SIZE 17
+
+static EVENT_TypeDef apiEvents[EVENT_QUEUE_SIZE];
+static EVENT_TypeDef ltdcEvents[EVENT_QUEUE_SIZE];
+static EVENT_TypeDef irEvents[EVENT_QUEUE_SIZE];
+
+static SPSC_QueueTypeDef queues[EVENT_SOURCE_COUNT] = {
+    SPSC_QUEUE_INIT(apiEvents, sizeof(EVENT_TypeDef), EVENT_QUEUE_SIZE),
+    SPSC_QUEUE_INIT(ltdcEvents, sizeof(EVENT_TypeDef), EVENT_QUEUE_SIZE),
+    SPSC_QUEUE_INIT(irEvents, sizeof(EVENT_TypeDef), EVENT_QUEUE_SIZE),
+};
+
+static EVENT_HandlerTypeDef handlers[EVENT_TYPE_COUNT];
+
+static EVENT_StatsTypeDef stats = {
+    .MinLatency = UINT32_MAX,
+};
+static volatile uint32_t dropped = 0;
+
+void EVENT_init(void) {
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  // Keeps the debugger attached while sleeping in WFI
+  HAL_DBGMCU_EnableDBGSleepMode();
+}
+
+uint32_t EVENT_cycles(void) {
+  return DWT->CYCCNT;
+}
+
+void EVENT_subscribe(EVENT_TypeTypeDef type, EVENT_HandlerTypeDef handler) {
+  if (type < EVENT_TYPE_COUNT) {
+    handlers[type] = handler;
+  }
+}
+
+uint8_t EVENT_post(EVENT_SourceTypeDef source, EVENT_TypeTypeDef type, uint32_t arg) {
+  EVENT_TypeDef *event = SPSC_acquire(&queues[source]);
+  if (event == NULL) {
+    dropped++;
+    return 0;
+  }
+
+  event->Type = type;
+  event->Arg = arg;
+  event->Timestamp = DWT->CYCCNT;
+  SPSC_commit(&queues[source]);
+  return 1;
+}
+
+static void EVENT_handle(const EVENT_TypeDef *event) {
+  uint32_t start = DWT->CYCCNT;
+  uint32_t latency = start - event->Timestamp;
+
+  stats.Dispatched++;
+  stats.LastLatency = latency;
+  if (latency < stats.MinLatency) stats.MinLatency = latency;
+  if (latency > stats.MaxLatency) stats.MaxLatency = latency;
+
+  if (event->Type < EVENT_TYPE_COUNT && handlers[event->Type] != NULL) {
+    handlers[event->Type](event);
+  }
+
+  uint32_t duration = DWT->CYCCNT - start;
+  if (duration > stats.MaxHandler) stats.MaxHandler = duration;
+}
+
+uint32_t EVENT_dispatch(void) {
+  uint32_t count = 0;
+
+  for (uint8_t source = 0; source < EVENT_SOURCE_COUNT; source++) {
+    EVENT_TypeDef *event;
+    while ((event = SPSC_front(&queues[source])) != NULL) {
+      EVENT_TypeDef copy = *event;
+      // Released first, a handler may take long enough for the queue to fill up
+      SPSC_release(&queues[source]);
+      EVENT_handle(&copy);
+      count++;
+    }
+  }
+
+  return count;
+}
+
+/**
+ * Interrupts are masked around the check, an event posted in between
+ * still wakes the core as WFI returns on a pending interrupt.
+ */
+void EVENT_idle(void) {
+  __disable_irq();
+
+  uint8_t pending = 0;
+  for (uint8_t source = 0; source < EVENT_SOURCE_COUNT; source++) {
+    if (!SPSC_isEmpty(&queues[source])) {
+      pending = 1;
+    }
+  }
+
+  if (!pending) {
+    __WFI();
+  }
+
+  __enable_irq();
+}
+
+EVENT_StatsTypeDef EVENT_getStats(void) {
+  EVENT_StatsTypeDef result = stats;
+  result.Dropped = dropped;
+  if (result.Dispatched == 0) {
+    result.MinLatency = 0;
+  }
+  return result;
+}
+
+void EVENT_resetStats(void) {
+  EVENT_StatsTypeDef empty = {
+      .MinLatency = UINT32_MAX,
+  };
+  stats = empty;
+  dropped = 0;
+}
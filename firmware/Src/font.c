@@ -0,0 +1,181 @@
+#include "font.h"
+#include "pixel.h"
+
+static const FONT_GlyphTypeDef *FONT_getGlyph(const FONT_TypeDef *font, char c) {
+  uint8_t code = (uint8_t) c;
+  if (code < font->First || code - font->First >= font->Count) {
+    return &font->Glyphs[font->Default];
+  }
+  return &font->Glyphs[code - font->First];
+}
+
+uint32_t FONT_measure(const FONT_TypeDef *font, const char *text) {
+  uint32_t width = 0;
+  for (; *text; text++) {
+    width += FONT_getGlyph(font, *text)->Advance;
+  }
+  return width;
+}
+
+uint8_t FONT_diff(const FONT_TypeDef *font, const char *oldText, const char *newText, uint32_t *x1, uint32_t *x2) {
+  uint32_t pen = 0;
+  uint8_t changed = 0;
+
+  for (; *oldText && *newText; oldText++, newText++) {
+    const FONT_GlyphTypeDef *oldGlyph = FONT_getGlyph(font, *oldText);
+    const FONT_GlyphTypeDef *newGlyph = FONT_getGlyph(font, *newText);
+    if (oldGlyph->Advance != newGlyph->Advance) {
+      break;
+    }
+    if (oldGlyph != newGlyph) {
+      if (!changed) {
+        *x1 = pen;
+        changed = 1;
+      }
+      *x2 = pen + newGlyph->Advance;
+    }
+    pen += newGlyph->Advance;
+  }
+
+  if (*oldText || *newText) {
+    uint32_t oldEnd = pen + FONT_measure(font, oldText);
+    uint32_t newEnd = pen + FONT_measure(font, newText);
+    if (!changed) {
+      *x1 = pen;
+      changed = 1;
+    }
+    *x2 = oldEnd > newEnd ? oldEnd : newEnd;
+  }
+
+  return changed;
+}
+
+/**
+ * coverage 1..14 of color over background, the 4 bit coverage is widened to a 5 bit weight
+ */
+static uint16_t FONT_mix(uint16_t color, uint16_t background, uint8_t coverage) {
+  uint32_t weight = coverage * 2U + (coverage >> 3);
+  return PIXEL_PACK((PIXEL_SPREAD(color) * weight + PIXEL_SPREAD(background) * (32U - weight) + PIXEL_ROUNDING) >> 5);
+}
+
+static void FONT_fill(uint16_t *dst, int32_t x1, int32_t x2, int32_t clipX1, int32_t clipX2, uint16_t color) {
+  if (x1 < clipX1) x1 = clipX1;
+  if (x2 > clipX2) x2 = clipX2;
+  for (int32_t x = x1; x < x2; x++) {
+    dst[x] = color;
+  }
+}
+
+/**
+ * Up to 32 pixels are loaded into a word at a time, the length of the run
+ * at its top is the count of leading zeros of the word or of its inverse
+ */
+static void FONT_drawRow1(const uint8_t *src, uint8_t width, uint16_t *dst, int32_t x, int32_t clipX1,
+                          int32_t clipX2, uint16_t color, uint16_t background, uint8_t opaque) {
+  while (width > 0) {
+    uint8_t n = width < 32 ? width : 32;
+    uint8_t bytes = (n + 7) / 8;
+    uint32_t bits = 0;
+    for (uint8_t i = 0; i < bytes; i++) {
+      bits |= (uint32_t) src[i] << (24 - 8 * i);
+    }
+    src += bytes;
+    width -= n;
+
+    while (n > 0) {
+      uint8_t set = bits >> 31;
+      uint8_t run = __CLZ(set ? ~bits : bits);
+      if (run > n) run = n;
+
+      if (set) {
+        FONT_fill(dst, x, x + run, clipX1, clipX2, color);
+      } else if (opaque) {
+        FONT_fill(dst, x, x + run, clipX1, clipX2, background);
+      }
+
+      x += run;
+      n -= run;
+      bits = run < 32 ? bits << run : 0;
+    }
+  }
+}
+
+/**
+ * Runs of empty and full pixels are filled as spans, edge pixels take the palette
+ * entry of their coverage or are blended with the target when transparent
+ */
+static void FONT_drawRow4(const uint8_t *src, uint8_t width, uint16_t *dst, int32_t x, int32_t clipX1,
+                          int32_t clipX2, uint16_t color, const uint16_t *palette, uint8_t opaque) {
+  uint8_t i = 0;
+  while (i < width) {
+    uint8_t level = src[i >> 1] >> (i & 1 ? 0 : 4) & 0x0F;
+    uint8_t run = 1;
+
+    if (level == 0 || level == 15) {
+      while (i + run < width && (src[(i + run) >> 1] >> ((i + run) & 1 ? 0 : 4) & 0x0F) == level) {
+        run++;
+      }
+      if (level == 15) {
+        FONT_fill(dst, x + i, x + i + run, clipX1, clipX2, color);
+      } else if (opaque) {
+        FONT_fill(dst, x + i, x + i + run, clipX1, clipX2, palette[0]);
+      }
+    } else if (x + i >= clipX1 && x + i < clipX2) {
+      dst[x + i] = opaque ? palette[level] : FONT_mix(color, dst[x + i], level);
+    }
+
+    i += run;
+  }
+}
+
+void FONT_drawRow(const FONT_TypeDef *font, const char *text, uint16_t row, uint16_t *dst, int32_t x,
+                  int32_t clipX1, int32_t clipX2, uint16_t color, uint16_t background, uint8_t opaque) {
+  uint16_t palette[16];
+  if (font->Bpp == FONT_4BPP && opaque) {
+    palette[0] = background;
+    for (uint8_t level = 1; level < 15; level++) {
+      palette[level] = FONT_mix(color, background, level);
+    }
+  }
+
+  if (opaque) {
+    FONT_fill(dst, clipX1, x, clipX1, clipX2, background);
+  }
+
+  for (; *text && x < clipX2; text++) {
+    const FONT_GlyphTypeDef *glyph = FONT_getGlyph(font, *text);
+    int32_t next = x + glyph->Advance;
+    int32_t inkRow = (int32_t) row - glyph->Top;
+
+    if (next <= clipX1) {
+      x = next;
+      continue;
+    }
+
+    if (glyph->Width == 0 || inkRow < 0 || inkRow >= glyph->Height) {
+      if (opaque) {
+        FONT_fill(dst, x, next, clipX1, clipX2, background);
+      }
+    } else {
+      int32_t inkX = x + glyph->Left;
+      if (opaque) {
+        FONT_fill(dst, x, inkX, clipX1, clipX2, background);
+        FONT_fill(dst, inkX + glyph->Width, next, clipX1, clipX2, background);
+      }
+
+      if (font->Bpp == FONT_1BPP) {
+        const uint8_t *src = &font->Atlas[glyph->Offset + (uint32_t) inkRow * ((glyph->Width + 7) / 8)];
+        FONT_drawRow1(src, glyph->Width, dst, inkX, clipX1, clipX2, color, background, opaque);
+      } else {
+        const uint8_t *src = &font->Atlas[glyph->Offset + (uint32_t) inkRow * ((glyph->Width + 1) / 2)];
+        FONT_drawRow4(src, glyph->Width, dst, inkX, clipX1, clipX2, color, palette, opaque);
+      }
+    }
+
+    x = next;
+  }
+
+  if (opaque) {
+    FONT_fill(dst, x, clipX2, clipX1, clipX2, background);
+  }
+}
@@ -0,0 +1,279 @@
+// Generated by scripts/fonts/fontpack.py from DejaVuSansMono.ttf at 12 px, 4 bpp
+#include "font_mono_12.h"
+
+static const uint8_t atlas[2636] = {
+    0xf3, 0xf3, 0xf3, 0xf3, 0xe3, 0xd2, 0x00, 0xf3, 0xf3, 0xf0, 0xc4, 0xf0, 0xc4, 0xf0, 0xc4, 0x00,
+    0x1d, 0x0b, 0x30, 0x00, 0x68, 0x1d, 0x00, 0x5f, 0xff, 0xff, 0xf0, 0x00, 0xd1, 0x87, 0x00, 0x02,
+    0xc0, 0xb3, 0x00, 0xff, 0xff, 0xff, 0x80, 0x09, 0x54, 0xa0, 0x00, 0x0d, 0x18, 0x60, 0x00, 0x00,
+    0x81, 0x00, 0x2b, 0xfd, 0x50, 0xb8, 0x83, 0x90, 0xc3, 0x81, 0x00, 0x6c, 0xc4, 0x00, 0x02, 0xaa,
+    0xc1, 0x00, 0x81, 0xa7, 0xa4, 0x82, 0xc5, 0x4b, 0xfe, 0x80, 0x00, 0x81, 0x00, 0x00, 0x81, 0x00,
+    0x3d, 0xd4, 0x00, 0x00, 0xb4, 0x2c, 0x00, 0x00, 0xb3, 0x2c, 0x00, 0x10, 0x3d, 0xe4, 0x4a, 0x60,
+    0x00, 0x5b, 0x71, 0x00, 0x4b, 0x62, 0xce, 0x50, 0x10, 0x09, 0x52, 0xc0, 0x00, 0x09, 0x52, 0xd0,
+    0x00, 0x02, 0xde, 0x50, 0x01, 0xbf, 0xf2, 0x00, 0x08, 0xa0, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00,
+    0x03, 0xd1, 0x00, 0x00, 0x1c, 0xda, 0x00, 0x00, 0x7a, 0x1c, 0x70, 0xd0, 0x96, 0x01, 0xd6, 0xb0,
+    0x5d, 0x30, 0x6f, 0x50, 0x07, 0xde, 0xa7, 0xc0, 0xe2, 0xe2, 0xe2, 0x01, 0xd0, 0x08, 0x70, 0x0e,
+    0x20, 0x4d, 0x00, 0x6b, 0x00, 0x7a, 0x00, 0x6b, 0x00, 0x4d, 0x00, 0x0e, 0x20, 0x08, 0x70, 0x01,
+    0xd1, 0xb4, 0x00, 0x4c, 0x00, 0x0d, 0x30, 0x0a, 0x70, 0x07, 0xa0, 0x06, 0xb0, 0x07, 0xa0, 0x0a,
+    0x70, 0x0d, 0x30, 0x4c, 0x00, 0xb4, 0x00, 0x00, 0xa0, 0x00, 0xa3, 0xa1, 0xa1, 0x19, 0xda, 0x30,
+    0x19, 0xea, 0x30, 0xa3, 0xa1, 0xa1, 0x00, 0xa0, 0x00, 0x00, 0x0d, 0x20, 0x00, 0x00, 0x0d, 0x20,
+    0x00, 0x00, 0x0d, 0x20, 0x00, 0x7f, 0xff, 0xff, 0xb0, 0x00, 0x0d, 0x20, 0x00, 0x00, 0x0d, 0x20,
+    0x00, 0x00, 0x0d, 0x20, 0x00, 0x1f, 0x60, 0x3f, 0x30, 0x78, 0x00, 0xef, 0xf2, 0x2f, 0x50, 0x2f,
+    0x50, 0x00, 0x00, 0x1e, 0x20, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x01, 0xe3, 0x00, 0x00, 0x06, 0xb0,
+    0x00, 0x00, 0x0d, 0x40, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x04, 0xd0, 0x00,
+    0x00, 0x0b, 0x60, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xc3, 0x00, 0x0a, 0xa1, 0x7d,
+    0x00, 0x1f, 0x30, 0x0e, 0x40, 0x2f, 0x00, 0x0c, 0x60, 0x3f, 0x1d, 0x3c, 0x70, 0x2f, 0x00, 0x0c,
+    0x60, 0x1f, 0x30, 0x0e, 0x40, 0x0a, 0xa1, 0x7d, 0x00, 0x01, 0xbf, 0xc3, 0x00, 0x8f, 0xf9, 0x00,
+    0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00,
+    0x99, 0x00, 0x00, 0x99, 0x00, 0x6f, 0xff, 0xf6, 0x05, 0xce, 0xb3, 0x00, 0x0a, 0x31, 0x8d, 0x00,
+    0x00, 0x00, 0x2f, 0x10, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x01, 0xd5, 0x00, 0x00, 0x1b, 0x70, 0x00,
+    0x00, 0xb9, 0x00, 0x00, 0x0a, 0xa0, 0x00, 0x00, 0x2f, 0xff, 0xff, 0x30, 0x04, 0xce, 0xb3, 0x00,
+    0x0a, 0x31, 0x7d, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x00, 0x01, 0x8d, 0x00, 0x00, 0xaf, 0xe3, 0x00,
+    0x00, 0x01, 0x6d, 0x10, 0x00, 0x00, 0x0d, 0x40, 0x38, 0x21, 0x6f, 0x20, 0x06, 0xde, 0xc5, 0x00,
+    0x00, 0x03, 0xf7, 0x00, 0x00, 0x0b, 0xc7, 0x00, 0x00, 0x68, 0xa7, 0x00, 0x01, 0xd1, 0xa7, 0x00,
+    0x09, 0x60, 0xa7, 0x00, 0x3c, 0x00, 0xa7, 0x00, 0x6f, 0xff, 0xff, 0xa0, 0x00, 0x00, 0xa7, 0x00,
+    0x00, 0x00, 0xa7, 0x00, 0x0c, 0xff, 0xfa, 0x00, 0x0c, 0x40, 0x00, 0x00, 0x0c, 0x40, 0x00, 0x00,
+    0x0c, 0xee, 0xb3, 0x00, 0x00, 0x01, 0x9d, 0x00, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x00, 0x0f, 0x30,
+    0x28, 0x21, 0x9d, 0x00, 0x07, 0xde, 0xb2, 0x00, 0x00, 0x9e, 0xe4, 0x00, 0x08, 0xc2, 0x18, 0x00,
+    0x0e, 0x30, 0x00, 0x00, 0x2e, 0x7e, 0xd6, 0x00, 0x3f, 0x91, 0x4f, 0x20, 0x3f, 0x20, 0x0c, 0x60,
+    0x1f, 0x20, 0x0c, 0x60, 0x0b, 0x91, 0x4f, 0x20, 0x02, 0xbf, 0xd5, 0x00, 0x3f, 0xff, 0xff, 0x40,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x05, 0xd0, 0x00,
+    0x00, 0x0b, 0x70, 0x00, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00,
+    0x03, 0xce, 0xd5, 0x00, 0x0d, 0x81, 0x5f, 0x10, 0x0f, 0x30, 0x0e, 0x30, 0x0a, 0x81, 0x5d, 0x00,
+    0x02, 0xdf, 0xe4, 0x00, 0x0d, 0x61, 0x4e, 0x20, 0x3f, 0x00, 0x0c, 0x60, 0x1e, 0x60, 0x4e, 0x40,
+    0x04, 0xcf, 0xd7, 0x00, 0x04, 0xcf, 0xc3, 0x00, 0x0e, 0x61, 0x7d, 0x00, 0x3e, 0x00, 0x0e, 0x30,
+    0x3e, 0x00, 0x0e, 0x50, 0x0e, 0x61, 0x7f, 0x60, 0x04, 0xce, 0xac, 0x50, 0x00, 0x00, 0x1e, 0x20,
+    0x06, 0x21, 0xab, 0x00, 0x03, 0xce, 0xa1, 0x00, 0x2f, 0x50, 0x2f, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x2f, 0x50, 0x2f, 0x50, 0x2f, 0x50, 0x2f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x60, 0x3f, 0x30,
+    0x78, 0x00, 0x00, 0x00, 0x28, 0x90, 0x00, 0x4b, 0xe8, 0x20, 0x4d, 0xb5, 0x00, 0x00, 0x4d, 0xb5,
+    0x00, 0x00, 0x00, 0x5b, 0xe8, 0x20, 0x00, 0x00, 0x28, 0x90, 0x7f, 0xff, 0xff, 0xb0, 0x00, 0x00,
+    0x00, 0x00, 0x7f, 0xff, 0xff, 0xb0, 0x79, 0x30, 0x00, 0x00, 0x17, 0xdc, 0x61, 0x00, 0x00, 0x04,
+    0x9d, 0x70, 0x00, 0x04, 0x9d, 0x70, 0x17, 0xdc, 0x61, 0x00, 0x79, 0x30, 0x00, 0x00, 0x2a, 0xed,
+    0x50, 0x75, 0x16, 0xe0, 0x00, 0x03, 0xe0, 0x00, 0x2d, 0x50, 0x00, 0xd5, 0x00, 0x02, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xf1, 0x00, 0x02, 0xf1, 0x00, 0x01, 0x9e, 0xe9, 0x00, 0x0c, 0x81, 0x1a,
+    0x70, 0x6a, 0x00, 0x02, 0xc0, 0xa4, 0x1b, 0xe9, 0xd0, 0xc1, 0x79, 0x13, 0xd0, 0xc2, 0x79, 0x13,
+    0xd0, 0xa4, 0x1b, 0xea, 0xd0, 0x5b, 0x00, 0x00, 0x00, 0x0a, 0xa2, 0x00, 0x00, 0x00, 0x7d, 0xfd,
+    0x00, 0x00, 0x4f, 0x70, 0x00, 0x00, 0x8c, 0xc0, 0x00, 0x00, 0xd5, 0xf1, 0x00, 0x02, 0xf0, 0xc6,
+    0x00, 0x07, 0xb0, 0x8a, 0x00, 0x0b, 0x70, 0x4e, 0x00, 0x1f, 0xff, 0xff, 0x40, 0x5e, 0x00, 0x0b,
+    0x90, 0xa9, 0x00, 0x06, 0xd0, 0xff, 0xfd, 0x60, 0xf2, 0x04, 0xf2, 0xf2, 0x00, 0xd5, 0xf2, 0x04,
+    0xf2, 0xff, 0xff, 0x70, 0xf2, 0x03, 0xd5, 0xf2, 0x00, 0x99, 0xf2, 0x02, 0xc7, 0xff, 0xfd, 0x90,
+    0x00, 0x7d, 0xe9, 0x00, 0x06, 0xd3, 0x16, 0x40, 0x0d, 0x60, 0x00, 0x00, 0x1f, 0x20, 0x00, 0x00,
+    0x2f, 0x10, 0x00, 0x00, 0x1f, 0x20, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x06, 0xd3, 0x16, 0x40,
+    0x00, 0x7d, 0xe9, 0x00, 0x3f, 0xfe, 0x91, 0x00, 0x3f, 0x02, 0xac, 0x00, 0x3f, 0x00, 0x1f, 0x30,
+    0x3f, 0x00, 0x0c, 0x60, 0x3f, 0x00, 0x0c, 0x70, 0x3f, 0x00, 0x0c, 0x60, 0x3f, 0x00, 0x1f, 0x30,
+    0x3f, 0x02, 0xac, 0x00, 0x3f, 0xfe, 0x91, 0x00, 0xdf, 0xff, 0xf5, 0xd5, 0x00, 0x00, 0xd5, 0x00,
+    0x00, 0xd5, 0x00, 0x00, 0xdf, 0xff, 0xf3, 0xd5, 0x00, 0x00, 0xd5, 0x00, 0x00, 0xd5, 0x00, 0x00,
+    0xdf, 0xff, 0xf7, 0xaf, 0xff, 0xf8, 0xa8, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xaf,
+    0xff, 0xf2, 0xa8, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x01, 0x9e,
+    0xe8, 0x00, 0x09, 0xb2, 0x17, 0x20, 0x2f, 0x20, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x6d, 0x00,
+    0xef, 0x70, 0x4e, 0x00, 0x0a, 0x70, 0x2f, 0x20, 0x0a, 0x70, 0x0a, 0xb2, 0x1b, 0x70, 0x01, 0x9e,
+    0xea, 0x20, 0x3f, 0x00, 0x0c, 0x60, 0x3f, 0x00, 0x0c, 0x60, 0x3f, 0x00, 0x0c, 0x60, 0x3f, 0x00,
+    0x0c, 0x60, 0x3f, 0xff, 0xff, 0x60, 0x3f, 0x00, 0x0c, 0x60, 0x3f, 0x00, 0x0c, 0x60, 0x3f, 0x00,
+    0x0c, 0x60, 0x3f, 0x00, 0x0c, 0x60, 0xcf, 0xff, 0xf0, 0x00, 0xf3, 0x00, 0x00, 0xf3, 0x00, 0x00,
+    0xf3, 0x00, 0x00, 0xf3, 0x00, 0x00, 0xf3, 0x00, 0x00, 0xf3, 0x00, 0x00, 0xf3, 0x00, 0xcf, 0xff,
+    0xf0, 0x00, 0xcf, 0xf9, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99,
+    0x00, 0x00, 0x99, 0x00, 0x00, 0x98, 0x56, 0x12, 0xd5, 0x19, 0xee, 0x90, 0x3f, 0x00, 0x0b, 0x90,
+    0x3f, 0x00, 0xaa, 0x00, 0x3f, 0x09, 0xb0, 0x00, 0x3f, 0x8d, 0x10, 0x00, 0x3f, 0xde, 0x30, 0x00,
+    0x3f, 0x17, 0xd0, 0x00, 0x3f, 0x00, 0xc8, 0x00, 0x3f, 0x00, 0x3f, 0x30, 0x3f, 0x00, 0x09, 0xc0,
+    0xb7, 0x00, 0x00, 0xb7, 0x00, 0x00, 0xb7, 0x00, 0x00, 0xb7, 0x00, 0x00, 0xb7, 0x00, 0x00, 0xb7,
+    0x00, 0x00, 0xb7, 0x00, 0x00, 0xb7, 0x00, 0x00, 0xbf, 0xff, 0xfa, 0x8f, 0x40, 0x1f, 0xb0, 0x8d,
+    0x80, 0x5d, 0xb0, 0x89, 0xc0, 0xa8, 0xb0, 0x89, 0xa4, 0xc6, 0xb0, 0x89, 0x5c, 0x86, 0xb0, 0x89,
+    0x1e, 0x36, 0xb0, 0x89, 0x00, 0x06, 0xb0, 0x89, 0x00, 0x06, 0xb0, 0x89, 0x00, 0x06, 0xb0, 0x3f,
+    0x80, 0x0b, 0x60, 0x3f, 0xd0, 0x0b, 0x60, 0x3e, 0xa5, 0x0b, 0x60, 0x3e, 0x4b, 0x0b, 0x60, 0x3e,
+    0x0d, 0x2b, 0x60, 0x3e, 0x07, 0x8b, 0x60, 0x3e, 0x02, 0xdb, 0x60, 0x3e, 0x00, 0xaf, 0x60, 0x3e,
+    0x00, 0x4f, 0x60, 0x02, 0xbf, 0xd4, 0x00, 0x0c, 0x91, 0x6e, 0x10, 0x2f, 0x20, 0x0d, 0x50, 0x4e,
+    0x00, 0x0b, 0x70, 0x5e, 0x00, 0x0b, 0x80, 0x4e, 0x00, 0x0b, 0x70, 0x2f, 0x10, 0x0d, 0x50, 0x0c,
+    0x91, 0x6e, 0x10, 0x02, 0xcf, 0xd4, 0x00, 0xdf, 0xfe, 0x90, 0xd5, 0x03, 0xd7, 0xd5, 0x00, 0x9a,
+    0xd5, 0x03, 0xd7, 0xdf, 0xfe, 0x90, 0xd5, 0x00, 0x00, 0xd5, 0x00, 0x00, 0xd5, 0x00, 0x00, 0xd5,
+    0x00, 0x00, 0x02, 0xbf, 0xd4, 0x00, 0x0c, 0x91, 0x6e, 0x10, 0x2f, 0x20, 0x0d, 0x50, 0x4e, 0x00,
+    0x0b, 0x70, 0x5e, 0x00, 0x0b, 0x80, 0x4e, 0x00, 0x0b, 0x70, 0x2f, 0x10, 0x0d, 0x50, 0x0c, 0x91,
+    0x6e, 0x10, 0x02, 0xcf, 0xf4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x2f, 0xff,
+    0xc4, 0x00, 0x2f, 0x01, 0x7e, 0x10, 0x2f, 0x00, 0x1f, 0x30, 0x2f, 0x00, 0x6e, 0x10, 0x2f, 0xff,
+    0xd2, 0x00, 0x2f, 0x01, 0xb8, 0x00, 0x2f, 0x00, 0x2e, 0x10, 0x2f, 0x00, 0x0b, 0x80, 0x2f, 0x00,
+    0x04, 0xe0, 0x03, 0xbe, 0xc4, 0x00, 0x0e, 0x71, 0x3a, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x1e, 0x81,
+    0x00, 0x00, 0x03, 0xae, 0xc5, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x00, 0x00, 0x0b, 0x60, 0x19, 0x31,
+    0x4e, 0x30, 0x05, 0xce, 0xd6, 0x00, 0xbf, 0xff, 0xff, 0xe0, 0x00, 0x0f, 0x30, 0x00, 0x00, 0x0f,
+    0x30, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x00, 0x0f,
+    0x30, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x2f, 0x10, 0x0c, 0x50, 0x2f, 0x10,
+    0x0c, 0x50, 0x2f, 0x10, 0x0c, 0x50, 0x2f, 0x10, 0x0c, 0x50, 0x2f, 0x10, 0x0c, 0x50, 0x2f, 0x10,
+    0x0c, 0x50, 0x1f, 0x10, 0x0d, 0x50, 0x0d, 0x71, 0x4f, 0x20, 0x03, 0xce, 0xd5, 0x00, 0x8a, 0x00,
+    0x07, 0xb0, 0x4e, 0x00, 0x0b, 0x70, 0x0e, 0x30, 0x0e, 0x30, 0x0a, 0x70, 0x4d, 0x00, 0x06, 0xb0,
+    0x79, 0x00, 0x02, 0xe0, 0xb5, 0x00, 0x00, 0xc4, 0xe1, 0x00, 0x00, 0x8b, 0xb0, 0x00, 0x00, 0x4f,
+    0x70, 0x00, 0xe3, 0x00, 0x00, 0xf0, 0xc5, 0x00, 0x01, 0xf0, 0xa7, 0x2f, 0x53, 0xd0, 0x79, 0x5d,
+    0x85, 0xb0, 0x5a, 0x77, 0xb7, 0x90, 0x3c, 0xa2, 0xc9, 0x60, 0x1e, 0xc0, 0xbc, 0x40, 0x0e, 0xb0,
+    0x8f, 0x20, 0x0b, 0x80, 0x5f, 0x00, 0x3e, 0x20, 0x0a, 0x90, 0x09, 0x90, 0x3e, 0x10, 0x01, 0xe3,
+    0xc6, 0x00, 0x00, 0x6e, 0xb0, 0x00, 0x00, 0x2f, 0x80, 0x00, 0x00, 0xb9, 0xe2, 0x00, 0x05, 0xd0,
+    0x8a, 0x00, 0x1e, 0x40, 0x1e, 0x30, 0x9a, 0x00, 0x07, 0xc0, 0x8b, 0x00, 0x08, 0xb0, 0x1d, 0x40,
+    0x2e, 0x30, 0x06, 0xc0, 0x99, 0x00, 0x00, 0xc8, 0xe1, 0x00, 0x00, 0x4f, 0x70, 0x00, 0x00, 0x0f,
+    0x30, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x0e, 0xff,
+    0xff, 0xb0, 0x00, 0x00, 0x1d, 0x50, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x03, 0xe2, 0x00, 0x00, 0x0c,
+    0x60, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x02, 0xe2, 0x00, 0x00, 0x0b, 0x70, 0x00, 0x00, 0x1f, 0xff,
+    0xff, 0xd0, 0x4f, 0xf3, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00,
+    0x4c, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x4f, 0xf3, 0x3e, 0x00, 0x00, 0x00, 0x0b, 0x60, 0x00, 0x00,
+    0x04, 0xd0, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x0d, 0x40, 0x00,
+    0x00, 0x06, 0xb0, 0x00, 0x00, 0x01, 0xe3, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x1e, 0x20,
+    0xff, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80,
+    0x08, 0x80, 0x08, 0x80, 0xff, 0x80, 0x00, 0x5f, 0x90, 0x00, 0x04, 0xd2, 0xb7, 0x00, 0x3c, 0x20,
+    0x0b, 0x50, 0xff, 0xff, 0xff, 0xf0, 0x1c, 0x30, 0x01, 0xb2, 0x0b, 0xff, 0xc4, 0x00, 0x00, 0x00,
+    0x5e, 0x00, 0x00, 0x00, 0x0e, 0x20, 0x06, 0xdf, 0xff, 0x30, 0x1e, 0x40, 0x0e, 0x30, 0x2e, 0x21,
+    0x7f, 0x30, 0x07, 0xee, 0x7d, 0x30, 0xd3, 0x00, 0x00, 0xd3, 0x00, 0x00, 0xd3, 0x00, 0x00, 0xd7,
+    0xed, 0x50, 0xdb, 0x14, 0xf2, 0xd5, 0x00, 0xb6, 0xd3, 0x00, 0xa7, 0xd5, 0x00, 0xb6, 0xdb, 0x14,
+    0xe2, 0xd8, 0xed, 0x50, 0x06, 0xde, 0x90, 0x5e, 0x31, 0x63, 0xb7, 0x00, 0x00, 0xc5, 0x00, 0x00,
+    0xb7, 0x00, 0x00, 0x5d, 0x31, 0x53, 0x06, 0xde, 0x90, 0x00, 0x00, 0x0f, 0x20, 0x00, 0x00, 0x0f,
+    0x20, 0x00, 0x00, 0x0f, 0x20, 0x03, 0xce, 0x8f, 0x20, 0x0d, 0x71, 0x9f, 0x20, 0x2e, 0x00, 0x1f,
+    0x20, 0x4d, 0x00, 0x0f, 0x20, 0x2e, 0x00, 0x1f, 0x20, 0x0d, 0x71, 0x8f, 0x20, 0x03, 0xce, 0x7f,
+    0x20, 0x01, 0xae, 0xd5, 0x00, 0x0b, 0x91, 0x3e, 0x20, 0x2f, 0x10, 0x0a, 0x60, 0x4f, 0xff, 0xff,
+    0x80, 0x2e, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x28, 0x40, 0x01, 0xae, 0xd7, 0x00, 0x00, 0x6e, 0xf4,
+    0x00, 0xe3, 0x00, 0x01, 0xf0, 0x00, 0xdf, 0xff, 0xf4, 0x02, 0xf0, 0x00, 0x02, 0xf0, 0x00, 0x02,
+    0xf0, 0x00, 0x02, 0xf0, 0x00, 0x02, 0xf0, 0x00, 0x02, 0xf0, 0x00, 0x03, 0xce, 0x8f, 0x20, 0x0d,
+    0x71, 0x8f, 0x20, 0x2e, 0x00, 0x1f, 0x20, 0x4d, 0x00, 0x0f, 0x20, 0x2e, 0x00, 0x1f, 0x20, 0x0d,
+    0x71, 0x8f, 0x20, 0x03, 0xce, 0x7f, 0x10, 0x00, 0x00, 0x1f, 0x00, 0x06, 0x41, 0x8a, 0x00, 0x02,
+    0xbe, 0xb2, 0x00, 0xd3, 0x00, 0x00, 0xd3, 0x00, 0x00, 0xd3, 0x00, 0x00, 0xd7, 0xde, 0x60, 0xdb,
+    0x15, 0xe0, 0xd4, 0x00, 0xe2, 0xd3, 0x00, 0xe2, 0xd3, 0x00, 0xe2, 0xd3, 0x00, 0xe2, 0xd3, 0x00,
+    0xe2, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf4, 0x00, 0x00, 0xc4, 0x00,
+    0x00, 0xc4, 0x00, 0x00, 0xc4, 0x00, 0x00, 0xc4, 0x00, 0x00, 0xc4, 0x00, 0xef, 0xff, 0xf6, 0x00,
+    0x79, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xf9, 0x00, 0x79, 0x00, 0x79, 0x00, 0x79, 0x00, 0x79, 0x00,
+    0x79, 0x00, 0x79, 0x00, 0x89, 0x00, 0xb6, 0xef, 0xb1, 0x98, 0x00, 0x00, 0x98, 0x00, 0x00, 0x98,
+    0x00, 0x00, 0x98, 0x03, 0xd3, 0x98, 0x3d, 0x30, 0x9a, 0xe5, 0x00, 0x9e, 0xba, 0x00, 0x98, 0x1d,
+    0x50, 0x98, 0x04, 0xe1, 0x98, 0x00, 0x9b, 0x1f, 0xfb, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+    0x5b, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+    0x5b, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x2e, 0x20, 0x00, 0x00, 0x08, 0xef, 0x10, 0x5c,
+    0xda, 0xae, 0x30, 0x5c, 0x1f, 0x57, 0x80, 0x5a, 0x0d, 0x25, 0xa0, 0x59, 0x0d, 0x25, 0xa0, 0x59,
+    0x0d, 0x25, 0xa0, 0x59, 0x0d, 0x25, 0xa0, 0x59, 0x0d, 0x25, 0xa0, 0xd7, 0xde, 0x60, 0xdb, 0x15,
+    0xe0, 0xd4, 0x00, 0xe2, 0xd3, 0x00, 0xe2, 0xd3, 0x00, 0xe2, 0xd3, 0x00, 0xe2, 0xd3, 0x00, 0xe2,
+    0x02, 0xbe, 0xc4, 0x00, 0x0c, 0x91, 0x5e, 0x10, 0x1f, 0x10, 0x0d, 0x40, 0x3f, 0x00, 0x0b, 0x60,
+    0x1f, 0x10, 0x0d, 0x50, 0x0c, 0x81, 0x5e, 0x10, 0x02, 0xbe, 0xc4, 0x00, 0xd8, 0xed, 0x50, 0xdb,
+    0x14, 0xe1, 0xd5, 0x00, 0xb6, 0xd3, 0x00, 0xa7, 0xd5, 0x00, 0xb6, 0xdb, 0x14, 0xe2, 0xd8, 0xed,
+    0x50, 0xd3, 0x00, 0x00, 0xd3, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x02, 0xce, 0x9e, 0x30, 0x0c, 0x81,
+    0x8f, 0x30, 0x1f, 0x10, 0x1f, 0x30, 0x3f, 0x00, 0x0e, 0x30, 0x1f, 0x10, 0x1f, 0x30, 0x0c, 0x81,
+    0x8f, 0x30, 0x02, 0xce, 0x8e, 0x30, 0x00, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x0e, 0x30, 0x00, 0x00,
+    0x0e, 0x30, 0xd8, 0xdf, 0xc0, 0xdc, 0x20, 0x00, 0xd5, 0x00, 0x00, 0xd3, 0x00, 0x00, 0xd3, 0x00,
+    0x00, 0xd3, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x2b, 0xec, 0x30, 0xa9, 0x13, 0x80, 0x99, 0x00, 0x00,
+    0x19, 0xcb, 0x40, 0x00, 0x04, 0xe0, 0x84, 0x15, 0xe0, 0x3b, 0xec, 0x40, 0x00, 0x79, 0x00, 0x00,
+    0x00, 0x79, 0x00, 0x00, 0x4f, 0xff, 0xff, 0x10, 0x00, 0x79, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00,
+    0x00, 0x79, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x6c, 0x10, 0x00, 0x00, 0x1b, 0xff, 0x10,
+    0xd3, 0x00, 0xe2, 0xd3, 0x00, 0xe2, 0xd3, 0x00, 0xe2, 0xd3, 0x00, 0xe2, 0xc4, 0x00, 0xf2, 0xa9,
+    0x17, 0xf2, 0x3d, 0xe7, 0xe2, 0x4d, 0x00, 0x0a, 0x70, 0x0e, 0x30, 0x0e, 0x20, 0x09, 0x80, 0x4c,
+    0x00, 0x04, 0xd0, 0x97, 0x00, 0x00, 0xe3, 0xe2, 0x00, 0x00, 0x9b, 0xc0, 0x00, 0x00, 0x4f, 0x70,
+    0x00, 0xd2, 0x00, 0x00, 0xe0, 0xa5, 0x00, 0x02, 0xd0, 0x79, 0x0e, 0x35, 0xa0, 0x4c, 0x4c, 0x78,
+    0x70, 0x1e, 0x84, 0xab, 0x30, 0x0c, 0xd0, 0xbe, 0x00, 0x09, 0xa0, 0x7c, 0x00, 0x1d, 0x30, 0x1e,
+    0x30, 0x04, 0xd1, 0xa7, 0x00, 0x00, 0x9c, 0xc0, 0x00, 0x00, 0x2f, 0x60, 0x00, 0x00, 0xc9, 0xe1,
+    0x00, 0x07, 0xb0, 0x7b, 0x00, 0x3e, 0x20, 0x0c, 0x60, 0x3e, 0x00, 0x09, 0x90, 0x0d, 0x40, 0x0e,
+    0x30, 0x08, 0xa0, 0x4d, 0x00, 0x02, 0xe1, 0x98, 0x00, 0x00, 0xc6, 0xe3, 0x00, 0x00, 0x7e, 0xc0,
+    0x00, 0x00, 0x1f, 0x70, 0x00, 0x00, 0x1e, 0x20, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x0e, 0xd3, 0x00,
+    0x00, 0xaf, 0xff, 0xf1, 0x00, 0x06, 0xb0, 0x00, 0x3d, 0x10, 0x01, 0xd4, 0x00, 0x0b, 0x70, 0x00,
+    0x7b, 0x00, 0x00, 0xcf, 0xff, 0xf1, 0x00, 0x5d, 0xe0, 0x00, 0xc6, 0x00, 0x00, 0xd3, 0x00, 0x00,
+    0xe3, 0x00, 0x03, 0xf1, 0x00, 0xbf, 0x80, 0x00, 0x04, 0xf1, 0x00, 0x00, 0xe3, 0x00, 0x00, 0xd3,
+    0x00, 0x00, 0xc6, 0x00, 0x00, 0x5d, 0xe0, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2,
+    0xd2, 0xd2, 0xd2, 0xae, 0x80, 0x00, 0x03, 0xf0, 0x00, 0x00, 0xf2, 0x00, 0x00, 0xe2, 0x00, 0x00,
+    0xd6, 0x00, 0x00, 0x5f, 0xe0, 0x00, 0xd7, 0x00, 0x00, 0xe2, 0x00, 0x00, 0xf2, 0x00, 0x03, 0xf0,
+    0x00, 0xae, 0x80, 0x00, 0x2c, 0xe9, 0x22, 0x70, 0x53, 0x17, 0xdd, 0x40,
+};
+
+static const FONT_GlyphTypeDef glyphs[95] = {
+    {0, 0, 0, 0, 0, 7}, // ' '
+    {0, 2, 9, 3, 3, 7}, // '!'
+    {9, 4, 3, 2, 3, 7}, // '"'
+    {15, 7, 8, 0, 4, 7}, // '#'
+    {47, 6, 11, 1, 3, 7}, // '$'
+    {80, 7, 9, 0, 3, 7}, // '%'
+    {116, 7, 9, 0, 3, 7}, // '&'
+    {152, 2, 3, 3, 3, 7}, // "'"
+    {155, 4, 11, 2, 2, 7}, // '('
+    {177, 3, 11, 2, 2, 7}, // ')'
+    {199, 6, 6, 1, 3, 7}, // '*'
+    {217, 7, 7, 0, 5, 7}, // '+'
+    {245, 3, 3, 2, 10, 7}, // ','
+    {251, 4, 1, 2, 8, 7}, // '-'
+    {253, 3, 2, 2, 10, 7}, // '.'
+    {257, 7, 10, 0, 3, 7}, // '/'
+    {297, 7, 9, 0, 3, 7}, // '0'
+    {333, 6, 9, 1, 3, 7}, // '1'
+    {360, 7, 9, 0, 3, 7}, // '2'
+    {396, 7, 9, 0, 3, 7}, // '3'
+    {432, 7, 9, 0, 3, 7}, // '4'
+    {468, 7, 9, 0, 3, 7}, // '5'
+    {504, 7, 9, 0, 3, 7}, // '6'
+    {540, 7, 9, 0, 3, 7}, // '7'
+    {576, 7, 9, 0, 3, 7}, // '8'
+    {612, 7, 9, 0, 3, 7}, // '9'
+    {648, 3, 6, 2, 6, 7}, // ':'
+    {660, 3, 7, 2, 6, 7}, // ';'
+    {674, 7, 6, 0, 5, 7}, // '<'
+    {698, 7, 3, 0, 7, 7}, // '='
+    {710, 7, 6, 0, 5, 7}, // '>'
+    {734, 5, 9, 1, 3, 7}, // '?'
+    {761, 7, 10, 0, 4, 7}, // '@'
+    {801, 7, 9, 0, 3, 7}, // 'A'
+    {837, 6, 9, 1, 3, 7}, // 'B'
+    {864, 7, 9, 0, 3, 7}, // 'C'
+    {900, 7, 9, 0, 3, 7}, // 'D'
+    {936, 6, 9, 1, 3, 7}, // 'E'
+    {963, 6, 9, 1, 3, 7}, // 'F'
+    {990, 7, 9, 0, 3, 7}, // 'G'
+    {1026, 7, 9, 0, 3, 7}, // 'H'
+    {1062, 5, 9, 1, 3, 7}, // 'I'
+    {1089, 6, 9, 0, 3, 7}, // 'J'
+    {1116, 7, 9, 0, 3, 7}, // 'K'
+    {1152, 6, 9, 1, 3, 7}, // 'L'
+    {1179, 7, 9, 0, 3, 7}, // 'M'
+    {1215, 7, 9, 0, 3, 7}, // 'N'
+    {1251, 7, 9, 0, 3, 7}, // 'O'
+    {1287, 6, 9, 1, 3, 7}, // 'P'
+    {1314, 7, 11, 0, 3, 7}, // 'Q'
+    {1358, 7, 9, 0, 3, 7}, // 'R'
+    {1394, 7, 9, 0, 3, 7}, // 'S'
+    {1430, 7, 9, 0, 3, 7}, // 'T'
+    {1466, 7, 9, 0, 3, 7}, // 'U'
+    {1502, 7, 9, 0, 3, 7}, // 'V'
+    {1538, 7, 9, 0, 3, 7}, // 'W'
+    {1574, 7, 9, 0, 3, 7}, // 'X'
+    {1610, 7, 9, 0, 3, 7}, // 'Y'
+    {1646, 7, 9, 0, 3, 7}, // 'Z'
+    {1682, 4, 11, 2, 2, 7}, // '['
+    {1704, 7, 10, 0, 3, 7}, // '\\'
+    {1744, 3, 11, 2, 2, 7}, // ']'
+    {1766, 7, 3, 0, 3, 7}, // '^'
+    {1778, 7, 1, 0, 14, 7}, // '_'
+    {1782, 4, 2, 1, 2, 7}, // '`'
+    {1786, 7, 7, 0, 5, 7}, // 'a'
+    {1814, 6, 10, 1, 2, 7}, // 'b'
+    {1844, 6, 7, 1, 5, 7}, // 'c'
+    {1865, 7, 10, 0, 2, 7}, // 'd'
+    {1905, 7, 7, 0, 5, 7}, // 'e'
+    {1933, 6, 10, 1, 2, 7}, // 'f'
+    {1963, 7, 10, 0, 5, 7}, // 'g'
+    {2003, 6, 10, 1, 2, 7}, // 'h'
+    {2033, 6, 10, 1, 2, 7}, // 'i'
+    {2063, 4, 13, 1, 2, 7}, // 'j'
+    {2089, 6, 10, 1, 2, 7}, // 'k'
+    {2119, 7, 10, 0, 2, 7}, // 'l'
+    {2159, 7, 7, 0, 5, 7}, // 'm'
+    {2187, 6, 7, 1, 5, 7}, // 'n'
+    {2208, 7, 7, 0, 5, 7}, // 'o'
+    {2236, 6, 10, 1, 5, 7}, // 'p'
+    {2266, 7, 10, 0, 5, 7}, // 'q'
+    {2306, 5, 7, 2, 5, 7}, // 'r'
+    {2327, 5, 7, 1, 5, 7}, // 's'
+    {2348, 7, 9, 0, 3, 7}, // 't'
+    {2384, 6, 7, 1, 5, 7}, // 'u'
+    {2405, 7, 7, 0, 5, 7}, // 'v'
+    {2433, 7, 7, 0, 5, 7}, // 'w'
+    {2461, 7, 7, 0, 5, 7}, // 'x'
+    {2489, 7, 10, 0, 5, 7}, // 'y'
+    {2529, 6, 7, 1, 5, 7}, // 'z'
+    {2550, 5, 11, 1, 2, 7}, // '{'
+    {2583, 2, 12, 3, 2, 7}, // '|'
+    {2595, 5, 11, 1, 2, 7}, // '}'
+    {2628, 7, 2, 0, 7, 7}, // '~'
+};
+
+const FONT_TypeDef font_mono_12 = {
+    .Atlas = atlas,
+    .Glyphs = glyphs,
+    .First = 32,
+    .Count = 95,
+    .Default = 31,
+    .Bpp = FONT_4BPP,
+    .Height = 15,
+    .Baseline = 12,
+};
@@ -0,0 +1,184 @@
+// Generated by scripts/fonts/fontpack.py from DejaVuSansMono-Bold.ttf at 16 px, 1 bpp
+#include "font_mono_bold_16.h"
+
+static const uint8_t atlas[1118] = {
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc,
+    0x09, 0x80, 0x19, 0x00, 0x1b, 0x00, 0x7f, 0xc0, 0x7f, 0xc0, 0x33, 0x00, 0x32, 0x00, 0xff, 0x80,
+    0xff, 0x80, 0x26, 0x00, 0x64, 0x00, 0x6c, 0x00, 0x10, 0x10, 0x3e, 0x7e, 0xf0, 0xf8, 0x7c, 0x1e,
+    0x16, 0x96, 0xfe, 0x7c, 0x10, 0x10, 0x70, 0x00, 0x58, 0x00, 0xc8, 0x00, 0x58, 0x00, 0x70, 0x80,
+    0x06, 0x00, 0x10, 0x00, 0x43, 0x00, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x03, 0x00, 0x1c, 0x00,
+    0x3e, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0x6c, 0x80, 0xee, 0x80, 0xe7, 0x80,
+    0xe3, 0x80, 0x7f, 0x80, 0x3d, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x30, 0x20, 0x60, 0x60, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0x60, 0x60, 0x20, 0x30, 0xc0, 0xc0, 0x60, 0x60, 0x60, 0x70, 0x70, 0x70,
+    0x70, 0x60, 0x60, 0x60, 0xc0, 0xc0, 0x10, 0x10, 0xd2, 0x7c, 0x7c, 0xd2, 0x10, 0x10, 0x18, 0x18,
+    0x18, 0xff, 0xff, 0x18, 0x18, 0x18, 0x60, 0x60, 0xe0, 0xc0, 0xc0, 0xf8, 0xf8, 0xc0, 0xc0, 0xc0,
+    0x03, 0x06, 0x06, 0x0c, 0x0c, 0x18, 0x18, 0x30, 0x30, 0x20, 0x60, 0x40, 0xc0, 0x3c, 0x7e, 0xe6,
+    0xc6, 0xc7, 0xdf, 0xdf, 0xc7, 0xc6, 0xe6, 0x7e, 0x3c, 0x38, 0x78, 0x58, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0xff, 0xff, 0x7c, 0xfe, 0x8e, 0x06, 0x06, 0x0e, 0x1c, 0x38, 0x70, 0xe0, 0xfe,
+    0xfe, 0x7c, 0xfe, 0x86, 0x06, 0x06, 0x3c, 0x3c, 0x06, 0x07, 0x86, 0xfe, 0x7c, 0x0e, 0x1e, 0x1e,
+    0x3e, 0x6e, 0x4e, 0xce, 0xff, 0xff, 0x0e, 0x0e, 0x0e, 0x7e, 0x7e, 0x40, 0x40, 0x7c, 0x7e, 0x06,
+    0x07, 0x07, 0x86, 0xfe, 0x78, 0x3c, 0x7e, 0x62, 0xe0, 0xfc, 0xfe, 0xe7, 0xe3, 0xe3, 0xe7, 0x7e,
+    0x3c, 0xfe, 0xfe, 0x06, 0x0e, 0x0c, 0x0c, 0x1c, 0x18, 0x38, 0x30, 0x30, 0x70, 0x3c, 0x7e, 0xe6,
+    0xc6, 0x66, 0x7c, 0x7e, 0xe6, 0xc7, 0xe6, 0x7e, 0x3c, 0x3c, 0x7e, 0xe6, 0xc6, 0xc7, 0xe7, 0xff,
+    0x7f, 0x06, 0x0e, 0x7c, 0x78, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x60, 0x60, 0x60,
+    0x00, 0x00, 0x60, 0x60, 0xe0, 0xc0, 0xc0, 0x01, 0x0f, 0x7c, 0xe0, 0xe0, 0x7c, 0x0f, 0x01, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x80, 0xf0, 0x7c, 0x0f, 0x0f, 0x3c, 0xf0, 0x80, 0x78, 0xfc, 0x8c,
+    0x0c, 0x1c, 0x38, 0x30, 0x70, 0x70, 0x00, 0x70, 0x70, 0x1e, 0x00, 0x3f, 0x00, 0x71, 0x80, 0x41,
+    0x80, 0xcf, 0x80, 0xdf, 0x80, 0xd9, 0x80, 0xdf, 0x80, 0xcf, 0x80, 0x60, 0x00, 0x70, 0x00, 0x3f,
+    0x80, 0x0f, 0x00, 0x1c, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x3e, 0x00, 0x36, 0x00, 0x33, 0x00, 0x33,
+    0x00, 0x7f, 0x00, 0x7f, 0x00, 0x63, 0x80, 0x61, 0x80, 0xe1, 0x80, 0xfc, 0xfe, 0xc7, 0xc7, 0xc6,
+    0xfe, 0xfe, 0xc7, 0xc3, 0xc7, 0xff, 0xfe, 0x1e, 0x3e, 0x70, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
+    0x70, 0x7e, 0x1e, 0xf8, 0xfe, 0xce, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xce, 0xfe, 0xf8, 0xff,
+    0xff, 0xe0, 0xe0, 0xe0, 0xfe, 0xfe, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe0,
+    0xfe, 0xfe, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x1e, 0x7e, 0x70, 0xe0, 0xc0, 0xc0, 0xcf, 0xcf, 0xe3,
+    0x63, 0x7f, 0x3e, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xff, 0xff, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xfe,
+    0xfe, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xfe, 0xfe, 0x3e, 0x3e, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x8e, 0xfc, 0x78, 0xc7, 0xc6, 0xcc, 0xdc, 0xf8, 0xf8, 0xfc, 0xec, 0xce,
+    0xc6, 0xc7, 0xc3, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0xfe, 0xe7,
+    0xe7, 0xe7, 0xef, 0xff, 0xfb, 0xdb, 0xdb, 0xc3, 0xc3, 0xc3, 0xc3, 0xe3, 0xe3, 0xe3, 0xf3, 0xf3,
+    0xd3, 0xdb, 0xcf, 0xcf, 0xcf, 0xc7, 0xc7, 0x3c, 0x7e, 0xe6, 0xc7, 0xc7, 0xc3, 0xc7, 0xc7, 0xc7,
+    0xe6, 0x7e, 0x3c, 0xfc, 0xfe, 0xe7, 0xe3, 0xe7, 0xfe, 0xfc, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x3c,
+    0x7e, 0xe6, 0xc7, 0xc7, 0xc3, 0xc7, 0xc7, 0xc7, 0xe6, 0x7e, 0x3c, 0x06, 0x06, 0xfc, 0xfe, 0xc6,
+    0xc7, 0xc6, 0xfe, 0xfc, 0xce, 0xc6, 0xc6, 0xc7, 0xc3, 0x3c, 0x7e, 0xe2, 0xc0, 0xe0, 0x7c, 0x3e,
+    0x06, 0x07, 0x87, 0xfe, 0x7c, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xe7, 0x7e, 0x3c, 0xc3, 0xc3, 0xc7,
+    0xc6, 0xe6, 0x66, 0x66, 0x6c, 0x7c, 0x3c, 0x3c, 0x3c, 0xc0, 0xc0, 0xc1, 0x80, 0xc1, 0x80, 0xcd,
+    0x80, 0x4d, 0x80, 0x7d, 0x80, 0x7d, 0x80, 0x77, 0x80, 0x77, 0x80, 0x73, 0x80, 0x73, 0x00, 0x73,
+    0x00, 0x61, 0x80, 0x73, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1e,
+    0x00, 0x3e, 0x00, 0x33, 0x00, 0x63, 0x80, 0xe1, 0x80, 0xe1, 0x80, 0x63, 0x80, 0x73, 0x00, 0x37,
+    0x00, 0x3e, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c,
+    0x00, 0xff, 0xff, 0x07, 0x0e, 0x0c, 0x1c, 0x38, 0x30, 0x70, 0xe0, 0xff, 0xff, 0xf0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xf0, 0xc0, 0x40, 0x60, 0x20, 0x30,
+    0x30, 0x18, 0x18, 0x0c, 0x0c, 0x06, 0x06, 0x03, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0x38, 0x3c, 0x66, 0xc3, 0xff, 0xc0, 0xc0, 0x60, 0x30, 0x3c,
+    0x7e, 0x47, 0x7f, 0xff, 0xc7, 0xc7, 0xff, 0x77, 0xc0, 0xc0, 0xc0, 0xdc, 0xfe, 0xe7, 0xe3, 0xc3,
+    0xe3, 0xe7, 0xfe, 0xdc, 0x3c, 0x7e, 0x70, 0xe0, 0xe0, 0xe0, 0x60, 0x7e, 0x3c, 0x06, 0x06, 0x06,
+    0x76, 0xfe, 0xe6, 0xc6, 0xc6, 0xc6, 0xe6, 0xfe, 0x76, 0x3c, 0x7e, 0xc7, 0xff, 0xff, 0xc0, 0xe1,
+    0x7f, 0x3e, 0x1e, 0x1e, 0x18, 0xfe, 0xfe, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x77, 0x7f,
+    0xe7, 0xc7, 0xc7, 0xc7, 0xe7, 0x7f, 0x7f, 0x06, 0x7e, 0x3c, 0xe0, 0xe0, 0xe0, 0xfc, 0xfe, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x18, 0x18, 0x18, 0x00, 0x78, 0x78, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x00, 0x7c, 0x7c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0xf8, 0xf0, 0xe0, 0xe0, 0xe0, 0xe7, 0xee, 0xfc, 0xf8, 0xfc, 0xec, 0xee, 0xe6, 0xe3, 0xf0,
+    0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x3f, 0x1f, 0xf6, 0xff, 0xdb, 0xdb, 0xdb,
+    0xdb, 0xdb, 0xdb, 0xdb, 0xfc, 0xfe, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x3c, 0x7e, 0xe7,
+    0xc7, 0xc3, 0xc7, 0xe7, 0x7e, 0x3c, 0xdc, 0xfe, 0xe7, 0xe3, 0xc3, 0xe3, 0xe7, 0xfe, 0xdc, 0xc0,
+    0xc0, 0xc0, 0x76, 0xfe, 0xe6, 0xc6, 0xc6, 0xc6, 0xe6, 0xfe, 0x76, 0x06, 0x06, 0x06, 0xee, 0xfe,
+    0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x3c, 0x7e, 0xe2, 0x60, 0x7c, 0x06, 0x46, 0xfe, 0x3c,
+    0x30, 0x30, 0xfe, 0xfe, 0x30, 0x30, 0x30, 0x30, 0x38, 0x3e, 0x1e, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0x7e, 0x76, 0xc3, 0xc7, 0xe6, 0x66, 0x6e, 0x6c, 0x3c, 0x3c, 0x38, 0xc0, 0xc0, 0xc1,
+    0x80, 0xcd, 0x80, 0x4d, 0x80, 0x7d, 0x80, 0x7f, 0x80, 0x77, 0x00, 0x73, 0x00, 0x33, 0x00, 0xe7,
+    0x6e, 0x7c, 0x3c, 0x38, 0x3c, 0x7c, 0xe6, 0xc7, 0xc3, 0xc7, 0xe6, 0x66, 0x6c, 0x3c, 0x3c, 0x38,
+    0x18, 0x38, 0xf0, 0xe0, 0xfe, 0xfe, 0x0e, 0x0c, 0x18, 0x30, 0x60, 0xfe, 0xfe, 0x0e, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x38, 0xf0, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0e, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xf0, 0x38, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x0e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0xf0, 0xf1, 0xff, 0x0e,
+};
+
+static const FONT_GlyphTypeDef glyphs[95] = {
+    {0, 0, 0, 0, 0, 10}, // ' '
+    {0, 2, 12, 4, 3, 10}, // '!'
+    {12, 6, 4, 2, 3, 10}, // '"'
+    {16, 10, 12, 0, 3, 10}, // '#'
+    {40, 7, 14, 1, 3, 10}, // '$'
+    {54, 9, 12, 0, 3, 10}, // '%'
+    {78, 9, 12, 0, 3, 10}, // '&'
+    {102, 2, 4, 4, 3, 10}, // "'"
+    {106, 4, 14, 3, 3, 10}, // '('
+    {120, 4, 14, 3, 3, 10}, // ')'
+    {134, 7, 8, 1, 3, 10}, // '*'
+    {142, 8, 8, 1, 6, 10}, // '+'
+    {150, 3, 5, 3, 12, 10}, // ','
+    {155, 5, 2, 2, 10, 10}, // '-'
+    {157, 2, 3, 4, 12, 10}, // '.'
+    {160, 8, 13, 1, 3, 10}, // '/'
+    {173, 8, 12, 1, 3, 10}, // '0'
+    {185, 8, 12, 1, 3, 10}, // '1'
+    {197, 7, 12, 1, 3, 10}, // '2'
+    {209, 8, 12, 1, 3, 10}, // '3'
+    {221, 8, 12, 1, 3, 10}, // '4'
+    {233, 8, 12, 1, 3, 10}, // '5'
+    {245, 8, 12, 1, 3, 10}, // '6'
+    {257, 7, 12, 1, 3, 10}, // '7'
+    {269, 8, 12, 1, 3, 10}, // '8'
+    {281, 8, 12, 1, 3, 10}, // '9'
+    {293, 2, 8, 4, 7, 10}, // ':'
+    {301, 3, 10, 3, 7, 10}, // ';'
+    {311, 8, 8, 1, 6, 10}, // '<'
+    {319, 8, 6, 1, 7, 10}, // '='
+    {325, 8, 8, 1, 6, 10}, // '>'
+    {333, 6, 12, 2, 3, 10}, // '?'
+    {345, 9, 13, 0, 4, 10}, // '@'
+    {371, 9, 12, 0, 3, 10}, // 'A'
+    {395, 8, 12, 1, 3, 10}, // 'B'
+    {407, 7, 12, 1, 3, 10}, // 'C'
+    {419, 8, 12, 1, 3, 10}, // 'D'
+    {431, 8, 12, 1, 3, 10}, // 'E'
+    {443, 8, 12, 1, 3, 10}, // 'F'
+    {455, 8, 12, 1, 3, 10}, // 'G'
+    {467, 8, 12, 1, 3, 10}, // 'H'
+    {479, 7, 12, 1, 3, 10}, // 'I'
+    {491, 7, 12, 1, 3, 10}, // 'J'
+    {503, 8, 12, 1, 3, 10}, // 'K'
+    {515, 7, 12, 2, 3, 10}, // 'L'
+    {527, 8, 12, 1, 3, 10}, // 'M'
+    {539, 8, 12, 1, 3, 10}, // 'N'
+    {551, 8, 12, 1, 3, 10}, // 'O'
+    {563, 8, 12, 1, 3, 10}, // 'P'
+    {575, 8, 14, 1, 3, 10}, // 'Q'
+    {589, 8, 12, 1, 3, 10}, // 'R'
+    {601, 8, 12, 1, 3, 10}, // 'S'
+    {613, 8, 12, 1, 3, 10}, // 'T'
+    {625, 8, 12, 1, 3, 10}, // 'U'
+    {637, 8, 12, 1, 3, 10}, // 'V'
+    {649, 10, 12, 0, 3, 10}, // 'W'
+    {673, 9, 12, 0, 3, 10}, // 'X'
+    {697, 9, 12, 0, 3, 10}, // 'Y'
+    {721, 8, 12, 1, 3, 10}, // 'Z'
+    {733, 4, 14, 3, 3, 10}, // '['
+    {747, 8, 13, 1, 3, 10}, // '\\'
+    {760, 4, 14, 2, 3, 10}, // ']'
+    {774, 8, 4, 1, 3, 10}, // '^'
+    {778, 10, 1, 0, 18, 10}, // '_'
+    {780, 4, 3, 2, 2, 10}, // '`'
+    {783, 8, 9, 1, 6, 10}, // 'a'
+    {792, 8, 12, 1, 3, 10}, // 'b'
+    {804, 7, 9, 1, 6, 10}, // 'c'
+    {813, 7, 12, 1, 3, 10}, // 'd'
+    {825, 8, 9, 1, 6, 10}, // 'e'
+    {834, 7, 12, 1, 3, 10}, // 'f'
+    {846, 8, 12, 1, 6, 10}, // 'g'
+    {858, 7, 12, 1, 3, 10}, // 'h'
+    {870, 8, 13, 1, 2, 10}, // 'i'
+    {883, 6, 16, 1, 2, 10}, // 'j'
+    {899, 8, 12, 1, 3, 10}, // 'k'
+    {911, 8, 12, 1, 3, 10}, // 'l'
+    {923, 8, 9, 1, 6, 10}, // 'm'
+    {932, 7, 9, 1, 6, 10}, // 'n'
+    {941, 8, 9, 1, 6, 10}, // 'o'
+    {950, 8, 12, 1, 6, 10}, // 'p'
+    {962, 7, 12, 1, 6, 10}, // 'q'
+    {974, 7, 9, 2, 6, 10}, // 'r'
+    {983, 7, 9, 1, 6, 10}, // 's'
+    {992, 7, 11, 1, 4, 10}, // 't'
+    {1003, 7, 9, 1, 6, 10}, // 'u'
+    {1012, 8, 9, 1, 6, 10}, // 'v'
+    {1021, 10, 9, 0, 6, 10}, // 'w'
+    {1039, 8, 9, 1, 6, 10}, // 'x'
+    {1048, 8, 12, 1, 6, 10}, // 'y'
+    {1060, 7, 9, 1, 6, 10}, // 'z'
+    {1069, 7, 15, 1, 3, 10}, // '{'
+    {1084, 2, 16, 4, 3, 10}, // '|'
+    {1100, 7, 15, 1, 3, 10}, // '}'
+    {1115, 8, 3, 1, 8, 10}, // '~'
+};
+
+const FONT_TypeDef font_mono_bold_16 = {
+    .Atlas = atlas,
+    .Glyphs = glyphs,
+    .First = 32,
+    .Count = 95,
+    .Default = 31,
+    .Bpp = FONT_1BPP,
+    .Height = 19,
+    .Baseline = 15,
+};
@@ -0,0 +1,414 @@
+#include <math.h>
+#include <string.h>
+#include "mfd.h"
+#include "tile.h"
+#include "rotate.h"
+#include "vector.h"
+#include "event.h"
+
+#define NEEDLE_WIDTH 3
+#define HUB_RADIUS 4
+
+static uint16_t buffers[2][MFD_BUFFER_PIXELS];
+static uint8_t back = 0;
+
+static MFD_WidgetTypeDef widgets[MFD_MAX_WIDGETS];
+static uint8_t widgetCount = 0;
+
+static const uint16_t *background = NULL;
+static uint16_t backgroundWidth;
+static uint16_t backgroundHeight;
+static int32_t originX = 0;
+static int32_t originY = 0;
+
+static MFD_StatsTypeDef stats;
+
+void MFD_clear(void) {
+  widgetCount = 0;
+}
+
+static MFD_WidgetTypeDef *MFD_add(MFD_WidgetTypeTypeDef type, uint16_t x, uint16_t y, uint16_t width,
+                                  uint16_t height, int32_t min, int32_t max, uint16_t color) {
+  if (widgetCount >= MFD_MAX_WIDGETS || width == 0 || height == 0 || max <= min) {
+    return NULL;
+  }
+
+  MFD_WidgetTypeDef *widget = &widgets[widgetCount++];
+  memset(widget, 0, sizeof(*widget));
+  widget->Type = type;
+  widget->Rect = (DISP_RectTypeDef) {x, y, width, height};
+  widget->Min = min;
+  widget->Max = max;
+  widget->Value = min;
+  widget->Drawn = min;
+  widget->Invalid = 1;
+  widget->Color = color;
+  return widget;
+}
+
+uint8_t MFD_gauge(uint16_t x, uint16_t y, uint16_t width, uint16_t height, int32_t min, int32_t max, int16_t start,
+                  int16_t sweep, uint16_t color) {
+  MFD_WidgetTypeDef *widget = MFD_add(MFD_GAUGE, x, y, width, height, min, max, color);
+  if (widget == NULL) {
+    return 0;
+  }
+
+  widget->Start = start;
+  widget->Sweep = sweep;
+  return 1;
+}
+
+uint8_t MFD_bar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, int32_t min, int32_t max, uint8_t vertical,
+                uint16_t color) {
+  MFD_WidgetTypeDef *widget = MFD_add(MFD_BAR, x, y, width, height, min, max, color);
+  if (widget == NULL) {
+    return 0;
+  }
+
+  widget->Vertical = vertical;
+  return 1;
+}
+
+uint8_t MFD_readout(uint16_t x, uint16_t y, const FONT_TypeDef *font, uint8_t digits, uint8_t decimals, int32_t min,
+                    int32_t max, uint16_t color) {
+  if (digits == 0 || digits >= MFD_TEXT_LENGTH) {
+    return 0;
+  }
+
+  // Sized for the widest digit string, the fonts are monospaced
+  MFD_WidgetTypeDef *widget = MFD_add(MFD_READOUT, x, y, digits * FONT_measure(font, "0"), font->Height, min, max,
+                                      color);
+  if (widget == NULL) {
+    return 0;
+  }
+
+  widget->Font = font;
+  widget->Digits = digits;
+  widget->Decimals = decimals;
+  return 1;
+}
+
+uint8_t MFD_getCount(void) {
+  return widgetCount;
+}
+
+void MFD_setBackground(const uint16_t *bitmap, uint16_t width, uint16_t height, uint16_t x, uint16_t y) {
+  background = bitmap;
+  backgroundWidth = width;
+  backgroundHeight = height;
+  originX = x;
+  originY = y;
+
+  for (uint8_t i = 0; i < widgetCount; i++) {
+    widgets[i].Invalid = 1;
+  }
+}
+
+uint8_t MFD_setValue(uint8_t index, int32_t value) {
+  if (index >= widgetCount) {
+    return 0;
+  }
+
+  MFD_WidgetTypeDef *widget = &widgets[index];
+  if (value < widget->Min) value = widget->Min;
+  if (value > widget->Max) value = widget->Max;
+  widget->Value = value;
+  return 1;
+}
+
+/**
+ * Digits characters with the sign and decimal point, padded with spaces on the left
+ * so every glyph keeps its cell while the value changes
+ */
+static void MFD_format(const MFD_WidgetTypeDef *widget, int32_t value, char *text) {
+  char digits[MFD_TEXT_LENGTH];
+  uint8_t n = 0;
+  uint32_t v = value < 0 ? -(uint32_t) value : (uint32_t) value;
+
+  do {
+    if (n == widget->Decimals && n > 0) {
+      digits[n++] = '.';
+    }
+    digits[n++] = (char) ('0' + v % 10);
+    v /= 10;
+  } while ((v > 0 || n <= widget->Decimals) && n < MFD_TEXT_LENGTH - 2);
+
+  if (value < 0) {
+    digits[n++] = '-';
+  }
+
+  uint8_t length = 0;
+  while (length + n < widget->Digits) {
+    text[length++] = ' ';
+  }
+  // Too wide for the field, the leading characters are dropped
+  for (uint8_t i = n > widget->Digits ? widget->Digits : n; i > 0; i--) {
+    text[length++] = digits[i - 1];
+  }
+  text[length] = 0;
+}
+
+/**
+ * Tip of the needle, relative to the widget rect like the center
+ */
+static void MFD_getNeedle(const MFD_WidgetTypeDef *widget, int32_t value, int32_t *x, int32_t *y) {
+  int32_t cx = widget->Rect.Width / 2;
+  int32_t cy = widget->Rect.Height / 2;
+  int32_t size = widget->Rect.Width < widget->Rect.Height ? widget->Rect.Width : widget->Rect.Height;
+  float length = (float) (size / 2 - NEEDLE_WIDTH - 1);
+  float degrees = widget->Start + (float) widget->Sweep * (value - widget->Min) / (widget->Max - widget->Min);
+  float a = degrees * (float) M_PI / 180.0f;
+
+  *x = cx + (int32_t) lroundf(sinf(a) * length);
+  *y = cy - (int32_t) lroundf(cosf(a) * length);
+}
+
+/**
+ * Filled part of a bar, columns or rows counted from where it starts
+ */
+static int32_t MFD_getLevel(const MFD_WidgetTypeDef *widget, int32_t value) {
+  int32_t length = widget->Vertical ? widget->Rect.Height : widget->Rect.Width;
+  return (int32_t) ((int64_t) (value - widget->Min) * length / (widget->Max - widget->Min));
+}
+
+static void MFD_include(int32_t *box, int32_t x, int32_t y, int32_t margin) {
+  if (x - margin < box[0]) box[0] = x - margin;
+  if (y - margin < box[1]) box[1] = y - margin;
+  if (x + margin > box[2]) box[2] = x + margin;
+  if (y + margin > box[3]) box[3] = y + margin;
+}
+
+/**
+ * Part of the widget rect that differs between the drawn value and value, [x1, x2) x [y1, y2)
+ * relative to the rect. Returns 0 when nothing does. Readouts keep the text that will be drawn in Shown.
+ */
+static uint8_t MFD_getDirty(MFD_WidgetTypeDef *widget, int32_t value, int32_t *box) {
+  box[0] = 0;
+  box[1] = 0;
+  box[2] = widget->Rect.Width;
+  box[3] = widget->Rect.Height;
+
+  switch (widget->Type) {
+    case MFD_GAUGE: {
+      if (widget->Invalid) {
+        return 1;
+      }
+
+      int32_t x1, y1, x2, y2;
+      MFD_getNeedle(widget, widget->Drawn, &x1, &y1);
+      MFD_getNeedle(widget, value, &x2, &y2);
+      if (x1 == x2 && y1 == y2) {
+        return 0;
+      }
+
+      int32_t cx = widget->Rect.Width / 2;
+      int32_t cy = widget->Rect.Height / 2;
+      int32_t needle[4] = {cx, cy, cx, cy};
+      MFD_include(needle, cx, cy, HUB_RADIUS + 1);
+      MFD_include(needle, x1, y1, NEEDLE_WIDTH);
+      MFD_include(needle, x2, y2, NEEDLE_WIDTH);
+      needle[2]++;
+      needle[3]++;
+
+      // Clipped to the rect
+      for (uint8_t i = 0; i < 4; i++) {
+        if (needle[i] < 0) needle[i] = 0;
+        if (needle[i] > box[2 + (i & 1)]) needle[i] = box[2 + (i & 1)];
+      }
+      memcpy(box, needle, sizeof(needle));
+      return 1;
+    }
+    case MFD_BAR: {
+      if (widget->Invalid) {
+        return 1;
+      }
+
+      int32_t a = MFD_getLevel(widget, widget->Drawn);
+      int32_t b = MFD_getLevel(widget, value);
+      if (a == b) {
+        return 0;
+      }
+
+      int32_t from = a < b ? a : b;
+      int32_t to = a < b ? b : a;
+      if (widget->Vertical) {
+        box[1] = widget->Rect.Height - to;
+        box[3] = widget->Rect.Height - from;
+      } else {
+        box[0] = from;
+        box[2] = to;
+      }
+      return 1;
+    }
+    case MFD_READOUT: {
+      char text[MFD_TEXT_LENGTH];
+      MFD_format(widget, value, text);
+
+      uint32_t x1 = 0;
+      uint32_t x2 = widget->Rect.Width;
+      uint8_t dirty = widget->Invalid || FONT_diff(widget->Font, widget->Shown, text, &x1, &x2);
+      memcpy(widget->Shown, text, sizeof(text));
+      if (!dirty) {
+        return 0;
+      }
+
+      if (!widget->Invalid) {
+        box[0] = x1;
+        box[2] = x2 < widget->Rect.Width ? x2 : widget->Rect.Width;
+      }
+      return box[0] < box[2];
+    }
+    default: {
+      return 0;
+    }
+  }
+}
+
+/**
+ * Background of the screen rect at x, y in framebuffer order, black where the bitmap does not reach
+ */
+static void MFD_restore(int32_t x, int32_t y, uint16_t width, uint16_t lines, uint16_t *buffer) {
+  int32_t x1 = x > originX ? x : originX;
+  int32_t y1 = y > originY ? y : originY;
+  int32_t x2 = x + width < originX + backgroundWidth ? x + width : originX + backgroundWidth;
+  int32_t y2 = y + lines < originY + backgroundHeight ? y + lines : originY + backgroundHeight;
+
+  if (background == NULL || x1 >= x2 || y1 >= y2) {
+    memset(buffer, 0, (uint32_t) width * lines * 2);
+    return;
+  }
+  if (x1 > x || y1 > y || x2 < x + width || y2 < y + lines) {
+    memset(buffer, 0, (uint32_t) width * lines * 2);
+  }
+
+  ROTATE_copy(background, backgroundWidth, backgroundHeight, ROTATE_0, 0, x1 - originX, y1 - originY, x2 - x1,
+              y2 - y1, &buffer[(y1 - y) * width + (x1 - x)], width);
+}
+
+/**
+ * Widget drawn over the background into the buffer holding the screen rect at x, y
+ */
+static void MFD_compose(const MFD_WidgetTypeDef *widget, int32_t x, int32_t y, uint16_t width, uint16_t lines,
+                        uint16_t *buffer) {
+  MFD_restore(x, y, width, lines, buffer);
+
+  VECTOR_TargetTypeDef target = {
+      .Buffer = buffer,
+      .Stride = width,
+      .X1 = 0,
+      .Y1 = 0,
+      .X2 = width - 1,
+      .Y2 = lines - 1,
+  };
+
+  // Widget rect origin in buffer coordinates
+  int32_t left = originX + widget->Rect.X - x;
+  int32_t top = originY + widget->Rect.Y - y;
+  uint16_t color = DISP_SwapRedBlue(widget->Color);
+
+  switch (widget->Type) {
+    case MFD_GAUGE: {
+      int32_t tipX, tipY;
+      MFD_getNeedle(widget, widget->Drawn, &tipX, &tipY);
+      int32_t cx = left + widget->Rect.Width / 2;
+      int32_t cy = top + widget->Rect.Height / 2;
+      VECTOR_thickLine(&target, cx, cy, left + tipX, top + tipY, NEEDLE_WIDTH, color);
+      VECTOR_circle(&target, cx, cy, HUB_RADIUS, 1, color);
+      break;
+    }
+    case MFD_BAR: {
+      int32_t level = MFD_getLevel(widget, widget->Drawn);
+      int32_t x1 = left;
+      int32_t x2 = left + widget->Rect.Width - 1;
+      int32_t y1 = top;
+      int32_t y2 = top + widget->Rect.Height - 1;
+      if (widget->Vertical) {
+        y1 = y2 - level + 1;
+      } else {
+        x2 = x1 + level - 1;
+      }
+      for (int32_t row = y1; row <= y2 && x1 <= x2; row++) {
+        VECTOR_span(&target, row, x1, x2, color);
+      }
+      break;
+    }
+    case MFD_READOUT: {
+      for (int32_t row = 0; row < lines; row++) {
+        int32_t textRow = row - top;
+        if (textRow >= 0 && textRow < widget->Font->Height) {
+          FONT_drawRow(widget->Font, widget->Shown, textRow, &buffer[row * width], left, 0, width, color, 0, 0);
+        }
+      }
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+}
+
+static void MFD_redraw(MFD_WidgetTypeDef *widget) {
+  // Values may change from interrupts, the one sampled here is drawn
+  int32_t value = widget->Value;
+  int32_t box[4];
+  uint8_t dirty = MFD_getDirty(widget, value, box);
+  widget->Drawn = value;
+  widget->Invalid = 0;
+  if (!dirty) {
+    return;
+  }
+
+  // Clipped to the screen
+  int32_t x1 = originX + widget->Rect.X + box[0];
+  int32_t y1 = originY + widget->Rect.Y + box[1];
+  int32_t x2 = originX + widget->Rect.X + box[2];
+  int32_t y2 = originY + widget->Rect.Y + box[3];
+  if (x2 > (int32_t) DISP_getScreenWidth()) x2 = DISP_getScreenWidth();
+  if (y2 > (int32_t) DISP_getScreenHeight()) y2 = DISP_getScreenHeight();
+  if (x1 >= x2 || y1 >= y2) {
+    return;
+  }
+
+  uint16_t width = x2 - x1;
+  uint16_t lines = MFD_BUFFER_PIXELS / width;
+  for (int32_t y = y1; y < y2; y += lines) {
+    uint16_t n = y2 - y < lines ? y2 - y : lines;
+    // The other buffer may still be flushing, this one is free
+    MFD_compose(widget, x1, y, width, n, buffers[back]);
+    TILE_flushRect(buffers[back], x1, y, width, n);
+    back ^= 1;
+  }
+
+  stats.Redraws++;
+  stats.Pixels += (uint32_t) width * (y2 - y1);
+}
+
+void MFD_tick(void) {
+  uint32_t start = EVENT_cycles();
+  uint8_t drawn = 0;
+
+  for (uint8_t i = 0; i < widgetCount; i++) {
+    MFD_WidgetTypeDef *widget = &widgets[i];
+    if (widget->Invalid || widget->Value != widget->Drawn) {
+      MFD_redraw(widget);
+      drawn = 1;
+    }
+  }
+
+  if (drawn) {
+    TILE_wait();
+    uint32_t cycles = EVENT_cycles() - start;
+    stats.Cycles += cycles;
+    if (cycles > stats.MaxCycles) {
+      stats.MaxCycles = cycles;
+    }
+  }
+}
+
+MFD_StatsTypeDef MFD_getStats(void) {
+  return stats;
+}
+
+void MFD_resetStats(void) {
+  memset(&stats, 0, sizeof(stats));
+}
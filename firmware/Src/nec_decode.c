@@ -7,52 +7,92 @@
 
 #include "nec_decode.h"
 
-void NEC_TIM_IC_CaptureCallback(NEC *handle) {
-  if (handle->state == NEC_INIT) {
-    HAL_TIM_IC_Stop_DMA(handle->timerHandle, handle->timerChannel);
-
-    if (handle->rawTimerData[1] < handle->timingAgcBoundary) {
-      handle->state = NEC_OK;
-      handle->NEC_RepeatCallback();
-    } else {
-      handle->state = NEC_AGC_OK;
-      HAL_TIM_IC_Start_DMA(handle->timerHandle, handle->timerChannel,
-                           (uint32_t *) handle->rawTimerData, 32);
-    }
+// Periods in us: AGC 9 ms + 4.5 ms, repeat 9 ms + 2.25 ms, bits 1.125 ms and 2.25 ms
+#define NEC_AGC_MAX 15000
+#define NEC_REPEAT_MIN 10000
+#define NEC_BIT_MAX 2800
+
+// Repeats follow the frame or the previous repeat every 108 ms
+#define NEC_REPEAT_WINDOW_MS 150
 
-  } else if (handle->state == NEC_AGC_OK) {
-    HAL_TIM_IC_Stop_DMA(handle->timerHandle, handle->timerChannel);
+static void NEC_Edge(NEC *handle, uint32_t period) {
+  uint8_t agc = period >= handle->timingAgcBoundary && period <= NEC_AGC_MAX;
 
-    for (int pos = 0; pos < 32; pos++) {
-      int time = handle->rawTimerData[pos];
-      if (time > handle->timingBitBoundary) {
+  if (handle->state == NEC_DATA) {
+    if (period <= NEC_BIT_MAX) {
+      uint8_t pos = handle->bitCount++;
+      if (period > handle->timingBitBoundary) {
         handle->decoded[pos / 8] |= 1 << (pos % 8);
       } else {
         handle->decoded[pos / 8] &= ~(1 << (pos % 8));
       }
-    }
 
-    uint8_t valid = 1;
+      if (handle->bitCount < 32) {
+        return;
+      }
+
+      handle->state = NEC_IDLE;
+
+      uint8_t valid = 1;
+
+      uint8_t naddr = ~handle->decoded[0];
+      uint8_t ncmd = ~handle->decoded[2];
+
+      if (handle->type == NEC_NOT_EXTENDED && handle->decoded[1] != naddr)
+        valid = 0;
+      if (handle->decoded[3] != ncmd)
+        valid = 0;
+
+      if (valid) {
+        handle->lastFrameTick = HAL_GetTick();
+        handle->NEC_DecodedCallback(handle->decoded[0], handle->decoded[2]);
+      } else {
+        handle->NEC_ErrorCallback();
+      }
+      return;
+    }
 
-    uint8_t naddr = ~handle->decoded[0];
-    uint8_t ncmd = ~handle->decoded[2];
+    // A frame cut short, unless the period starts a new one
+    handle->state = NEC_IDLE;
+    handle->NEC_ErrorCallback();
+  }
 
-    if (handle->type == NEC_NOT_EXTENDED && handle->decoded[1] != naddr)
-      valid = 0;
-    if (handle->decoded[3] != ncmd)
-      valid = 0;
+  if (agc) {
+    handle->state = NEC_DATA;
+    handle->bitCount = 0;
+  } else if (period >= NEC_REPEAT_MIN && period < handle->timingAgcBoundary &&
+             HAL_GetTick() - handle->lastFrameTick <= NEC_REPEAT_WINDOW_MS) {
+    handle->lastFrameTick = HAL_GetTick();
+    handle->NEC_RepeatCallback();
+  }
+}
 
-    handle->state = NEC_OK;
+static void NEC_Process(NEC *handle) {
+  DMA_HandleTypeDef *hdma = handle->timerHandle->hdma[TIM_DMA_ID_CC1];
+  uint16_t writePos = NEC_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(hdma);
+  if (writePos == NEC_BUFFER_SIZE) {
+    writePos = 0;
+  }
 
-    if (valid)
-      handle->NEC_DecodedCallback(handle->decoded[0], handle->decoded[2]);
-    else
-      handle->NEC_ErrorCallback();
+  while (handle->readPos != writePos) {
+    NEC_Edge(handle, handle->rawTimerData[handle->readPos]);
+    handle->readPos = (handle->readPos + 1) % NEC_BUFFER_SIZE;
   }
 }
 
+void NEC_TIM_IC_CaptureCallback(NEC *handle) {
+  NEC_Process(handle);
+}
+
+void NEC_Poll(NEC *handle) {
+  __disable_irq();
+  NEC_Process(handle);
+  __enable_irq();
+}
+
 void NEC_Read(NEC *handle) {
-  handle->state = NEC_INIT;
+  handle->state = NEC_IDLE;
+  handle->readPos = 0;
   HAL_TIM_IC_Start_DMA(handle->timerHandle, handle->timerChannel,
-                       (uint32_t *) handle->rawTimerData, 2);
+                       (uint32_t *) handle->rawTimerData, NEC_BUFFER_SIZE);
 }
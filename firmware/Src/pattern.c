@@ -0,0 +1,473 @@
+#include <string.h>
+#include "pattern.h"
+#include "disp.h"
+
+// Studio range code of a level in percent, -2% stays above code 0 for the PLUGE
+#define LEVEL(percent) (16 + (219 * (percent) + 50) / 100)
+
+// RGB888 to RGB565 in framebuffer order, red and blue swapped like DISP_SwapRedBlue
+#define RGB(r, g, b) ((uint16_t) ((((b) >> 3) << 11) | (((g) >> 2) << 5) | ((r) >> 3)))
+
+#define L0 LEVEL(0)
+#define L75 LEVEL(75)
+#define L100 LEVEL(100)
+
+#define WHITE_75 RGB(L75, L75, L75)
+#define YELLOW_75 RGB(L75, L75, L0)
+#define CYAN_75 RGB(L0, L75, L75)
+#define GREEN_75 RGB(L0, L75, L0)
+#define MAGENTA_75 RGB(L75, L0, L75)
+#define RED_75 RGB(L75, L0, L0)
+#define BLUE_75 RGB(L0, L0, L75)
+
+#define BLACK RGB(L0, L0, L0)
+#define WHITE RGB(L100, L100, L100)
+#define GRAY(percent) RGB(LEVEL(percent), LEVEL(percent), LEVEL(percent))
+
+// Rows with the same key are identical and copied from the cache
+#define NO_KEY UINT32_MAX
+
+// sin over one cycle, 0..255 around 128
+static const uint8_t sineTable[256] = {
+    128, 131, 134, 137, 140, 143, 146, 149, 152, 155, 158, 162, 165, 167, 170, 173,
+    176, 179, 182, 185, 188, 190, 193, 196, 198, 201, 203, 206, 208, 211, 213, 215,
+    218, 220, 222, 224, 226, 228, 230, 232, 234, 235, 237, 238, 240, 241, 243, 244,
+    245, 246, 248, 249, 250, 250, 251, 252, 253, 253, 254, 254, 254, 255, 255, 255,
+    255, 255, 255, 255, 254, 254, 254, 253, 253, 252, 251, 250, 250, 249, 248, 246,
+    245, 244, 243, 241, 240, 238, 237, 235, 234, 232, 230, 228, 226, 224, 222, 220,
+    218, 215, 213, 211, 208, 206, 203, 201, 198, 196, 193, 190, 188, 185, 182, 179,
+    176, 173, 170, 167, 165, 162, 158, 155, 152, 149, 146, 143, 140, 137, 134, 131,
+    128, 124, 121, 118, 115, 112, 109, 106, 103, 100,  97,  93,  90,  88,  85,  82,
+     79,  76,  73,  70,  67,  65,  62,  59,  57,  54,  52,  49,  47,  44,  42,  40,
+     37,  35,  33,  31,  29,  27,  25,  23,  21,  20,  18,  17,  15,  14,  12,  11,
+     10,   9,   7,   6,   5,   5,   4,   3,   2,   2,   1,   1,   1,   0,   0,   0,
+      0,   0,   0,   0,   1,   1,   1,   2,   2,   3,   4,   5,   5,   6,   7,   9,
+     10,  11,  12,  14,  15,  17,  18,  20,  21,  23,  25,  27,  29,  31,  33,  35,
+     37,  40,  42,  44,  47,  49,  52,  54,  57,  59,  62,  65,  67,  70,  73,  76,
+     79,  82,  85,  88,  90,  93,  97, 100, 103, 106, 109, 112, 115, 118, 121, 124,
+};
+
+// Gray code to RGB565, the same in either channel order
+static const uint16_t grayTable[256] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841,
+    0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,
+    0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2104,
+    0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965,
+    0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39C7,
+    0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228,
+    0x4A49, 0x4A49, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x528A, 0x528A,
+    0x52AA, 0x52AA, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB,
+    0x630C, 0x630C, 0x630C, 0x630C, 0x632C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D,
+    0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x738E, 0x738E, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x73AE, 0x73AE,
+    0x7BCF, 0x7BCF, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8410, 0x8410, 0x8410,
+    0x8430, 0x8430, 0x8430, 0x8430, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C71, 0x8C71, 0x8C71, 0x8C71,
+    0x9492, 0x9492, 0x9492, 0x9492, 0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3,
+    0x9CF3, 0x9CF3, 0x9CF3, 0x9CF3, 0xA514, 0xA514, 0xA514, 0xA514, 0xA534, 0xA534, 0xA534, 0xA534,
+    0xAD55, 0xAD55, 0xAD55, 0xAD55, 0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xB596, 0xB596, 0xB596, 0xB596,
+    0xB5B6, 0xB5B6, 0xB5B6, 0xB5B6, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7,
+    0xC618, 0xC618, 0xC618, 0xC618, 0xC638, 0xC638, 0xC638, 0xC638, 0xCE59, 0xCE59, 0xCE59, 0xCE59,
+    0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xD69A, 0xD69A, 0xD69A, 0xD69A, 0xD6BA, 0xD6BA, 0xD6BA, 0xD6BA,
+    0xDEDB, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE71C, 0xE71C,
+    0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D,
+    0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+};
+
+static uint16_t cache[PATTERN_MAX_WIDTH];
+static uint32_t cacheTag = NO_KEY;
+static uint32_t cacheKey = NO_KEY;
+
+/**
+ * Fills [x1, x2), clipped to the row
+ */
+static void PATTERN_span(uint16_t *row, int32_t width, int32_t x1, int32_t x2, uint16_t color) {
+  if (x1 < 0) x1 = 0;
+  if (x2 > width) x2 = width;
+  for (int32_t x = x1; x < x2; x++) {
+    row[x] = color;
+  }
+}
+
+/**
+ * Position at num / den of size
+ */
+static int32_t PATTERN_at(int32_t size, int32_t num, int32_t den) {
+  return size * num / den;
+}
+
+static int32_t PATTERN_mod(int32_t value, int32_t size) {
+  value %= size;
+  return value < 0 ? value + size : value;
+}
+
+static int32_t PATTERN_div(int32_t value, int32_t size) {
+  return value >= 0 ? value / size : -((size - 1 - value) / size);
+}
+
+static uint32_t PATTERN_isqrt(uint32_t value) {
+  uint32_t result = 0;
+  uint32_t bit = 1UL << 30;
+
+  while (bit > value) {
+    bit >>= 2;
+  }
+  while (bit != 0) {
+    if (value >= result + bit) {
+      value -= result + bit;
+      result = (result >> 1) + bit;
+    } else {
+      result >>= 1;
+    }
+    bit >>= 2;
+  }
+  return result;
+}
+
+/**
+ * Horizontal pixels that look as wide as size lines on a 4:3 display, at least 1
+ */
+static int32_t PATTERN_scaleX(int32_t size, int32_t width, int32_t height) {
+  int32_t result = size * width * 3 / (height * 4);
+  return result > 0 ? result : 1;
+}
+
+/**
+ * Gray ramp over [x1, x2) from code a to code b
+ */
+static void PATTERN_ramp(uint16_t *row, int32_t width, int32_t x1, int32_t x2, uint8_t a, uint8_t b) {
+  int32_t span = x2 - x1 - 1;
+  for (int32_t x = x1 < 0 ? 0 : x1; x < x2 && x < width; x++) {
+    row[x] = grayTable[span > 0 ? a + (b - a) * (x - x1) / span : a];
+  }
+}
+
+/**
+ * Heights in 12ths: bars 7, then one each for the cyan/blue and yellow/ramp/red rows, 3 for the PLUGE row
+ */
+static uint32_t PATTERN_smpteKey(int32_t y, int32_t height) {
+  int32_t part = y * 12 / height;
+  return part < 7 ? 0 : part < 8 ? 1 : part < 9 ? 2 : 3;
+}
+
+/**
+ * Widths in 56ths, 40% gray sides of 7 and seven bars of 6 in between
+ */
+static void PATTERN_smpte(uint16_t *row, int32_t y, int32_t width, int32_t height) {
+  static const uint16_t bars[7] = {WHITE_75, YELLOW_75, CYAN_75, GREEN_75, MAGENTA_75, RED_75, BLUE_75};
+
+  // 15% gray, black, white, black, PLUGE -2/0/+2/0/+4%, black, 15% gray
+  static const uint8_t plugeEdges[12] = {0, 7, 16, 28, 33, 35, 37, 39, 41, 43, 49, 56};
+  static const uint16_t plugeColors[11] = {
+      GRAY(15), BLACK, WHITE, BLACK, GRAY(-2), BLACK, GRAY(2), BLACK, GRAY(4), BLACK, GRAY(15),
+  };
+
+  switch (PATTERN_smpteKey(y, height)) {
+    case 0: {
+      PATTERN_span(row, width, 0, PATTERN_at(width, 7, 56), GRAY(40));
+      for (int32_t i = 0; i < 7; i++) {
+        PATTERN_span(row, width, PATTERN_at(width, 7 + i * 6, 56), PATTERN_at(width, 13 + i * 6, 56), bars[i]);
+      }
+      PATTERN_span(row, width, PATTERN_at(width, 49, 56), width, GRAY(40));
+      break;
+    }
+    case 1: {
+      PATTERN_span(row, width, 0, PATTERN_at(width, 7, 56), RGB(L0, L100, L100));
+      PATTERN_span(row, width, PATTERN_at(width, 7, 56), PATTERN_at(width, 49, 56), WHITE_75);
+      PATTERN_span(row, width, PATTERN_at(width, 49, 56), width, RGB(L0, L0, L100));
+      break;
+    }
+    case 2: {
+      PATTERN_span(row, width, 0, PATTERN_at(width, 7, 56), RGB(L100, L100, L0));
+      PATTERN_span(row, width, PATTERN_at(width, 7, 56), PATTERN_at(width, 13, 56), BLACK);
+      PATTERN_ramp(row, width, PATTERN_at(width, 13, 56), PATTERN_at(width, 43, 56), L0, L100);
+      PATTERN_span(row, width, PATTERN_at(width, 43, 56), PATTERN_at(width, 49, 56), WHITE);
+      PATTERN_span(row, width, PATTERN_at(width, 49, 56), width, RGB(L100, L0, L0));
+      break;
+    }
+    default: {
+      for (int32_t i = 0; i < 11; i++) {
+        PATTERN_span(row, width, PATTERN_at(width, plugeEdges[i], 56), PATTERN_at(width, plugeEdges[i + 1], 56),
+                     plugeColors[i]);
+      }
+      break;
+    }
+  }
+}
+
+/**
+ * 2 pixel lines, 14 cells high, square on a 4:3 display and centered
+ */
+static uint32_t PATTERN_gridKey(int32_t y, int32_t height) {
+  return PATTERN_mod(y - height / 2, height / 14) < 2;
+}
+
+static void PATTERN_grid(uint16_t *row, int32_t y, int32_t width, int32_t height, uint16_t background,
+                         uint16_t line) {
+  if (PATTERN_gridKey(y, height)) {
+    PATTERN_span(row, width, 0, width, line);
+    return;
+  }
+
+  int32_t cell = PATTERN_scaleX(height / 14, width, height);
+
+  PATTERN_span(row, width, 0, width, background);
+  for (int32_t x = width / 2 - (width / 2 / cell) * cell; x < width; x += cell) {
+    PATTERN_span(row, width, x, x + 2, line);
+  }
+}
+
+/**
+ * Gray background with a white grid and a circle split in seven bands: castellations, color bars,
+ * gray steps, center cross, gratings, black with a white pulse, castellations.
+ */
+static void PATTERN_circle(uint16_t *row, int32_t y, int32_t width, int32_t height) {
+  static const uint16_t bars[6] = {YELLOW_75, CYAN_75, GREEN_75, MAGENTA_75, RED_75, BLUE_75};
+  static const uint8_t periods[5] = {8, 6, 4, 3, 2};
+
+  PATTERN_grid(row, y, width, height, GRAY(50), WHITE);
+
+  int32_t radius = height * 7 / 16;
+  int32_t dy = y - height / 2;
+  if (dy <= -radius || dy >= radius) {
+    return;
+  }
+
+  int32_t centerX = width / 2;
+  int32_t radiusX = PATTERN_scaleX(radius, width, height);
+  int32_t half = PATTERN_scaleX(PATTERN_isqrt(radius * radius - dy * dy), width, height);
+  int32_t x1 = centerX - half;
+  int32_t x2 = centerX + half;
+  int32_t band = (dy + radius) * 7 / (radius * 2);
+  int32_t cell = PATTERN_scaleX(height / 14, width, height);
+
+  switch (band) {
+    case 0:
+    case 6: {
+      for (int32_t x = x1; x < x2; x++) {
+        row[x] = (PATTERN_div(x - centerX, cell) & 1) ^ (band == 6) ? BLACK : WHITE;
+      }
+      break;
+    }
+    case 1: {
+      for (int32_t i = 0; i < 6; i++) {
+        int32_t b1 = centerX - radiusX + PATTERN_at(radiusX * 2, i, 6);
+        int32_t b2 = centerX - radiusX + PATTERN_at(radiusX * 2, i + 1, 6);
+        PATTERN_span(row, width, b1 > x1 ? b1 : x1, b2 < x2 ? b2 : x2, bars[i]);
+      }
+      break;
+    }
+    case 2: {
+      for (int32_t i = 0; i < 5; i++) {
+        int32_t b1 = centerX - radiusX + PATTERN_at(radiusX * 2, i, 5);
+        int32_t b2 = centerX - radiusX + PATTERN_at(radiusX * 2, i + 1, 5);
+        PATTERN_span(row, width, b1 > x1 ? b1 : x1, b2 < x2 ? b2 : x2, GRAY(i * 25));
+      }
+      break;
+    }
+    case 3: {
+      PATTERN_span(row, width, x1, x2, dy >= -1 && dy < 1 ? WHITE : BLACK);
+      PATTERN_span(row, width, centerX - 1, centerX + 1, WHITE);
+      break;
+    }
+    case 4: {
+      for (int32_t i = 0; i < 5; i++) {
+        int32_t b1 = centerX - radiusX + PATTERN_at(radiusX * 2, i, 5);
+        int32_t b2 = centerX - radiusX + PATTERN_at(radiusX * 2, i + 1, 5);
+        if (b1 < x1) b1 = x1;
+        if (b2 > x2) b2 = x2;
+        for (int32_t x = b1; x < b2; x++) {
+          row[x] = PATTERN_mod(x - b1, periods[i]) < periods[i] / 2 ? WHITE : BLACK;
+        }
+      }
+      break;
+    }
+    default: {
+      PATTERN_span(row, width, x1, x2, BLACK);
+      PATTERN_span(row, width, centerX - radiusX / 4, centerX + radiusX / 4, WHITE);
+      break;
+    }
+  }
+
+  // Outline
+  PATTERN_span(row, width, x1, x1 + 2, WHITE);
+  PATTERN_span(row, width, x2 - 2, x2, WHITE);
+}
+
+/**
+ * White and black flag, then packets of 0.5, 1, 2, 3, 4 and 4.8 MHz on a 50% pedestal
+ */
+static void PATTERN_multiburst(uint16_t *row, int32_t width) {
+  static const uint16_t frequencies[6] = {500, 1000, 2000, 3000, 4000, 4800}; // kHz
+
+  uint32_t pixelClock = DISP_getLtdcPixelClockFreq() / 1000;
+  int32_t start = PATTERN_at(width, 1, 6);
+
+  PATTERN_span(row, width, 0, PATTERN_at(width, 1, 12), WHITE_75);
+  PATTERN_span(row, width, PATTERN_at(width, 1, 12), start, BLACK);
+
+  for (int32_t i = 0; i < 6; i++) {
+    int32_t x1 = start + PATTERN_at(width - start, i, 6);
+    int32_t x2 = start + PATTERN_at(width - start, i + 1, 6);
+    int32_t gap = (x2 - x1) / 8;
+
+    PATTERN_span(row, width, x1, x1 + gap, GRAY(50));
+    PATTERN_span(row, width, x2 - gap, x2, GRAY(50));
+
+    // Phase in 1/2^32 of a cycle, each packet starts at a zero crossing
+    uint32_t step = pixelClock ? (uint32_t) (((uint64_t) frequencies[i] << 32) / pixelClock) : 0;
+    uint32_t phase = 0;
+    for (int32_t x = x1 + gap; x < x2 - gap && x < width; x++) {
+      row[x] = grayTable[LEVEL(10) + (sineTable[phase >> 24] * (LEVEL(90) - LEVEL(10)) >> 8)];
+      phase += step;
+    }
+  }
+}
+
+/**
+ * Ramp on the top half, 11 level staircase below
+ */
+static void PATTERN_lumaRamp(uint16_t *row, int32_t y, int32_t width, int32_t height) {
+  if (y < height / 2) {
+    PATTERN_ramp(row, width, 0, width, L0, L100);
+    return;
+  }
+
+  for (int32_t i = 0; i < 11; i++) {
+    PATTERN_span(row, width, PATTERN_at(width, i, 11), PATTERN_at(width, i + 1, 11), GRAY(i * 10));
+  }
+}
+
+/**
+ * Black field with -2%, +2% and +4% bars and a column of 100/75/50/25% patches
+ */
+static uint32_t PATTERN_plugeKey(int32_t y, int32_t height) {
+  if (y < height / 6 || y >= height * 5 / 6) {
+    return 0;
+  }
+
+  uint32_t patch = 1 + (y - height / 6) * 4 / (height * 4 / 6);
+  return patch < 4 ? patch : 4;
+}
+
+static void PATTERN_pluge(uint16_t *row, int32_t y, int32_t width, int32_t height) {
+  PATTERN_span(row, width, 0, width, BLACK);
+
+  uint32_t key = PATTERN_plugeKey(y, height);
+  if (key == 0) {
+    return;
+  }
+
+  PATTERN_span(row, width, PATTERN_at(width, 4, 16), PATTERN_at(width, 5, 16), GRAY(-2));
+  PATTERN_span(row, width, PATTERN_at(width, 6, 16), PATTERN_at(width, 7, 16), GRAY(2));
+  PATTERN_span(row, width, PATTERN_at(width, 8, 16), PATTERN_at(width, 9, 16), GRAY(4));
+  PATTERN_span(row, width, PATTERN_at(width, 11, 16), PATTERN_at(width, 13, 16), GRAY(125 - (int32_t) key * 25));
+}
+
+static uint32_t PATTERN_checkerKey(int32_t y, int32_t height) {
+  return PATTERN_div(y - height / 2, height / 8) & 1;
+}
+
+/**
+ * 8 squares high, centered
+ */
+static void PATTERN_checkerboard(uint16_t *row, int32_t y, int32_t width, int32_t height) {
+  int32_t cell = PATTERN_scaleX(height / 8, width, height);
+  uint32_t odd = PATTERN_checkerKey(y, height);
+
+  for (int32_t x = width / 2 - (width / 2 / cell + 1) * cell, i = 0; x < width; x += cell, i++) {
+    PATTERN_span(row, width, x, x + cell, (i & 1) ^ odd ? WHITE : BLACK);
+  }
+}
+
+/**
+ * Circular zone plate, the frequency reaches Nyquist at the left and right edges.
+ * Coordinates are doubled so the center falls between pixels and rows are mirrored.
+ */
+static void PATTERN_zonePlate(uint16_t *row, int32_t y, int32_t width, int32_t height) {
+  int32_t dy = 2 * y + 1 - height;
+  int32_t dx = width & 1 ? 0 : 1;
+
+  // Phase in 1/2^32 of a cycle per squared doubled unit, grows by half a cycle per pixel at dx = width
+  uint32_t k = (uint32_t) ((1UL << 29) / (uint32_t) width);
+  uint32_t phase = (uint32_t) (dy * dy + dx * dx) * k;
+
+  // From the center outwards dx grows by 2 per pixel, so dx^2 by 4 * dx + 4
+  for (int32_t x = width / 2; x < width; x++) {
+    uint16_t color = grayTable[L0 + (sineTable[phase >> 24] * (L100 - L0) >> 8)];
+    row[x] = color;
+    row[width - 1 - x] = color;
+    phase += (uint32_t) (4 * dx + 4) * k;
+    dx += 2;
+  }
+}
+
+static uint32_t PATTERN_getKey(PATTERN_TypeDef pattern, int32_t y, int32_t height) {
+  switch (pattern) {
+    case PATTERN_SMPTE_BARS:
+      return PATTERN_smpteKey(y, height);
+    case PATTERN_MULTIBURST:
+      return 0;
+    case PATTERN_LUMA_RAMP:
+      return y < height / 2;
+    case PATTERN_PLUGE:
+      return PATTERN_plugeKey(y, height);
+    case PATTERN_CROSSHATCH:
+      return PATTERN_gridKey(y, height);
+    case PATTERN_CHECKERBOARD:
+      return PATTERN_checkerKey(y, height);
+    default:
+      return NO_KEY;
+  }
+}
+
+void PATTERN_drawRow(PATTERN_TypeDef pattern, uint16_t *row, uint16_t y, uint16_t width, uint16_t height) {
+  // Too small for the grids
+  if (height < 16) {
+    PATTERN_span(row, width, 0, width, BLACK);
+    return;
+  }
+
+  uint32_t key = PATTERN_getKey(pattern, y, height);
+  uint32_t tag = (uint32_t) pattern << 28 | (uint32_t) width << 14 | height;
+
+  if (key != NO_KEY && key == cacheKey && tag == cacheTag) {
+    memcpy(row, cache, width * 2);
+    return;
+  }
+
+  switch (pattern) {
+    case PATTERN_SMPTE_BARS:
+      PATTERN_smpte(row, y, width, height);
+      break;
+    case PATTERN_CIRCLE_CHART:
+      PATTERN_circle(row, y, width, height);
+      break;
+    case PATTERN_MULTIBURST:
+      PATTERN_multiburst(row, width);
+      break;
+    case PATTERN_LUMA_RAMP:
+      PATTERN_lumaRamp(row, y, width, height);
+      break;
+    case PATTERN_PLUGE:
+      PATTERN_pluge(row, y, width, height);
+      break;
+    case PATTERN_CROSSHATCH:
+      PATTERN_grid(row, y, width, height, BLACK, WHITE);
+      break;
+    case PATTERN_CHECKERBOARD:
+      PATTERN_checkerboard(row, y, width, height);
+      break;
+    case PATTERN_ZONE_PLATE:
+      PATTERN_zonePlate(row, y, width, height);
+      break;
+    default:
+      PATTERN_span(row, width, 0, width, BLACK);
+      break;
+  }
+
+  if (key != NO_KEY && width <= PATTERN_MAX_WIDTH) {
+    memcpy(cache, row, width * 2);
+    cacheKey = key;
+    cacheTag = tag;
+  }
+}
@@ -1,254 +0,0 @@
-#include "philips_pm5544_320_240.h"
-
-uint16_t *ptr_philips_pm5544_320_240;
-
-const uint16_t philips_pm5544_320_240[] = {
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9cf3, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x9cf3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9cf3, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x9cf3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0xf79e, 0xc638, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xffff, 0xbdd7, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xad55, 0xffff, 0xb596, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xb596, 0xffff, 0xad55, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xbdd7, 0xffff, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xc638, 0xf7be, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xce79, 0xf79e, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xd6ba, 0xef7d, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xdefb, 0xe71c, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xe71c, 0xdefb, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xef7d, 0xd6ba, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xf79e, 0xce79, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xf7be, 0xc638, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xffff, 0xbdd7, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xad55, 0xffff, 0xb596, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xb596, 0xffff, 0xad55, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xbdd7, 0xffff, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xc638, 0xf79e, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xdefb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xdefb, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xdefb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xdefb, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xdefb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xdefb, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xdefb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xdefb, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xdefb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xdefb, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xdefb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xdefb, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xdefb, 0x94b2, 0x9cf3, 0xa534, 0xad55, 0xad75, 0xb5b6, 0xbdd7, 0xbdd7, 0xbdd7, 0xbdd7, 0xb5b6, 0xad75, 0xad55, 0xa534, 0x9cf3, 0x94b2, 0xdefb, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x94b2, 0xad55, 0xbdf7, 0xce79, 0xdedb, 0xef5d, 0xf79e, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xf79e, 0xef5d, 0xdedb, 0xce79, 0xbdf7, 0xad55, 0x94b2, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8430, 0xa534, 0xc618, 0xd6ba, 0xef5d, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xef5d, 0xd6ba, 0xc618, 0xa534, 0x8430, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef7d, 0xb5b6, 0xd69a, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xd6ba, 0xb5b6, 0xef7d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0xb596, 0xd69a, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xd69a, 0xb596, 0x8430, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c71, 0xbdf7, 0xe71c, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xe71c, 0xbdf7, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c71, 0xbdf7, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0xc618, 0x8c71, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb596, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xb5b6, 0x8430, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x94b2, 0xce79, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xce79, 0x94b2, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0xf79e, 0xc638, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xffff, 0xbdd7, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xad55, 0xffff, 0xb596, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xb596, 0xffff, 0xad55, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xbdd7, 0xffff, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xc638, 0xf7be, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xce79, 0xf79e, 0xad75, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xb596, 0xf79e, 0xce79, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xf7be, 0xc638, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xffff, 0xbdd7, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xad55, 0xffff, 0xb596, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xb596, 0xffff, 0xad55, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xbdd7, 0xffff, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xc638, 0xf79e, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa534, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0x8430, 0xa534, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x8c71, 0xffff, 0x9615, 0x5d51, 0x5d51, 0x5d51, 0x5d51, 0x5d51, 0x5d51, 0x5d51, 0x5d51, 0x5d51, 0x5d51, 0x5d51, 0x5d51, 0x5d51, 0x5d51, 0x5d51, 0x6553, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x953d, 0xffff, 0x9cf3, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0xb596, 0xffff, 0x8c71, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0xbdf7, 0xf7be, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x94b2, 0xce59, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xce59, 0x94b2, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0xf7be, 0xbdf7, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x8c71, 0xffff, 0xb596, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9cf3, 0xffff, 0x953d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x6c5d, 0x8d0d, 0x8ce8, 0x8ce8, 0x8ce8, 0x8ce8, 0x8ce8, 0x8ce8, 0x8ce8, 0x8ce8, 0x8ce8, 0x8ce8, 0x8ce8, 0x8ce8, 0x8ce8, 0x8ce8, 0x8ce8, 0xadd1, 0xffff, 0x8c71, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0xc618, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xc618, 0x8430, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xbdd7, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xbdd7, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x94b2, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0x94b2, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0xce59, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xce59, 0x8430, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0xad55, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xad55, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8c51, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0x8c51, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0xa534, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xad55, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cd3, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0x9cd3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c71, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0x8c71, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xa514, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb596, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xb596, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0xb596, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xc618, 0xffff, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xffff, 0xc618, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xb596, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd6ba, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x8c71, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c71, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x4a69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x7bef, 0x4a69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 0x7bef, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x7bef, 0x4a49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a49, 0x7bef, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x7bef, 0x4a69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 0x7bef, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x7bef, 0x4a69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 0x7bef, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xb5b6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb5b6, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738e, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x6b6d, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x6b6d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x73ae, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x73ae, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5acb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x6b6d, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x6b6d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x44f1, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x84dd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bcf, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x7bcf, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x84dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x53dd, 0x7c8a, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x94b2, 0x94b2, 0x94b2, 0x94b2, 0x94b2, 0x94b2, 0x94b2, 0xf7be, 0xd69a, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x4d11, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xb61e, 0xffff, 0xbdf7, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb596, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x738e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0xb596, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xbdf7, 0xffff, 0xb61e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0xa59e, 0x84a9, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xd69a, 0xf7be, 0x94b2, 0x94b2, 0x94b2, 0x94b2, 0x94b2, 0x94b2, 0x94b2,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xffff, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xb5b6, 0x0000, 0x4228, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0xc618, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdd7, 0xbdf7, 0xbdf7, 0xbdf7, 0x4a49, 0x528a, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xc638, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdd7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xc638, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdd7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xc638, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdd7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xc638, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdd7, 0xbdf7, 0xbdf7, 0xbdf7, 0x8c71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x8c51, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb5b6, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xffff, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x738e, 0x0861, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x31a6, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdd7, 0x8430, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x5acb, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x738e, 0x0861, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x39c7, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xb5b7, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xa514, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x7bcf, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf7, 0x8c51, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x4a69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xad76, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x94b2, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xb5b6, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x9cd3, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x7bef, 0x31a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdd7, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x632c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x9cf4, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8c71, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdd7, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xad55, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x4a49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0xce79, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xce79, 0xd69a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630c, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xbdf8, 0xef7d, 0xce79, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xce79, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xdedb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xffff, 0xf7be, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0xf79e, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xf79e, 0xb5ae, 0x9cc1, 0x9cc1, 0x9cc1, 0x9cc1, 0x9cc1, 0x9cc1, 0x9cc1, 0x9cc1, 0x9cc1, 0x9cc1, 0x9cc1, 0xa508, 0xc610, 0xc610, 0xc610, 0xc610, 0xc610, 0xc610, 0xc610, 0xc610, 0xc610, 0xc610, 0xc610, 0x9cc1, 0x9cc1, 0x9cc1, 0x64cf, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x4514, 0x7e18, 0x7e18, 0x7e18, 0x7e18, 0x7e18, 0x7e18, 0x7e18, 0x7e18, 0x7e18, 0x7e18, 0x7e18, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x0cd3, 0x4514, 0x7e11, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x0cc1, 0x0cc1, 0x0cc1, 0x0cc1, 0x0cc1, 0x0cc1, 0x0cc1, 0x0cc1, 0x0cc1, 0x0cc1, 0x0cc1, 0x0cc1, 0x0cc1, 0x4508, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x7e10, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0xa214, 0xc3f8, 0xc3f8, 0xc3f8, 0xc3f8, 0xc3f8, 0xc3f8, 0xc3f8, 0xc3f8, 0xc3f8, 0xc3f8, 0xc3f8, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0x9873, 0x98b1, 0x9861, 0x9861, 0xa208, 0xc3f0, 0xc3f0, 0xc3f0, 0xc3f0, 0xc3f0, 0xc3f0, 0xc3f0, 0xc3f0, 0xc3f0, 0xc3f0, 0xc3f0, 0x9861, 0x9861, 0x9861, 0x9861, 0x9861, 0x9861, 0x9861, 0x9861, 0x9861, 0x9861, 0x9861, 0x9861, 0x9861, 0xa208, 0xc3f0, 0xc3f0, 0xc3f0, 0xc3f0, 0xc3f0, 0xc3f0, 0xc3f0, 0xabf3, 0x7bf8, 0x7bf8, 0x7bf8, 0x0873, 0x0873, 0x0873, 0x0873, 0x0873, 0x0873, 0x0873, 0x0873, 0x0873, 0x0873, 0x0873, 0x0873, 0x0873, 0x4214, 0x7bf8, 0x7bf8, 0x7bf8, 0x7bf8, 0x7bf8, 0x7bf8, 0x7bf8, 0x7bf8, 0x7bf8, 0x9cda, 0xf79e, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xf79e, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xf7be, 0xffff, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cce, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x73b3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb589, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x4a56, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c4f, 0xbde1, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0877, 0x7bd1, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xa52b, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x5af4, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x840f, 0xbdc5, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x2957, 0x7bf0, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9ccd, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x6b73, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb589, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x4a75, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x842f, 0xbde2, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x10b7, 0x7bf0, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cec, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x6333, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb588, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x4236, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c4f, 0xbde1, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x1097, 0x7bf1, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cec, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x6333, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb589, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x4a56, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x842f, 0xbde3, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x18f7, 0x7bf0, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x94ad, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x6b72, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad4b, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x5ad5, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xffdf, 0xdefb, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0xd6ba, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xbdea, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0460, 0x0460, 0x0460, 0x0460, 0x0460, 0x0460, 0x0460, 0x0460, 0x9632, 0xc4b8, 0x8811, 0x8811, 0x8811, 0x8811, 0x8811, 0x8811, 0x8811, 0x8811, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x5297, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xd6ba, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xdefb, 0xffdf, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0xef7d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5c, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0038, 0xe71d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef7d, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9ccd, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x6b73, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad4b, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x5ad5, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5a7, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x39f6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x842f, 0xbde2, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x10b7, 0x7bf0, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x948e, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x73b2, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xa50c, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x6334, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad4a, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x52b5, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5a8, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x4216, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xbde4, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x2137, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c4f, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x7bd1, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x948e, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x7392, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cec, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x6333, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xa52c, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x5af4, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb58e, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x5295, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc612, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x4236, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce74, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x31b7, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0xdefb, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xdef6, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0x7e13, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x05f7, 0x0e0a, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1002, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xb817, 0xc075, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0x988f, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x3198, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xdefb, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xffdf, 0xef5d, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0xe71c, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0x73ab, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x842b, 0xf79c, 0x7387, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0xad72, 0xdef9, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x6300, 0x3b09, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0xbe79, 0xae18, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0xd73c, 0x84f3, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x030c, 0x0304, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x5c2b, 0xe79c, 0x3b87, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x9572, 0xcef9, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xde7b, 0xacb5, 0x600c, 0x600c, 0x600c, 0x600c, 0x600c, 0x600c, 0x600c, 0x600c, 0x600c, 0x600c, 0x600c, 0x600c, 0x600c, 0x600c, 0x600c, 0x71ce, 0xf71e, 0x82f0, 0x600c, 0x600c, 0x600c, 0x600c, 0x600c, 0x600c, 0x600b, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x9c10, 0xe6ba, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0xc575, 0xcdd7, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x4827, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0xce7b, 0x94b5, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x39ce, 0xe71e, 0x5af0, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xe71c, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xef5d, 0xffdf, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738e, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738e, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b6d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b6d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0x8dd4, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x34ef, 0x5d51, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bcf, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x94b2, 0xffff, 0x8410, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0xbdf7, 0xef7d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0xdedb, 0xce79, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0xf79e, 0xad75, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x94b2, 0xffff, 0x8410, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0xbdf7, 0xef7d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0xd6ba, 0xd6ba, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0xef7d, 0xbdf7, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x8410, 0xffff, 0x94b2, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0xad75, 0xf79e, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0xce79, 0xdedb, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0xef7d, 0xbdf7, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x8410, 0xffff, 0x94b2, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x7bcf, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8ce8, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0x7c80, 0xa590, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xd4b4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb596, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb596, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x6b6d, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x6b6d, 0xffff, 0x4a49, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xad55, 0xef5d, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xd69a, 0xc638, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xf79e, 0x94b2, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x6b6d, 0xffff, 0x4a49, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xad55, 0xef5d, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xce79, 0xce79, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xef5d, 0xad55, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x4a49, 0xffff, 0x6b6d, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x94b2, 0xf79e, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xc638, 0xd69a, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xef5d, 0xad55, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x4a49, 0xffff, 0x6b6d, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x6b6d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b6d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738e, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738e, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xffdf, 0xef5d, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0xe71c, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xc618, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc618, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xe71c, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xdefb, 0xef5d, 0xffdf, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0xdefb, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x52aa, 0x8c51, 0xc618, 0xd6ba, 0xa514, 0x6b4d, 0x31a6, 0x0861, 0x5aeb, 0x94b2, 0xad55, 0xdedb, 0xbdd7, 0x8410, 0x4a69, 0x18c3, 0x2124, 0x5acb, 0x9492, 0xce59, 0xd69a, 0x9cd3, 0x632c, 0x2965, 0x1082, 0x4228, 0x94b2, 0xc618, 0xdedb, 0xb596, 0x7bcf, 0x4228, 0x1082, 0x2965, 0x630c, 0x9cd3, 0xd69a, 0xce59, 0x9492, 0x5aeb, 0x6b4d, 0xc638, 0x6b4d, 0x39c7, 0xce79, 0xa534, 0x2945, 0x8430, 0xc618, 0x4a49, 0x52aa, 0xc638, 0x7bcf, 0x2965, 0xad55, 0xad55, 0x2965, 0x7bcf, 0xc638, 0x52aa, 0x4a49, 0xc638, 0xad55, 0x3186, 0x9cd3, 0xb5b6, 0x39c7, 0x6b4d, 0xc638, 0x632c, 0x39e7, 0xbdd7, 0x94b2, 0x4228, 0xbdf7, 0x4a69, 0x94b2, 0x9cf3, 0x4a49, 0xc638, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xce79, 0x5aeb, 0xa534, 0x8430, 0x5acb, 0xbdd7, 0x39e7, 0xad55, 0x8410, 0x5aeb, 0xbdd7, 0x4228, 0xa534, 0x6b6d, 0x8c71, 0xa514, 0x52aa, 0xad55, 0x94b2, 0x9492, 0x9cf3, 0x52aa, 0xad55, 0x6b6d, 0x8c71, 0x9cf3, 0x52aa, 0xad55, 0x6b6d, 0x8c71, 0x9cf3, 0x52aa, 0xad55, 0x6b4d, 0x9492, 0xa534, 0x8410, 0xad55, 0x6b4d, 0x9492, 0x9cf3, 0x52aa, 0xad55, 0x6b4d, 0x9492, 0x9cf3, 0x52aa, 0xad55, 0x632c, 0x9492, 0x9cf3, 0x8430, 0x8430, 0x9492, 0x9cd3, 0x9492, 0x94b2, 0x8c51, 0x7bef, 0x8410, 0x8c71, 0x9cd3, 0x8c51, 0x8410, 0x7bef, 0x8c51, 0x9cd3, 0x8c51, 0x8410, 0x8410, 0x8c51, 0xb596, 0x9cd3, 0x8410, 0x7bef, 0x8c51, 0x94b2, 0x8c71, 0x8410, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x6b4d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xdefb, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xd6ba, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x31a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31a6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x5aeb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5aeb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x632c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x632c, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x738e, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x52aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x632c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x632c, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5acb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b6d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0xef7d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xe71c, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xe71c, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef7d, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xffdf, 0xdefb, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0xd6ba, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0x2945, 0x2945, 0x0861, 0x31a6, 0x0861, 0x2945, 0x2124, 0x1082, 0xce59, 0xc618, 0x2945, 0x2124, 0x1082, 0x31a6, 0x0861, 0x2965, 0x2124, 0x18c3, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xd6ba, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xdefb, 0xffdf, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7, 0xbdf7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5acb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b6d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x4a49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a49, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x632c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x632c, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x632c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x632c, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x4a69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b6d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x5aeb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5aeb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bcf, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x7bcf, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x4a49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a49, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef5d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc618, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd69a, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce59, 0xa514, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xffff, 0xf7be, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0xf79e, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xf79e, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5aeb, 0x9cd3, 0xd6ba, 0xef7d, 0xb596, 0x73ae, 0x39c7, 0x1082, 0x4208, 0x7bef, 0xbdd7, 0xef7d, 0xce79, 0x9492, 0x52aa, 0x18c3, 0x2945, 0x632c, 0xa514, 0xdefb, 0xe73c, 0xad55, 0x6b6d, 0x3186, 0x10a2, 0x4a69, 0x8430, 0xc638, 0xf79e, 0xc638, 0x8c51, 0x4a69, 0x10a2, 0x3186, 0x6b6d, 0xad55, 0xe73c, 0xdefb, 0xa514, 0x632c, 0x73ae, 0xdedb, 0x73ae, 0x39e7, 0xce59, 0xad55, 0x2965, 0x94b2, 0xd6ba, 0x528a, 0x630c, 0xdedb, 0x8430, 0x31a6, 0xbdd7, 0xbdd7, 0x31a6, 0x8430, 0xdedb, 0x630c, 0x528a, 0xd6ba, 0x94b2, 0x2965, 0xad55, 0xc638, 0x39e7, 0x73ae, 0xdedb, 0x6b6d, 0x4228, 0xce79, 0xa534, 0x4a49, 0xce79, 0x52aa, 0xa514, 0xad55, 0x4a69, 0xce79, 0x528a, 0xa534, 0xa534, 0x528a, 0xce79, 0x4a69, 0xad75, 0xa514, 0x52aa, 0xce79, 0x4a49, 0xb596, 0x9cf3, 0x5acb, 0xce79, 0x4228, 0xb5b6, 0x94b2, 0x5aeb, 0xce79, 0x4228, 0xb5b6, 0x9492, 0x630c, 0xce79, 0x4208, 0xbdd7, 0x8c71, 0x632c, 0xce79, 0x4a49, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xb596, 0x5aeb, 0xbdd7, 0x7bcf, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x5aeb, 0xbdd7, 0x73ae, 0x9cf3, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x630c, 0xbdd7, 0x738e, 0xa514, 0xad75, 0x9492, 0x94b2, 0x8c51, 0x9492, 0x9cf3, 0xa514, 0x94b2, 0x8c51, 0x8c71, 0x9cd3, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x94b2, 0x8c71, 0x8c71, 0x94b2, 0xad55, 0x9cd3, 0x8c71, 0x8c71, 0x94b2, 0xa534, 0x9cf3, 0x9492, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0xf79e, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xf79e, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xf7be, 0xffff, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d, 0xef5d,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0xce79, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xce79, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xce79, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xce79, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xdedb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x4a49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x7bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8c71, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0x94b2, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x632c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x7bef, 0x31a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0x8430, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdd7, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x39e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad55, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x4a69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x7bcf, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x94b2, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x39c7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x8430, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x738e, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa534, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0x31a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0x8c51, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x738e, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5aeb, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x632c, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xa534, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa534, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc391, 0xffff, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xffff, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xbdd7, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5aeb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x5acb, 0x4208, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x5acb, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x630c, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9cf3, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xc618, 0xce59, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xd69a, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xffff, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xffff, 0x8bde, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xf7be, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0x94b2, 0x94b2, 0x94b2, 0x94b2, 0x94b2, 0x94b2, 0x94b2, 0xf7be, 0xd69a, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xc34f, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xd615, 0xffff, 0xbdf7, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9cf3, 0xef7d, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xbdf7, 0xffff, 0xd615, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0xcd92, 0x839d, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xb5b6, 0xd69a, 0xf7be, 0x94b2, 0x94b2, 0x94b2, 0x94b2, 0x94b2, 0x94b2, 0x94b2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cd3, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x9cd3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xe73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c71, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0x8c71, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb596, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb596, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc638, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd6ba, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8430, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0x8430, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8430, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0x8430, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8430, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0x8430, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8430, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdefb, 0x8430, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x8c71, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0x8430, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad55, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x7bef, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c71, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x7bef, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xad73, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0xb595, 0xffff, 0x9490, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a20, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4800, 0x4a20, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0x4a60, 0xad53, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xf7bd, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce59, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0xb596, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xc618, 0xffff, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xa52e, 0xbde1, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde1, 0xa52e, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xffff, 0xc618, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xb596, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xad55, 0xce59, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x94ad, 0xbde3, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde3, 0x94ad, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c6e, 0xbdc6, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbdc6, 0x8c6e, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x842f, 0xb588, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xb588, 0x842f, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x840f, 0xa52b, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xad4b, 0x840f, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9ccd, 0xbde4, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde4, 0x9ccd, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c4f, 0xb5a8, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xb5a8, 0x8c4f, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xe716, 0xbde1, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde1, 0xe716, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x948e, 0xbdc6, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbdc6, 0x948e, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x842f, 0xad4b, 0xbde1, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde1, 0xad4b, 0x842f, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x948e, 0xb5a7, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xb5a7, 0x948e, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x840f, 0xa50c, 0xbde3, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde3, 0xa50c, 0x840f, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c4f, 0xad69, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xad69, 0x8c4f, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x94ae, 0xb5a8, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xb5a7, 0x94ae, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9ccd, 0xbdc6, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbdc6, 0x9ced, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xccb4, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbacf, 0xbb0e, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xb4cd, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x840f, 0x9cec, 0xbdc5, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbdc5, 0x9cec, 0x840f, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0xb4cd, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0xa3c1, 0x837c, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0x7b1e, 0xa4de, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x8c71, 0xffff, 0xd515, 0xc391, 0xc391, 0xc391, 0xc391, 0xc391, 0xc391, 0xc391, 0xc391, 0xc391, 0xc391, 0xc391, 0xc391, 0xc391, 0xc391, 0xc391, 0xc3d0, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xbd2f, 0xffff, 0x9cf3, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0xb596, 0xffff, 0x8c71, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0xbdf7, 0xf7be, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9491, 0xad4f, 0xc609, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc609, 0xad4f, 0x9491, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0xf7be, 0xbdf7, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x8c71, 0xffff, 0xb596, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9cf3, 0xffff, 0xbd2f, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0xac48, 0x93fd, 0x8bde, 0x8bde, 0x8bde, 0x8bde, 0x8bde, 0x8bde, 0x8bde, 0x8bde, 0x8bde, 0x8bde, 0x8bde, 0x8bde, 0x8bde, 0x8bde, 0x8bde, 0xad3e, 0xffff, 0x8c71, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7a, 0xce6e, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xce6e, 0xef7a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0xf79e, 0xc638, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xffff, 0xbdd7, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xad55, 0xffff, 0xb596, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xb596, 0xffff, 0xad55, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xbdd7, 0xffff, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xc638, 0xf7be, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xce79, 0xf79e, 0x9cce, 0xb589, 0xbde1, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde1, 0xb589, 0x9cce, 0xf79e, 0xce79, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xf7be, 0xc638, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xffff, 0xbdd7, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xad55, 0xffff, 0xb596, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xb596, 0xffff, 0xad55, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xbdd7, 0xffff, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xc638, 0xf79e, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8c4f, 0xa52b, 0xbdc5, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbdc5, 0xa52b, 0x8c4f, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x840f, 0x9ccd, 0xad69, 0xbde2, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde2, 0xad69, 0x9ccd, 0x840f, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x842f, 0x9cec, 0xb588, 0xbde2, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde2, 0xb588, 0x9cec, 0x842f, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c4f, 0x9ced, 0xb589, 0xbde3, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde3, 0xb589, 0x9cec, 0x8c4f, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x842f, 0x94ae, 0xad4b, 0xbdea, 0xc600, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc600, 0xbdea, 0xad4b, 0x94ad, 0x842f, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5c, 0x9ccd, 0xad4b, 0xb5a7, 0xbde3, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde2, 0xb5a7, 0xad4b, 0x9ccd, 0xef5c, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x840f, 0x948e, 0xa50c, 0xad4a, 0xb5a8, 0xbde4, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xc561, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc561, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde0, 0xbde4, 0xb5a8, 0xad4a, 0xa50c, 0x948e, 0x842f, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8c4f, 0x948e, 0x9ced, 0xa52b, 0xad6a, 0xb5a8, 0xbdc6, 0xc566, 0xc000, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xb800, 0xc000, 0xc566, 0xbdc6, 0xb5a8, 0xad6a, 0xa52b, 0x9cec, 0x94ae, 0x8c4f, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xdefb, 0x8bcf, 0x8bae, 0x93ae, 0x938e, 0x938e, 0x9b6d, 0x9b6d, 0x9b4d, 0x9b4d, 0x9b6d, 0x9b6d, 0x938e, 0x938e, 0x93ae, 0x8bae, 0x8bcf, 0xdefb, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xdefb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xdefb, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xdefb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xdefb, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xdefb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xdefb, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xdefb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xdefb, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xdefb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xdefb, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf79e, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf7be, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xc618, 0xef7d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xce79, 0xef5d, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xd6ba, 0xdefb, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xdefb, 0xd6ba, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef5d, 0xce79, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xef7d, 0xc618, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xf7be, 0xb5b6, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xffff, 0xad55, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9492, 0xffff, 0x9cf3, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x9cf3, 0xffff, 0x9492, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xad55, 0xffff, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0x8410, 0xb5b6, 0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0xf79e, 0xc638, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xffff, 0xbdd7, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xad55, 0xffff, 0xb596, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xb596, 0xffff, 0xad55, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xbdd7, 0xffff, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xc638, 0xf7be, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xce79, 0xf79e, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xd6ba, 0xef7d, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xdefb, 0xe71c, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xe71c, 0xdefb, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xef7d, 0xd6ba, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xf79e, 0xce79, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xf7be, 0xc638, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xffff, 0xbdd7, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xad55, 0xffff, 0xb596, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xb596, 0xffff, 0xad55, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xbdd7, 0xffff, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0x9cf3, 0xc638, 0xf79e, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d, 0x6b4d,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9cf3, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x9cf3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xc618, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd69a, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xd69a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc618, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9cf3, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bcf, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x9cf3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbdf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xce79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x94b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x6b4d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b4d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94b2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
-};
-
-void init_philips_pm5544_320_240(void) {
-	ptr_philips_pm5544_320_240 = (uint16_t*)&philips_pm5544_320_240[0];
-}
-
-uint16_t* get_philips_pm5544_320_240(void) {
-	return ptr_philips_pm5544_320_240;
-}
@@ -0,0 +1,421 @@
+#include <string.h>
+#include "pixel.h"
+#include "event.h"
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP == 1
+#define PIXEL_SIMD 1
+#else
+#define PIXEL_SIMD 0
+#endif
+
+#define PAIR(mask) ((uint32_t) (mask) | (uint32_t) (mask) << 16)
+
+static uint16_t PIXEL_swapPixel(uint16_t c) {
+  return (uint16_t) ((c & 0x001F) << 11 | (c & 0xF800) >> 11 | (c & 0x07E0));
+}
+
+static uint8_t PIXEL_getWeight(uint8_t alpha) {
+  return (alpha + 4) >> 3;
+}
+
+static uint16_t PIXEL_blendPixel(uint16_t a, uint16_t b, uint8_t weight) {
+  uint32_t r = ((a >> 11) * weight + (b >> 11) * (32 - weight) + 16) >> 5;
+  uint32_t g = (((a >> 5) & 0x3F) * weight + ((b >> 5) & 0x3F) * (32 - weight) + 16) >> 5;
+  uint32_t bl = ((a & 0x1F) * weight + (b & 0x1F) * (32 - weight) + 16) >> 5;
+  return (uint16_t) (r << 11 | g << 5 | bl);
+}
+
+static uint16_t PIXEL_scalePixel(uint16_t c, uint16_t factor) {
+  uint32_t r = ((c >> 11) * factor + 128) >> 8;
+  uint32_t g = (((c >> 5) & 0x3F) * factor + 128) >> 8;
+  uint32_t b = ((c & 0x1F) * factor + 128) >> 8;
+  return (uint16_t) (r << 11 | g << 5 | b);
+}
+
+static uint16_t PIXEL_convertPixel(uint32_t argb) {
+  return (uint16_t) ((argb & 0xF8) << 8 | (argb >> 5 & 0x07E0) | (argb >> 19 & 0x1F));
+}
+
+static uint8_t PIXEL_mulAlpha(uint8_t a, uint8_t alpha) {
+  uint32_t t = (uint32_t) a * alpha + 128;
+  return (uint8_t) ((t + (t >> 8)) >> 8);
+}
+
+/**
+ * 4 bit channels widened by repeating their top bits, like DMA2D does
+ */
+static uint16_t PIXEL_argb4444Pixel(uint16_t c) {
+  uint32_t hi = c >> 8 & 0xF;
+  uint32_t g = c >> 4 & 0xF;
+  uint32_t lo = c & 0xF;
+  return (uint16_t) ((hi << 1 | hi >> 3) << 11 | (g << 2 | g >> 2) << 5 | (lo << 1 | lo >> 3));
+}
+
+static uint16_t PIXEL_argb8888Pixel(uint32_t c) {
+  return (uint16_t) ((c >> 8 & 0xF800) | (c >> 5 & 0x07E0) | (c >> 3 & 0x001F));
+}
+
+/**
+ * Source of weight 0 leaves dst as is, of weight 32 replaces it
+ */
+static uint16_t PIXEL_overPixel(uint16_t src, uint16_t dst, uint8_t a, uint8_t alpha) {
+  uint8_t weight = PIXEL_getWeight(alpha == 255 ? a : PIXEL_mulAlpha(a, alpha));
+  if (weight == 0) {
+    return dst;
+  }
+  return weight == 32 ? src : PIXEL_blendPixel(src, dst, weight);
+}
+
+void PIXEL_swapRef(uint16_t *dst, const uint16_t *src, uint32_t count) {
+  for (uint32_t i = 0; i < count; i++) {
+    dst[i] = PIXEL_swapPixel(src[i]);
+  }
+}
+
+void PIXEL_blendRef(uint16_t *dst, const uint16_t *a, const uint16_t *b, uint8_t alpha, uint32_t count) {
+  uint8_t weight = PIXEL_getWeight(alpha);
+  for (uint32_t i = 0; i < count; i++) {
+    dst[i] = PIXEL_blendPixel(a[i], b[i], weight);
+  }
+}
+
+void PIXEL_scaleRef(uint16_t *dst, const uint16_t *src, uint16_t factor, uint32_t count) {
+  if (factor > 256) factor = 256;
+  for (uint32_t i = 0; i < count; i++) {
+    dst[i] = PIXEL_scalePixel(src[i], factor);
+  }
+}
+
+void PIXEL_colorKeyRef(uint16_t *dst, const uint16_t *src, uint16_t key, uint32_t count) {
+  for (uint32_t i = 0; i < count; i++) {
+    if (src[i] != key) {
+      dst[i] = src[i];
+    }
+  }
+}
+
+void PIXEL_convertRef(uint16_t *dst, const uint32_t *src, uint32_t count) {
+  for (uint32_t i = 0; i < count; i++) {
+    dst[i] = PIXEL_convertPixel(src[i]);
+  }
+}
+
+void PIXEL_blendArgb4444Ref(uint16_t *dst, const uint16_t *src, uint8_t alpha, uint32_t count) {
+  for (uint32_t i = 0; i < count; i++) {
+    dst[i] = PIXEL_overPixel(PIXEL_argb4444Pixel(src[i]), dst[i], (src[i] >> 12) * 17, alpha);
+  }
+}
+
+void PIXEL_blendArgb8888Ref(uint16_t *dst, const uint32_t *src, uint8_t alpha, uint32_t count) {
+  for (uint32_t i = 0; i < count; i++) {
+    dst[i] = PIXEL_overPixel(PIXEL_argb8888Pixel(src[i]), dst[i], src[i] >> 24, alpha);
+  }
+}
+
+#if PIXEL_SIMD
+
+/**
+ * Two pixels as one word, low half first. Rows only need halfword alignment,
+ * the M4 loads and stores unaligned words.
+ */
+static uint32_t PIXEL_load(const uint16_t *p) {
+  uint32_t value;
+  memcpy(&value, p, 4);
+  return value;
+}
+
+static void PIXEL_store(uint16_t *p, uint32_t value) {
+  memcpy(p, &value, 4);
+}
+
+static uint32_t PIXEL_swapPair(uint32_t pair) {
+  return (pair >> 11 & PAIR(0x001F)) | (pair & PAIR(0x07E0)) | (pair << 11 & PAIR(0xF800));
+}
+
+/**
+ * Each pixel is spread over its own word by packing it into both halves
+ */
+static uint32_t PIXEL_blendSpread(uint32_t a, uint32_t b, uint32_t weight) {
+  return ((a & PIXEL_SPREAD_MASK) * weight + (b & PIXEL_SPREAD_MASK) * (32 - weight) + PIXEL_ROUNDING) >> 5 &
+         PIXEL_SPREAD_MASK;
+}
+
+static uint32_t PIXEL_blendPair(uint32_t a, uint32_t b, uint32_t weight) {
+  uint32_t low = PIXEL_blendSpread(__PKHBT(a, a, 16), __PKHBT(b, b, 16), weight);
+  uint32_t high = PIXEL_blendSpread(__PKHTB(a, a, 16), __PKHTB(b, b, 16), weight);
+  return __PKHBT(low | low >> 16, high | high >> 16, 16);
+}
+
+/**
+ * Channels are multiplied in 16 bit lanes, 63 * 256 + 128 does not carry into the next lane
+ */
+static uint32_t PIXEL_scalePair(uint32_t pair, uint32_t factor) {
+  uint32_t r = ((pair >> 11 & PAIR(0x1F)) * factor + PAIR(0x80)) >> 8 & PAIR(0x1F);
+  uint32_t g = ((pair >> 5 & PAIR(0x3F)) * factor + PAIR(0x80)) >> 8 & PAIR(0x3F);
+  uint32_t b = ((pair & PAIR(0x1F)) * factor + PAIR(0x80)) >> 8 & PAIR(0x1F);
+  return r << 11 | g << 5 | b;
+}
+
+/**
+ * USUB16 of 0 sets both GE bits of a halfword only when it is 0, that is when the
+ * source pixel equals the key, SEL then keeps the destination pixel there
+ */
+static uint32_t PIXEL_colorKeyPair(uint32_t dst, uint32_t src, uint32_t key) {
+  __USUB16(0, src ^ key);
+  return __SEL(dst, src);
+}
+
+/**
+ * Both ARGB4444 pixels widened at once, right shifts are masked so the high lane does not leak into the low one
+ */
+static uint32_t PIXEL_argb4444Pair(uint32_t pair) {
+  uint32_t hi = pair >> 8 & PAIR(0xF);
+  uint32_t g = pair >> 4 & PAIR(0xF);
+  uint32_t lo = pair & PAIR(0xF);
+  return (hi << 1 | (hi >> 3 & PAIR(0x1))) << 11 | (g << 2 | (g >> 2 & PAIR(0x3))) << 5 |
+         (lo << 1 | (lo >> 3 & PAIR(0x1)));
+}
+
+/**
+ * Pairs whose source is transparent are skipped and opaque ones copied,
+ * overlays are mostly one or the other
+ */
+static uint32_t PIXEL_overPair(uint32_t src, uint32_t dst, uint8_t a0, uint8_t a1, uint8_t alpha) {
+  uint32_t w0 = PIXEL_getWeight(alpha == 255 ? a0 : PIXEL_mulAlpha(a0, alpha));
+  uint32_t w1 = PIXEL_getWeight(alpha == 255 ? a1 : PIXEL_mulAlpha(a1, alpha));
+  if ((w0 | w1) == 0) {
+    return dst;
+  }
+  if ((w0 & w1) == 32) {
+    return src;
+  }
+
+  uint32_t low = PIXEL_blendSpread(__PKHBT(src, src, 16), __PKHBT(dst, dst, 16), w0);
+  uint32_t high = PIXEL_blendSpread(__PKHTB(src, src, 16), __PKHTB(dst, dst, 16), w1);
+  return __PKHBT(low | low >> 16, high | high >> 16, 16);
+}
+
+#endif
+
+void PIXEL_swap(uint16_t *dst, const uint16_t *src, uint32_t count) {
+#if PIXEL_SIMD
+  if (((uint32_t) dst & 2) && count > 0) {
+    *dst++ = PIXEL_swapPixel(*src++);
+    count--;
+  }
+  for (; count >= 2; count -= 2, dst += 2, src += 2) {
+    PIXEL_store(dst, PIXEL_swapPair(PIXEL_load(src)));
+  }
+#endif
+  PIXEL_swapRef(dst, src, count);
+}
+
+void PIXEL_blend(uint16_t *dst, const uint16_t *a, const uint16_t *b, uint8_t alpha, uint32_t count) {
+#if PIXEL_SIMD
+  uint32_t weight = PIXEL_getWeight(alpha);
+  if (((uint32_t) dst & 2) && count > 0) {
+    *dst++ = PIXEL_blendPixel(*a++, *b++, weight);
+    count--;
+  }
+  for (; count >= 2; count -= 2, dst += 2, a += 2, b += 2) {
+    PIXEL_store(dst, PIXEL_blendPair(PIXEL_load(a), PIXEL_load(b), weight));
+  }
+#endif
+  PIXEL_blendRef(dst, a, b, alpha, count);
+}
+
+void PIXEL_scale(uint16_t *dst, const uint16_t *src, uint16_t factor, uint32_t count) {
+  if (factor > 256) factor = 256;
+#if PIXEL_SIMD
+  if (((uint32_t) dst & 2) && count > 0) {
+    *dst++ = PIXEL_scalePixel(*src++, factor);
+    count--;
+  }
+  for (; count >= 2; count -= 2, dst += 2, src += 2) {
+    PIXEL_store(dst, PIXEL_scalePair(PIXEL_load(src), factor));
+  }
+#endif
+  PIXEL_scaleRef(dst, src, factor, count);
+}
+
+void PIXEL_colorKey(uint16_t *dst, const uint16_t *src, uint16_t key, uint32_t count) {
+#if PIXEL_SIMD
+  if (((uint32_t) dst & 2) && count > 0) {
+    PIXEL_colorKeyRef(dst++, src++, key, 1);
+    count--;
+  }
+  uint32_t keys = PAIR(key);
+  for (; count >= 2; count -= 2, dst += 2, src += 2) {
+    PIXEL_store(dst, PIXEL_colorKeyPair(PIXEL_load(dst), PIXEL_load(src), keys));
+  }
+#endif
+  PIXEL_colorKeyRef(dst, src, key, count);
+}
+
+void PIXEL_convert(uint16_t *dst, const uint32_t *src, uint32_t count) {
+#if PIXEL_SIMD
+  if (((uint32_t) dst & 2) && count > 0) {
+    *dst++ = PIXEL_convertPixel(*src++);
+    count--;
+  }
+  for (; count >= 2; count -= 2, dst += 2, src += 2) {
+    PIXEL_store(dst, __PKHBT(PIXEL_convertPixel(src[0]), PIXEL_convertPixel(src[1]), 16));
+  }
+#endif
+  PIXEL_convertRef(dst, src, count);
+}
+
+void PIXEL_blendArgb4444(uint16_t *dst, const uint16_t *src, uint8_t alpha, uint32_t count) {
+#if PIXEL_SIMD
+  if (((uint32_t) dst & 2) && count > 0) {
+    PIXEL_blendArgb4444Ref(dst++, src++, alpha, 1);
+    count--;
+  }
+  for (; count >= 2; count -= 2, dst += 2, src += 2) {
+    uint32_t pair = PIXEL_load(src);
+    if ((pair & PAIR(0xF000)) == 0) {
+      continue;
+    }
+    PIXEL_store(dst, PIXEL_overPair(PIXEL_argb4444Pair(pair), PIXEL_load(dst), (pair >> 12 & 0xF) * 17,
+                                    (pair >> 28) * 17, alpha));
+  }
+#endif
+  PIXEL_blendArgb4444Ref(dst, src, alpha, count);
+}
+
+void PIXEL_blendArgb8888(uint16_t *dst, const uint32_t *src, uint8_t alpha, uint32_t count) {
+#if PIXEL_SIMD
+  if (((uint32_t) dst & 2) && count > 0) {
+    PIXEL_blendArgb8888Ref(dst++, src++, alpha, 1);
+    count--;
+  }
+  for (; count >= 2; count -= 2, dst += 2, src += 2) {
+    if (((src[0] | src[1]) >> 24) == 0) {
+      continue;
+    }
+    uint32_t pair = __PKHBT(PIXEL_argb8888Pixel(src[0]), PIXEL_argb8888Pixel(src[1]), 16);
+    PIXEL_store(dst, PIXEL_overPair(pair, PIXEL_load(dst), src[0] >> 24, src[1] >> 24, alpha));
+  }
+#endif
+  PIXEL_blendArgb8888Ref(dst, src, alpha, count);
+}
+
+/**
+ * One spare pixel in front so the rows can also be run misaligned
+ */
+static uint16_t rowA[PIXEL_CHECK_PIXELS + 1];
+static uint16_t rowB[PIXEL_CHECK_PIXELS + 1];
+static uint32_t rowArgb[PIXEL_CHECK_PIXELS + 1];
+static uint16_t rowArgb4444[PIXEL_CHECK_PIXELS + 1];
+static uint16_t outRef[PIXEL_CHECK_PIXELS + 1];
+static uint16_t outSimd[PIXEL_CHECK_PIXELS + 1];
+
+static uint32_t PIXEL_random(uint32_t *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 17;
+  *state ^= *state << 5;
+  return *state;
+}
+
+/**
+ * Runs the kernel, or with simd 0 its reference, on count pixels from offset.
+ * param is the alpha, factor or key.
+ */
+static void PIXEL_run(PIXEL_KernelTypeDef kernel, uint8_t simd, uint16_t *out, uint32_t offset, uint32_t count,
+                      uint16_t param) {
+  switch (kernel) {
+    case PIXEL_KERNEL_SWAP: {
+      (simd ? PIXEL_swap : PIXEL_swapRef)(out + offset, rowA + offset, count);
+      break;
+    }
+    case PIXEL_KERNEL_BLEND: {
+      (simd ? PIXEL_blend : PIXEL_blendRef)(out + offset, rowA + offset, rowB + offset, (uint8_t) param, count);
+      break;
+    }
+    case PIXEL_KERNEL_SCALE: {
+      (simd ? PIXEL_scale : PIXEL_scaleRef)(out + offset, rowA + offset, param, count);
+      break;
+    }
+    case PIXEL_KERNEL_COLOR_KEY: {
+      (simd ? PIXEL_colorKey : PIXEL_colorKeyRef)(out + offset, rowA + offset, param, count);
+      break;
+    }
+    case PIXEL_KERNEL_CONVERT: {
+      (simd ? PIXEL_convert : PIXEL_convertRef)(out + offset, rowArgb + offset, count);
+      break;
+    }
+    case PIXEL_KERNEL_BLEND_ARGB4444: {
+      (simd ? PIXEL_blendArgb4444 : PIXEL_blendArgb4444Ref)(out + offset, rowArgb4444 + offset, param, count);
+      break;
+    }
+    case PIXEL_KERNEL_BLEND_ARGB8888: {
+      (simd ? PIXEL_blendArgb8888 : PIXEL_blendArgb8888Ref)(out + offset, rowArgb + offset, param, count);
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+}
+
+uint8_t PIXEL_check(PIXEL_KernelTypeDef kernel, uint32_t *refCycles, uint32_t *simdCycles) {
+  uint32_t seed = 0x2545F491;
+  for (uint32_t i = 0; i <= PIXEL_CHECK_PIXELS; i++) {
+    rowA[i] = (uint16_t) PIXEL_random(&seed);
+    rowB[i] = (uint16_t) PIXEL_random(&seed);
+    rowArgb[i] = PIXEL_random(&seed);
+    rowArgb4444[i] = (uint16_t) PIXEL_random(&seed);
+
+    // Runs of transparent and opaque pixels for the blend shortcuts
+    if (i % 8 < 2) {
+      rowArgb[i] &= 0x00FFFFFF;
+      rowArgb4444[i] &= 0x0FFF;
+    } else if (i % 8 < 4) {
+      rowArgb[i] |= 0xFF000000;
+      rowArgb4444[i] |= 0xF000;
+    }
+  }
+
+  // Every third pixel is the key so both halves of a pair get keyed
+  uint16_t key = rowA[0];
+  for (uint32_t i = 0; i <= PIXEL_CHECK_PIXELS; i += 3) {
+    rowA[i] = key;
+  }
+
+  // Alpha and factor cover their whole range, the key is fixed
+  uint16_t params = kernel == PIXEL_KERNEL_SCALE ? 257 : 1;
+  if (kernel == PIXEL_KERNEL_BLEND || kernel == PIXEL_KERNEL_BLEND_ARGB4444 || kernel == PIXEL_KERNEL_BLEND_ARGB8888) {
+    params = 256;
+  }
+  uint8_t match = 1;
+
+  for (uint16_t param = 0; param < params; param++) {
+    uint16_t value = kernel == PIXEL_KERNEL_COLOR_KEY ? key : param;
+
+    // Aligned rows, then a misaligned odd length row
+    for (uint32_t offset = 0; offset < 2; offset++) {
+      // Color key keeps destination pixels, start both from the same row
+      memcpy(outRef, rowB, sizeof(outRef));
+      memcpy(outSimd, rowB, sizeof(outSimd));
+      PIXEL_run(kernel, 0, outRef, offset, PIXEL_CHECK_PIXELS - offset, value);
+      PIXEL_run(kernel, 1, outSimd, offset, PIXEL_CHECK_PIXELS - offset, value);
+      if (memcmp(outRef, outSimd, sizeof(outRef)) != 0) {
+        match = 0;
+      }
+    }
+  }
+
+  uint16_t value = kernel == PIXEL_KERNEL_COLOR_KEY ? key : 160;
+  memcpy(outRef, rowB, sizeof(outRef));
+  memcpy(outSimd, rowB, sizeof(outSimd));
+
+  uint32_t start = EVENT_cycles();
+  PIXEL_run(kernel, 0, outRef, 0, PIXEL_CHECK_PIXELS, value);
+  *refCycles = EVENT_cycles() - start;
+
+  start = EVENT_cycles();
+  PIXEL_run(kernel, 1, outSimd, 0, PIXEL_CHECK_PIXELS, value);
+  *simdCycles = EVENT_cycles() - start;
+
+  return match;
+}
@@ -0,0 +1,225 @@
+#include "raster.h"
+#include "disp.h"
+
+typedef struct {
+  RASTER_EntryTypeDef Entries[RASTER_MAX_ENTRIES];
+  uint16_t Count;
+  uint32_t Background;
+  uint8_t Alpha;
+  uint8_t HideLayer;
+} RASTER_TableTypeDef;
+
+static RASTER_TableTypeDef tables[2] = {
+    {.Alpha = RASTER_ALPHA_OPAQUE},
+    {.Alpha = RASTER_ALPHA_OPAQUE},
+};
+static volatile uint8_t front = 0;
+static volatile uint8_t swapPending = 0;
+static RASTER_TableTypeDef *building = NULL;
+
+// Line event state, only touched from the LTDC interrupt
+static uint16_t nextEntry = 0;
+static uint32_t firstLine = 0;
+
+static RASTER_StatsTypeDef stats = {
+    .MinLatency = UINT32_MAX,
+};
+
+void RASTER_begin(uint32_t background, uint8_t alpha, uint8_t hideLayer) {
+  // Cleared first, the interrupt must not swap in a table being built
+  swapPending = 0;
+  building = &tables[front ^ 1];
+
+  building->Count = 0;
+  building->Background = background & 0xFFFFFF;
+  building->Alpha = alpha;
+  building->HideLayer = hideLayer;
+}
+
+uint8_t RASTER_add(uint16_t row, uint32_t background, uint8_t setAlpha, uint8_t alpha) {
+  if (building == NULL || building->Count >= RASTER_MAX_ENTRIES) {
+    return 0;
+  }
+  if (building->Count > 0 && row < building->Entries[building->Count - 1].Row) {
+    return 0;
+  }
+
+  RASTER_EntryTypeDef *entry = &building->Entries[building->Count++];
+  entry->Row = row;
+  entry->SetAlpha = setAlpha;
+  entry->Alpha = alpha;
+  entry->Background = background & 0xFFFFFF;
+  return 1;
+}
+
+void RASTER_commit(void) {
+  if (building == NULL) {
+    return;
+  }
+  building = NULL;
+  swapPending = 1;
+}
+
+void RASTER_clear(void) {
+  RASTER_begin(0, RASTER_ALPHA_OPAQUE, 0);
+  RASTER_commit();
+}
+
+static uint8_t RASTER_lerp(uint8_t from, uint8_t to, uint32_t pos, uint32_t size) {
+  return (uint8_t) ((int32_t) from + ((int32_t) to - (int32_t) from) * (int32_t) pos / (int32_t) size);
+}
+
+static uint32_t RASTER_lerpColor(uint32_t from, uint32_t to, uint32_t pos, uint32_t size) {
+  return (uint32_t) RASTER_lerp(from >> 16, to >> 16, pos, size) << 16 |
+         (uint32_t) RASTER_lerp(from >> 8, to >> 8, pos, size) << 8 |
+         RASTER_lerp(from, to, pos, size);
+}
+
+uint8_t RASTER_ramp(uint32_t from, uint32_t to, uint8_t hideLayer) {
+  uint32_t height = DISP_getScreenHeight();
+
+  RASTER_begin(from, RASTER_ALPHA_OPAQUE, hideLayer);
+
+  // Only rows where the color steps get an entry
+  uint32_t color = from & 0xFFFFFF;
+  for (uint32_t row = 1; row < height; row++) {
+    uint32_t next = RASTER_lerpColor(from, to, row, height - 1);
+    if (next != color && !RASTER_add(row, next, 0, 0)) {
+      building = NULL;
+      return 0;
+    }
+    color = next;
+  }
+
+  RASTER_commit();
+  return 1;
+}
+
+uint8_t RASTER_fade(uint32_t background, uint8_t from, uint8_t to) {
+  uint32_t height = DISP_getScreenHeight();
+
+  RASTER_begin(background, from, 0);
+
+  uint8_t alpha = from;
+  for (uint32_t row = 1; row < height; row++) {
+    uint8_t next = RASTER_lerp(from, to, row, height - 1);
+    if (next != alpha && !RASTER_add(row, background, 1, next)) {
+      building = NULL;
+      return 0;
+    }
+    alpha = next;
+  }
+
+  RASTER_commit();
+  return 1;
+}
+
+uint8_t RASTER_bands(const uint32_t *colors, uint8_t count, uint8_t hideLayer) {
+  if (count == 0 || count > RASTER_MAX_BANDS) {
+    return 0;
+  }
+
+  uint32_t height = DISP_getScreenHeight();
+
+  RASTER_begin(colors[0], RASTER_ALPHA_OPAQUE, hideLayer);
+  for (uint8_t i = 1; i < count; i++) {
+    RASTER_add(i * height / count, colors[i], 0, 0);
+  }
+  RASTER_commit();
+  return 1;
+}
+
+/**
+ * Layer registers are shadowed, the immediate reload applies them on the current line.
+ * It also applies everything waiting for the vertical blanking reload, a page flip queued
+ * by DISP_showPage would tear. Mid-frame the layer write is then left to that reload,
+ * the entry is lost for the frame.
+ */
+static void RASTER_reloadLayer(void) {
+  if (LTDC->SRCR & LTDC_SRCR_VBR) {
+    return;
+  }
+  LTDC->SRCR = LTDC_SRCR_IMR;
+}
+
+/**
+ * Called at vblank only, reloading here picks up a pending page flip inside the blanking
+ */
+static void RASTER_setLayer(uint8_t alpha, uint8_t hidden) {
+  uint32_t cr = LTDC_Layer1->CR;
+  uint32_t enabledCr = hidden ? cr & ~LTDC_LxCR_LEN : cr | LTDC_LxCR_LEN;
+
+  if ((LTDC_Layer1->CACR & LTDC_LxCACR_CONSTA) == alpha && cr == enabledCr) {
+    return;
+  }
+
+  LTDC_Layer1->CACR = alpha;
+  LTDC_Layer1->CR = enabledCr;
+  LTDC->SRCR = LTDC_SRCR_IMR;
+}
+
+static void RASTER_apply(const RASTER_EntryTypeDef *entry, uint32_t scanline) {
+  LTDC->BCCR = entry->Background;
+  if (entry->SetAlpha) {
+    LTDC_Layer1->CACR = entry->Alpha;
+    RASTER_reloadLayer();
+  }
+
+  uint32_t cpsr = LTDC->CPSR;
+  uint32_t line = (cpsr & LTDC_CPSR_CYPOS) >> LTDC_CPSR_CYPOS_Pos;
+  uint32_t latency = (cpsr & LTDC_CPSR_CXPOS) >> LTDC_CPSR_CXPOS_Pos;
+
+  stats.Applied++;
+  if (line != scanline) {
+    stats.Late++;
+    return;
+  }
+
+  stats.LastLatency = latency;
+  if (latency < stats.MinLatency) stats.MinLatency = latency;
+  if (latency > stats.MaxLatency) stats.MaxLatency = latency;
+}
+
+/**
+ * Entries up to scanline are written, late ones included, and the scanline
+ * of the next one is returned. The table is swapped and restarted at vblank.
+ */
+uint32_t DISP_LineCallback(uint32_t scanline, uint8_t vblank) {
+  if (vblank) {
+    if (swapPending) {
+      front ^= 1;
+      swapPending = 0;
+    }
+
+    const RASTER_TableTypeDef *table = &tables[front];
+    LTDC->BCCR = table->Background;
+    RASTER_setLayer(table->Alpha, table->HideLayer);
+
+    firstLine = DISP_getFirstImageLine();
+    nextEntry = 0;
+  } else {
+    const RASTER_TableTypeDef *table = &tables[front];
+    while (nextEntry < table->Count && firstLine + table->Entries[nextEntry].Row <= scanline) {
+      RASTER_apply(&table->Entries[nextEntry], firstLine + table->Entries[nextEntry].Row);
+      nextEntry++;
+    }
+  }
+
+  const RASTER_TableTypeDef *table = &tables[front];
+  return nextEntry < table->Count ? firstLine + table->Entries[nextEntry].Row : 0;
+}
+
+RASTER_StatsTypeDef RASTER_getStats(void) {
+  RASTER_StatsTypeDef result = stats;
+  if (result.Applied == result.Late) {
+    result.MinLatency = 0;
+  }
+  return result;
+}
+
+void RASTER_resetStats(void) {
+  RASTER_StatsTypeDef empty = {
+      .MinLatency = UINT32_MAX,
+  };
+  stats = empty;
+}
@@ -0,0 +1,155 @@
+#include "render.h"
+#include "disp.h"
+#include "event.h"
+#include "tile.h"
+
+static RENDER_JobTypeDef queue[RENDER_QUEUE_SIZE];
+static uint8_t head = 0;
+static uint8_t tail = 0;
+
+void RENDER_cancel(void) {
+  head = 0;
+  tail = 0;
+}
+
+uint8_t RENDER_push(const RENDER_JobTypeDef *job) {
+  uint8_t next = (head + 1) % RENDER_QUEUE_SIZE;
+  if (next == tail) {
+    return 0;
+  }
+
+  queue[head] = *job;
+  queue[head].Progress = 0;
+  queue[head].Index = 0;
+  head = next;
+  return 1;
+}
+
+static uint8_t RENDER_rectStep(RENDER_JobTypeDef *job) {
+  uint16_t y = job->Y1 + job->Progress;
+  DISP_FillRect(job->X1, y, job->X2, y, job->Color);
+  job->Progress++;
+  return y >= job->Y2 || y + 1U >= DISP_getScreenHeight();
+}
+
+uint8_t RENDER_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color) {
+  RENDER_JobTypeDef job = {
+      .Step = RENDER_rectStep,
+      .X1 = x1 < x2 ? x1 : x2,
+      .Y1 = y1 < y2 ? y1 : y2,
+      .X2 = x1 < x2 ? x2 : x1,
+      .Y2 = y1 < y2 ? y2 : y1,
+      .Color = color,
+  };
+  return RENDER_push(&job);
+}
+
+uint8_t RENDER_fill(uint16_t color) {
+  return RENDER_rect(0, 0, DISP_getScreenWidth() - 1, DISP_getScreenHeight() - 1, color);
+}
+
+/**
+ * Index is the rect, Progress the row inside it
+ */
+static uint8_t RENDER_nestedRectsStep(RENDER_JobTypeDef *job) {
+  static const uint16_t colors[5] = {DISP_COLOR_RED, DISP_COLOR_GREEN, DISP_COLOR_BLUE, DISP_COLOR_WHITE,
+                                     DISP_COLOR_BLACK};
+
+  int32_t width = job->Width - job->Index * job->Param;
+  int32_t height = job->Height - job->Index * job->Param;
+  if (width <= 0 || height <= 0) {
+    return 1;
+  }
+
+  uint16_t centerX = job->Width / 2;
+  uint16_t centerY = job->Height / 2;
+  uint16_t y = centerY - height / 2 + job->Progress;
+
+  DISP_FillRect(centerX - width / 2, y, centerX + width / 2, y, colors[job->Index % 5]);
+
+  if (y < centerY + height / 2) {
+    job->Progress++;
+  } else {
+    job->Progress = 0;
+    job->Index++;
+  }
+  return 0;
+}
+
+uint8_t RENDER_nestedRects(uint16_t w, uint16_t h, uint8_t step) {
+  RENDER_JobTypeDef job = {
+      .Step = RENDER_nestedRectsStep,
+      .Width = w,
+      .Height = h,
+      .Param = step,
+  };
+  return step > 0 && RENDER_push(&job);
+}
+
+static uint8_t RENDER_bitmapStep(RENDER_JobTypeDef *job) {
+  DISP_DrawBitmapRows(job->Bitmap, job->Width, job->Height, job->Tile, job->Center, job->Progress, 1);
+  job->Progress++;
+  return job->Progress >= DISP_getScreenHeight();
+}
+
+uint8_t RENDER_bitmap(uint16_t *bitmap, uint16_t width, uint16_t height, uint8_t tile, uint8_t center) {
+  RENDER_JobTypeDef job = {
+      .Step = RENDER_bitmapStep,
+      .Bitmap = bitmap,
+      .Width = width,
+      .Height = height,
+      .Tile = tile,
+      .Center = center,
+  };
+  return RENDER_push(&job);
+}
+
+/**
+ * One band per step, the last flush completes in the background.
+ * In beam mode a composed band waits as Index 1 for the beam to pass it,
+ * the job yields meanwhile so the next band is not composed over it.
+ */
+static uint8_t RENDER_tilesStep(RENDER_JobTypeDef *job) {
+  if (!TILE_getBeamMode()) {
+    TILE_render(job->Progress);
+  } else if (job->Index == 0) {
+    TILE_prepare(job->Progress);
+    job->Index = 1;
+    return 0;
+  } else if (!TILE_isBehindBeam()) {
+    return 0;
+  } else {
+    TILE_commit();
+    job->Index = 0;
+  }
+
+  job->Progress++;
+  return job->Progress >= TILE_getCount();
+}
+
+uint8_t RENDER_tiles(void) {
+  RENDER_JobTypeDef job = {
+      .Step = RENDER_tilesStep,
+  };
+  return RENDER_push(&job);
+}
+
+void RENDER_tick(uint32_t budgetUs) {
+  uint32_t start = EVENT_cycles();
+  uint32_t budget = budgetUs * (SystemCoreClock / 1000000U);
+
+  while (tail != head && EVENT_cycles() - start < budget) {
+    if (DISP_isThrottled()) {
+      return;
+    }
+
+    RENDER_JobTypeDef *job = &queue[tail];
+    if (job->Step(job)) {
+      tail = (tail + 1) % RENDER_QUEUE_SIZE;
+    }
+  }
+}
+
+uint8_t RENDER_isIdle(void) {
+  return tail == head;
+}
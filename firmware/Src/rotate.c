@@ -0,0 +1,89 @@
+#include "rotate.h"
+#include "disp.h"
+
+void ROTATE_getSize(uint16_t srcWidth, uint16_t srcHeight, ROTATE_AngleTypeDef angle, uint16_t *width,
+                    uint16_t *height) {
+  uint8_t quarter = angle == ROTATE_90 || angle == ROTATE_270;
+  *width = quarter ? srcHeight : srcWidth;
+  *height = quarter ? srcWidth : srcHeight;
+}
+
+/**
+ * Rotated pixel u, v comes from source index origin + u * du + v * dv
+ */
+typedef struct {
+  int32_t Origin;
+  int32_t Du;
+  int32_t Dv;
+} ROTATE_WalkTypeDef;
+
+static ROTATE_WalkTypeDef ROTATE_getWalk(uint16_t srcWidth, uint16_t srcHeight, ROTATE_AngleTypeDef angle,
+                                         uint8_t mirror) {
+  int32_t w = srcWidth;
+  int32_t h = srcHeight;
+
+  // Source column and row as x0 + xu * u + xv * v and y0 + yu * u + yv * v
+  int32_t x0 = 0, xu = 1, xv = 0;
+  int32_t y0 = 0, yu = 0, yv = 1;
+
+  switch (angle) {
+    case ROTATE_90: {
+      x0 = 0, xu = 0, xv = 1;
+      y0 = h - 1, yu = -1, yv = 0;
+      break;
+    }
+    case ROTATE_180: {
+      x0 = w - 1, xu = -1, xv = 0;
+      y0 = h - 1, yu = 0, yv = -1;
+      break;
+    }
+    case ROTATE_270: {
+      x0 = w - 1, xu = 0, xv = -1;
+      y0 = 0, yu = 1, yv = 0;
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+
+  if (mirror) {
+    x0 = w - 1 - x0;
+    xu = -xu;
+    xv = -xv;
+  }
+
+  ROTATE_WalkTypeDef walk = {
+      .Origin = x0 + y0 * w,
+      .Du = xu + yu * w,
+      .Dv = xv + yv * w,
+  };
+  return walk;
+}
+
+void ROTATE_copy(const uint16_t *src, uint16_t srcWidth, uint16_t srcHeight, ROTATE_AngleTypeDef angle,
+                 uint8_t mirror, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t *dst,
+                 uint32_t dstStride) {
+  ROTATE_WalkTypeDef walk = ROTATE_getWalk(srcWidth, srcHeight, angle, mirror);
+
+  uint32_t x2 = (uint32_t) x + width;
+  uint32_t y2 = (uint32_t) y + height;
+
+  for (uint32_t blockV = y; blockV < y2; blockV += ROTATE_BLOCK) {
+    uint32_t endV = blockV + ROTATE_BLOCK < y2 ? blockV + ROTATE_BLOCK : y2;
+
+    for (uint32_t blockU = x; blockU < x2; blockU += ROTATE_BLOCK) {
+      uint32_t endU = blockU + ROTATE_BLOCK < x2 ? blockU + ROTATE_BLOCK : x2;
+
+      for (uint32_t v = blockV; v < endV; v++) {
+        const uint16_t *in = &src[walk.Origin + (int32_t) blockU * walk.Du + (int32_t) v * walk.Dv];
+        uint16_t *out = &dst[(v - y) * dstStride + (blockU - x)];
+
+        for (uint32_t u = blockU; u < endU; u++) {
+          *out++ = DISP_SwapRedBlue(*in);
+          in += walk.Du;
+        }
+      }
+    }
+  }
+}
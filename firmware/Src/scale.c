@@ -0,0 +1,136 @@
+#include "scale.h"
+#include "disp.h"
+#include "pixel.h"
+
+// Weights are 5 bit, 0..31 of 32, as the spare bits of PIXEL_SPREAD allow
+#define WEIGHT_BITS 5
+#define WEIGHT_ONE (1U << WEIGHT_BITS)
+
+#define NO_KEY UINT32_MAX
+
+static const uint16_t *source = NULL;
+static uint16_t srcW = 0;
+static uint16_t srcH = 0;
+static uint16_t dstW = 0;
+static uint16_t dstH = 0;
+static SCALE_FilterTypeDef mode = SCALE_NEAREST;
+
+static uint16_t columns[SCALE_MAX_WIDTH];
+static uint8_t weights[SCALE_MAX_WIDTH];
+
+// One source width row blended vertically, one spare entry so column + 1 is always readable
+static uint32_t blended[SCALE_MAX_WIDTH + 1];
+
+static uint16_t row[SCALE_MAX_WIDTH];
+static uint32_t rowKey = NO_KEY;
+
+static uint32_t SCALE_blend(uint32_t a, uint32_t b, uint32_t weight) {
+  return ((a * (WEIGHT_ONE - weight) + b * weight + PIXEL_ROUNDING) >> WEIGHT_BITS) & PIXEL_SPREAD_MASK;
+}
+
+/**
+ * Source position of destination pixel i in 16.16, nearest samples the covered pixel,
+ * bilinear interpolates between the two pixel centers around it
+ */
+static void SCALE_position(uint32_t i, uint16_t src, uint16_t dst, uint16_t *index, uint8_t *weight) {
+  uint32_t step = ((uint32_t) src << 16) / dst;
+  int32_t pos = (int32_t) (i * step + step / 2);
+
+  if (mode == SCALE_NEAREST) {
+    *index = pos >> 16;
+    *weight = 0;
+    return;
+  }
+
+  pos -= 1 << 15;
+  if (pos < 0) {
+    pos = 0;
+  }
+
+  *index = pos >> 16;
+  *weight = (pos >> (16 - WEIGHT_BITS)) & (WEIGHT_ONE - 1);
+  if (*index >= src - 1) {
+    *index = src - 1;
+    *weight = 0;
+  }
+}
+
+uint8_t SCALE_begin(const uint16_t *bitmap, uint16_t srcWidth, uint16_t srcHeight, uint16_t dstWidth,
+                    uint16_t dstHeight, SCALE_FilterTypeDef filter) {
+  if (bitmap == NULL || srcWidth == 0 || srcHeight == 0 || dstWidth == 0 || dstHeight == 0 ||
+      srcWidth > SCALE_MAX_WIDTH || dstWidth > SCALE_MAX_WIDTH) {
+    return 0;
+  }
+
+  if (bitmap == source && srcWidth == srcW && srcHeight == srcH && dstWidth == dstW && dstHeight == dstH &&
+      filter == mode) {
+    return 1;
+  }
+
+  source = bitmap;
+  srcW = srcWidth;
+  srcH = srcHeight;
+  dstW = dstWidth;
+  dstH = dstHeight;
+  mode = filter;
+  rowKey = NO_KEY;
+
+  for (uint16_t x = 0; x < dstW; x++) {
+    SCALE_position(x, srcW, dstW, &columns[x], &weights[x]);
+  }
+  return 1;
+}
+
+static void SCALE_nearestRow(const uint16_t *src) {
+  for (uint16_t x = 0; x < dstW; x++) {
+    row[x] = DISP_SwapRedBlue(src[columns[x]]);
+  }
+}
+
+/**
+ * Vertical pass over the source row pair once, then one horizontal blend per destination pixel
+ */
+static void SCALE_bilinearRow(const uint16_t *top, const uint16_t *bottom, uint8_t weight) {
+  if (weight == 0) {
+    for (uint16_t x = 0; x < srcW; x++) {
+      blended[x] = PIXEL_SPREAD(top[x]);
+    }
+  } else {
+    for (uint16_t x = 0; x < srcW; x++) {
+      blended[x] = SCALE_blend(PIXEL_SPREAD(top[x]), PIXEL_SPREAD(bottom[x]), weight);
+    }
+  }
+  blended[srcW] = blended[srcW - 1];
+
+  for (uint16_t x = 0; x < dstW; x++) {
+    uint16_t column = columns[x];
+    uint32_t value = SCALE_blend(blended[column], blended[column + 1], weights[x]);
+    row[x] = DISP_SwapRedBlue(PIXEL_PACK(value));
+  }
+}
+
+const uint16_t *SCALE_getRow(uint16_t y) {
+  if (source == NULL) {
+    return row;
+  }
+
+  uint16_t index;
+  uint8_t weight;
+  SCALE_position(y < dstH ? y : dstH - 1, srcH, dstH, &index, &weight);
+
+  uint32_t key = (uint32_t) index << WEIGHT_BITS | weight;
+  if (key == rowKey) {
+    return row;
+  }
+
+  const uint16_t *top = &source[(uint32_t) index * srcW];
+  if (mode == SCALE_NEAREST) {
+    SCALE_nearestRow(top);
+  } else {
+    uint16_t next = index + 1 < srcH ? index + 1 : index;
+    SCALE_bilinearRow(top, &source[(uint32_t) next * srcW], weight);
+  }
+
+  rowKey = key;
+  return row;
+}
@@ -0,0 +1,57 @@
+#include <string.h>
+#include "spsc.h"
+
+static uint16_t SPSC_next(const SPSC_QueueTypeDef *queue, uint16_t index) {
+  return index + 1 == queue->Size ? 0 : index + 1;
+}
+
+void *SPSC_acquire(SPSC_QueueTypeDef *queue) {
+  uint16_t head = queue->Head;
+  if (SPSC_next(queue, head) == queue->Tail) {
+    return NULL;
+  }
+  return &queue->Buffer[head * queue->ItemSize];
+}
+
+void SPSC_commit(SPSC_QueueTypeDef *queue) {
+  // The item has to be in memory before the consumer can see the new head
+  __DMB();
+  queue->Head = SPSC_next(queue, queue->Head);
+}
+
+uint8_t SPSC_push(SPSC_QueueTypeDef *queue, const void *item) {
+  void *slot = SPSC_acquire(queue);
+  if (slot == NULL) {
+    return 0;
+  }
+  memcpy(slot, item, queue->ItemSize);
+  SPSC_commit(queue);
+  return 1;
+}
+
+void *SPSC_front(SPSC_QueueTypeDef *queue) {
+  uint16_t tail = queue->Tail;
+  if (tail == queue->Head) {
+    return NULL;
+  }
+  return &queue->Buffer[tail * queue->ItemSize];
+}
+
+void SPSC_release(SPSC_QueueTypeDef *queue) {
+  __DMB();
+  queue->Tail = SPSC_next(queue, queue->Tail);
+}
+
+uint8_t SPSC_pop(SPSC_QueueTypeDef *queue, void *item) {
+  void *slot = SPSC_front(queue);
+  if (slot == NULL) {
+    return 0;
+  }
+  memcpy(item, slot, queue->ItemSize);
+  SPSC_release(queue);
+  return 1;
+}
+
+uint8_t SPSC_isEmpty(const SPSC_QueueTypeDef *queue) {
+  return queue->Head == queue->Tail;
+}
@@ -0,0 +1,660 @@
+#include <string.h>
+#include "tile.h"
+#include "disp.h"
+#include "pattern.h"
+#include "scale.h"
+#include "rotate.h"
+#include "pixel.h"
+#include "blend.h"
+#include "vector.h"
+
+#define FLUSH_TIMEOUT 50
+
+#define DMA2D_IFCR_ALL (DMA2D_IFCR_CTEIF | DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTWIF | DMA2D_IFCR_CAECIF | \
+                        DMA2D_IFCR_CCTCIF | DMA2D_IFCR_CCEIF)
+
+static uint16_t buffers[2][TILE_BUFFER_PIXELS];
+static uint8_t back = 0;
+static uint8_t flushing = 0;
+static uint8_t beamMode = 0;
+
+static TILE_PrimitiveTypeDef primitives[TILE_MAX_PRIMITIVES];
+static uint16_t primitiveCount = 0;
+
+void TILE_init(void) {
+  __HAL_RCC_DMA2D_CLK_ENABLE();
+}
+
+void TILE_clear(void) {
+  primitiveCount = 0;
+}
+
+static uint8_t TILE_add(const TILE_PrimitiveTypeDef *primitive) {
+  if (primitiveCount >= TILE_MAX_PRIMITIVES) {
+    return 0;
+  }
+  primitives[primitiveCount++] = *primitive;
+  return 1;
+}
+
+uint8_t TILE_fill(uint16_t color) {
+  TILE_PrimitiveTypeDef primitive = {
+      .Type = TILE_FILL,
+      .Color = color,
+  };
+  return TILE_add(&primitive);
+}
+
+uint8_t TILE_framebuffer(void) {
+  TILE_PrimitiveTypeDef primitive = {
+      .Type = TILE_FRAMEBUFFER,
+  };
+  return TILE_add(&primitive);
+}
+
+uint8_t TILE_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color) {
+  TILE_PrimitiveTypeDef primitive = {
+      .Type = TILE_RECT,
+      .Color = color,
+      .X1 = x1 < x2 ? x1 : x2,
+      .Y1 = y1 < y2 ? y1 : y2,
+      .X2 = x1 < x2 ? x2 : x1,
+      .Y2 = y1 < y2 ? y2 : y1,
+  };
+  return TILE_add(&primitive);
+}
+
+uint8_t TILE_nestedRects(uint16_t w, uint16_t h, uint8_t step) {
+  TILE_PrimitiveTypeDef primitive = {
+      .Type = TILE_NESTED_RECTS,
+      .Width = w,
+      .Height = h,
+      .Step = step,
+  };
+  return step > 0 && TILE_add(&primitive);
+}
+
+uint8_t TILE_bitmap(uint16_t *bitmap, uint16_t width, uint16_t height, uint8_t tile, uint8_t center) {
+  TILE_PrimitiveTypeDef primitive = {
+      .Type = TILE_BITMAP,
+      .Bitmap = bitmap,
+      .Width = width,
+      .Height = height,
+      .Tile = tile,
+      .Center = center,
+  };
+  return width > 0 && height > 0 && TILE_add(&primitive);
+}
+
+uint8_t TILE_bitmapScaled(uint16_t *bitmap, uint16_t srcWidth, uint16_t srcHeight, uint16_t x, uint16_t y,
+                          uint16_t width, uint16_t height, uint8_t filter) {
+  TILE_PrimitiveTypeDef primitive = {
+      .Type = TILE_BITMAP_SCALED,
+      .Bitmap = bitmap,
+      .Width = srcWidth,
+      .Height = srcHeight,
+      .X1 = x,
+      .Y1 = y,
+      .X2 = x + width - 1,
+      .Y2 = y + height - 1,
+      .Filter = filter,
+  };
+  return width > 0 && height > 0 && TILE_add(&primitive);
+}
+
+uint8_t TILE_bitmapRotated(uint16_t *bitmap, uint16_t width, uint16_t height, uint16_t x, uint16_t y,
+                           uint8_t rotation, uint8_t mirror) {
+  TILE_PrimitiveTypeDef primitive = {
+      .Type = TILE_BITMAP_ROTATED,
+      .Bitmap = bitmap,
+      .Width = width,
+      .Height = height,
+      .X1 = x,
+      .Y1 = y,
+      .Rotation = rotation,
+      .Mirror = mirror,
+  };
+  return width > 0 && height > 0 && rotation <= ROTATE_270 && TILE_add(&primitive);
+}
+
+uint8_t TILE_bitmapBlend(const void *bitmap, uint8_t format, uint16_t width, uint16_t height, uint16_t x,
+                         uint16_t y, uint8_t alpha) {
+  TILE_PrimitiveTypeDef primitive = {
+      .Type = TILE_BITMAP_BLEND,
+      .Bitmap = (uint16_t *) bitmap,
+      .Format = format,
+      .Width = width,
+      .Height = height,
+      .X1 = x,
+      .Y1 = y,
+      .Alpha = alpha,
+  };
+  return width > 0 && height > 0 && format <= BLEND_ARGB8888 && TILE_add(&primitive);
+}
+
+uint8_t TILE_text(const FONT_TypeDef *font, const char *text, uint16_t x, uint16_t y, uint16_t color,
+                  uint16_t background, uint8_t opaque) {
+  uint32_t width = FONT_measure(font, text);
+  TILE_PrimitiveTypeDef primitive = {
+      .Type = TILE_TEXT,
+      .Font = font,
+      .Text = text,
+      .Color = color,
+      .Background = background,
+      .Opaque = opaque,
+      .X1 = x,
+      .Y1 = y,
+      .X2 = x + width - 1,
+      .Y2 = y + font->Height - 1,
+  };
+  return width > 0 && TILE_add(&primitive);
+}
+
+uint8_t TILE_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t width, uint16_t color) {
+  TILE_PrimitiveTypeDef primitive = {
+      .Type = TILE_LINE,
+      .Start = {x1, y1},
+      .End = {x2, y2},
+      .Width = width,
+      .Color = color,
+  };
+  return TILE_add(&primitive);
+}
+
+uint8_t TILE_circle(int16_t cx, int16_t cy, uint16_t radius, uint8_t filled, uint16_t color) {
+  TILE_PrimitiveTypeDef primitive = {
+      .Type = TILE_CIRCLE,
+      .Start = {cx, cy},
+      .Radius = radius,
+      .Filled = filled,
+      .Color = color,
+  };
+  return TILE_add(&primitive);
+}
+
+uint8_t TILE_polygon(const VECTOR_PointTypeDef *points, uint8_t count, uint16_t color) {
+  TILE_PrimitiveTypeDef primitive = {
+      .Type = TILE_POLYGON,
+      .Points = points,
+      .PointCount = count,
+      .Color = color,
+  };
+  return count >= 3 && count <= VECTOR_MAX_POINTS && TILE_add(&primitive);
+}
+
+uint8_t TILE_pattern(uint8_t pattern) {
+  TILE_PrimitiveTypeDef primitive = {
+      .Type = TILE_PATTERN,
+      .Pattern = pattern,
+  };
+  return pattern < PATTERN_COUNT && TILE_add(&primitive);
+}
+
+uint8_t TILE_patternScrolled(uint8_t pattern, uint16_t offset) {
+  TILE_PrimitiveTypeDef primitive = {
+      .Type = TILE_PATTERN,
+      .Pattern = pattern,
+      .Y1 = offset % DISP_getScreenHeight(),
+  };
+  return pattern < PATTERN_COUNT && TILE_add(&primitive);
+}
+
+static uint16_t TILE_getLines(void) {
+  uint32_t lines = TILE_BUFFER_PIXELS / DISP_getScreenWidth();
+  return lines < DISP_getScreenHeight() ? lines : DISP_getScreenHeight();
+}
+
+uint16_t TILE_getCount(void) {
+  uint16_t lines = TILE_getLines();
+  return (DISP_getScreenHeight() + lines - 1) / lines;
+}
+
+/**
+ * Band geometry, rows [Y0, Y0 + Lines) of the screen
+ */
+typedef struct {
+  uint16_t *Buffer;
+  uint16_t Width;
+  uint16_t Y0;
+  uint16_t Lines;
+} TILE_BandTypeDef;
+
+/**
+ * Clamped to the screen like DISP_FillRect, then clipped to the band
+ */
+static void TILE_composeRect(const TILE_BandTypeDef *band, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                             uint16_t color) {
+  if (x1 > x2 || y1 > y2) {
+    return;
+  }
+
+  int32_t maxX = band->Width - 1;
+  int32_t maxY = DISP_getScreenHeight() - 1;
+
+  if (x1 < 0) x1 = 0;
+  if (y1 < 0) y1 = 0;
+  if (x2 > maxX) x2 = maxX;
+  if (y2 > maxY) y2 = maxY;
+  if (x1 > maxX) x1 = maxX;
+  if (y1 > maxY) y1 = maxY;
+
+  if (y1 < band->Y0) y1 = band->Y0;
+  if (y2 >= band->Y0 + band->Lines) y2 = band->Y0 + band->Lines - 1;
+  if (x1 > x2 || y1 > y2) {
+    return;
+  }
+
+  uint16_t swappedColor = DISP_SwapRedBlue(color);
+
+  for (int32_t y = y1; y <= y2; y++) {
+    uint16_t *row = &band->Buffer[(y - band->Y0) * band->Width];
+    for (int32_t x = x1; x <= x2; x++) {
+      row[x] = swappedColor;
+    }
+  }
+}
+
+/**
+ * Rects covering a row are nested, only the visible edges of the outer ones
+ * are drawn so each pixel is written once even with a step of 1.
+ */
+static void TILE_composeNestedRects(const TILE_BandTypeDef *band, const TILE_PrimitiveTypeDef *primitive) {
+  static const uint16_t colors[5] = {DISP_COLOR_RED, DISP_COLOR_GREEN, DISP_COLOR_BLUE, DISP_COLOR_WHITE,
+                                     DISP_COLOR_BLACK};
+
+  int32_t centerX = primitive->Width / 2;
+  int32_t centerY = primitive->Height / 2;
+  int32_t step = primitive->Step;
+
+  for (int32_t y = band->Y0; y < band->Y0 + band->Lines; y++) {
+    int32_t dy = y < centerY ? centerY - y : y - centerY;
+
+    for (int32_t i = 0;; i++) {
+      int32_t width = primitive->Width - i * step;
+      int32_t height = primitive->Height - i * step;
+      if (width <= 0 || height <= 0 || dy > height / 2) {
+        break;
+      }
+
+      int32_t x1 = centerX - width / 2;
+      int32_t x2 = centerX + width / 2;
+      uint16_t color = colors[i % 5];
+
+      int32_t innerWidth = width - step;
+      int32_t innerHeight = height - step;
+      if (innerWidth <= 0 || innerHeight <= 0 || dy > innerHeight / 2) {
+        TILE_composeRect(band, x1, y, x2, y, color);
+        break;
+      }
+
+      TILE_composeRect(band, x1, y, centerX - innerWidth / 2 - 1, y, color);
+      TILE_composeRect(band, centerX + innerWidth / 2 + 1, y, x2, y, color);
+    }
+  }
+}
+
+static int32_t TILE_wrap(int32_t value, int32_t size) {
+  value %= size;
+  return value < 0 ? value + size : value;
+}
+
+static void TILE_composeBitmap(const TILE_BandTypeDef *band, const TILE_PrimitiveTypeDef *primitive) {
+  int32_t screenWidth = band->Width;
+  int32_t screenHeight = DISP_getScreenHeight();
+  int32_t width = primitive->Width;
+  int32_t height = primitive->Height;
+
+  int32_t offsetX = primitive->Center && width < screenWidth ? (screenWidth - width) / 2 : 0;
+  int32_t offsetY = primitive->Center && height < screenHeight ? (screenHeight - height) / 2 : 0;
+
+  for (int32_t y = band->Y0; y < band->Y0 + band->Lines; y++) {
+    uint16_t *row = &band->Buffer[(y - band->Y0) * band->Width];
+    int32_t srcY = y - offsetY;
+
+    if (primitive->Tile) {
+      const uint16_t *src = &primitive->Bitmap[TILE_wrap(srcY, height) * width];
+      // Whole source rows at a time, the first one starts part way in
+      int32_t srcX = TILE_wrap(-offsetX, width);
+      for (int32_t x = 0; x < screenWidth; srcX = 0) {
+        int32_t run = width - srcX < screenWidth - x ? width - srcX : screenWidth - x;
+        PIXEL_swap(&row[x], &src[srcX], run);
+        x += run;
+      }
+      continue;
+    }
+
+    if (srcY < 0 || srcY >= height) {
+      continue;
+    }
+
+    const uint16_t *src = &primitive->Bitmap[srcY * width];
+    int32_t x1 = offsetX > 0 ? offsetX : 0;
+    int32_t x2 = offsetX + width < screenWidth ? offsetX + width : screenWidth;
+    if (x1 < x2) {
+      PIXEL_swap(&row[x1], &src[x1 - offsetX], x2 - x1);
+    }
+  }
+}
+
+/**
+ * Rows sampling the same source rows come from the scaler's last row, so an upscaled
+ * bitmap costs one copy per repeated row
+ */
+static void TILE_composeBitmapScaled(const TILE_BandTypeDef *band, const TILE_PrimitiveTypeDef *primitive) {
+  uint16_t width = primitive->X2 - primitive->X1 + 1;
+  uint16_t height = primitive->Y2 - primitive->Y1 + 1;
+
+  if (primitive->X1 >= band->Width ||
+      !SCALE_begin(primitive->Bitmap, primitive->Width, primitive->Height, width, height, primitive->Filter)) {
+    return;
+  }
+
+  int32_t y1 = primitive->Y1 > band->Y0 ? primitive->Y1 : band->Y0;
+  int32_t y2 = primitive->Y2 < band->Y0 + band->Lines - 1 ? primitive->Y2 : band->Y0 + band->Lines - 1;
+  uint16_t visibleWidth = primitive->X2 < band->Width ? width : band->Width - primitive->X1;
+
+  for (int32_t y = y1; y <= y2; y++) {
+    const uint16_t *src = SCALE_getRow(y - primitive->Y1);
+    memcpy(&band->Buffer[(y - band->Y0) * band->Width + primitive->X1], src, visibleWidth * 2);
+  }
+}
+
+static void TILE_composeBitmapRotated(const TILE_BandTypeDef *band, const TILE_PrimitiveTypeDef *primitive) {
+  uint16_t width, height;
+  ROTATE_getSize(primitive->Width, primitive->Height, primitive->Rotation, &width, &height);
+
+  int32_t y1 = primitive->Y1 > band->Y0 ? primitive->Y1 : band->Y0;
+  int32_t y2 = primitive->Y1 + height < band->Y0 + band->Lines ? primitive->Y1 + height : band->Y0 + band->Lines;
+  if (primitive->X1 >= band->Width || y1 >= y2) {
+    return;
+  }
+
+  uint16_t visibleWidth = primitive->X1 + width > band->Width ? band->Width - primitive->X1 : width;
+
+  ROTATE_copy(primitive->Bitmap, primitive->Width, primitive->Height, primitive->Rotation, primitive->Mirror, 0,
+              y1 - primitive->Y1, visibleWidth, y2 - y1,
+              &band->Buffer[(y1 - band->Y0) * band->Width + primitive->X1], band->Width);
+}
+
+static void TILE_composeBitmapBlend(const TILE_BandTypeDef *band, const TILE_PrimitiveTypeDef *primitive) {
+  int32_t y1 = primitive->Y1 > band->Y0 ? primitive->Y1 : band->Y0;
+  int32_t y2 = primitive->Y1 + primitive->Height < band->Y0 + band->Lines ? primitive->Y1 + primitive->Height
+                                                                          : band->Y0 + band->Lines;
+  if (primitive->X1 >= band->Width || y1 >= y2) {
+    return;
+  }
+
+  uint16_t visibleWidth = primitive->X1 + primitive->Width > band->Width ? band->Width - primitive->X1
+                                                                         : primitive->Width;
+  uint32_t rowBytes = (uint32_t) primitive->Width * BLEND_getPixelSize(primitive->Format);
+  const uint8_t *src = (const uint8_t *) primitive->Bitmap + (y1 - primitive->Y1) * rowBytes;
+
+  for (int32_t y = y1; y < y2; y++, src += rowBytes) {
+    BLEND_row(&band->Buffer[(y - band->Y0) * band->Width + primitive->X1], src, primitive->Format,
+              primitive->Alpha, visibleWidth);
+  }
+}
+
+static void TILE_composeText(const TILE_BandTypeDef *band, const TILE_PrimitiveTypeDef *primitive) {
+  int32_t y1 = primitive->Y1 > band->Y0 ? primitive->Y1 : band->Y0;
+  int32_t y2 = primitive->Y2 < band->Y0 + band->Lines - 1 ? primitive->Y2 : band->Y0 + band->Lines - 1;
+  int32_t x2 = primitive->X2 < band->Width ? primitive->X2 + 1 : band->Width;
+  uint16_t color = DISP_SwapRedBlue(primitive->Color);
+  uint16_t background = DISP_SwapRedBlue(primitive->Background);
+
+  for (int32_t y = y1; y <= y2; y++) {
+    FONT_drawRow(primitive->Font, primitive->Text, y - primitive->Y1, &band->Buffer[(y - band->Y0) * band->Width],
+                 primitive->X1, primitive->X1, x2, color, background, primitive->Opaque);
+  }
+}
+
+/**
+ * Shapes are rasterized once per band, clipped to its rows
+ */
+static void TILE_composeVector(const TILE_BandTypeDef *band, const TILE_PrimitiveTypeDef *primitive) {
+  VECTOR_TargetTypeDef target = {
+      .Buffer = band->Buffer,
+      .Stride = band->Width,
+      .X1 = 0,
+      .Y1 = band->Y0,
+      .X2 = band->Width - 1,
+      .Y2 = band->Y0 + band->Lines - 1,
+  };
+  uint16_t color = DISP_SwapRedBlue(primitive->Color);
+
+  switch (primitive->Type) {
+    case TILE_LINE: {
+      VECTOR_thickLine(&target, primitive->Start.X, primitive->Start.Y, primitive->End.X, primitive->End.Y,
+                       primitive->Width, color);
+      break;
+    }
+    case TILE_CIRCLE: {
+      VECTOR_circle(&target, primitive->Start.X, primitive->Start.Y, primitive->Radius, primitive->Filled, color);
+      break;
+    }
+    case TILE_POLYGON: {
+      VECTOR_polygon(&target, primitive->Points, primitive->PointCount, color);
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+}
+
+static TILE_BandTypeDef preparedBand;
+static uint8_t prepared = 0;
+
+static void TILE_composeFramebuffer(const TILE_BandTypeDef *band) {
+  // A flush left from an abandoned render may still be writing these rows
+  TILE_wait();
+
+  const uint16_t *src = (const uint16_t *) (DISP_getDrawAddress() + (uint32_t) band->Y0 * band->Width * 2);
+  uint32_t n = (uint32_t) band->Lines * band->Width;
+  for (uint32_t i = 0; i < n; i++) {
+    band->Buffer[i] = src[i];
+  }
+}
+
+static void TILE_composePattern(const TILE_BandTypeDef *band, const TILE_PrimitiveTypeDef *primitive) {
+  uint16_t height = DISP_getScreenHeight();
+
+  for (uint16_t i = 0; i < band->Lines; i++) {
+    uint16_t row = (band->Y0 + i + primitive->Y1) % height;
+    PATTERN_drawRow(primitive->Pattern, &band->Buffer[i * band->Width], row, band->Width, height);
+  }
+}
+
+static void TILE_compose(const TILE_BandTypeDef *band) {
+  for (uint16_t i = 0; i < primitiveCount; i++) {
+    const TILE_PrimitiveTypeDef *primitive = &primitives[i];
+
+    switch (primitive->Type) {
+      case TILE_FILL: {
+        TILE_composeRect(band, 0, 0, band->Width - 1, DISP_getScreenHeight() - 1, primitive->Color);
+        break;
+      }
+      case TILE_FRAMEBUFFER: {
+        TILE_composeFramebuffer(band);
+        break;
+      }
+      case TILE_RECT: {
+        TILE_composeRect(band, primitive->X1, primitive->Y1, primitive->X2, primitive->Y2, primitive->Color);
+        break;
+      }
+      case TILE_NESTED_RECTS: {
+        TILE_composeNestedRects(band, primitive);
+        break;
+      }
+      case TILE_BITMAP: {
+        TILE_composeBitmap(band, primitive);
+        break;
+      }
+      case TILE_PATTERN: {
+        TILE_composePattern(band, primitive);
+        break;
+      }
+      case TILE_BITMAP_SCALED: {
+        TILE_composeBitmapScaled(band, primitive);
+        break;
+      }
+      case TILE_BITMAP_ROTATED: {
+        TILE_composeBitmapRotated(band, primitive);
+        break;
+      }
+      case TILE_BITMAP_BLEND: {
+        TILE_composeBitmapBlend(band, primitive);
+        break;
+      }
+      case TILE_TEXT: {
+        TILE_composeText(band, primitive);
+        break;
+      }
+      case TILE_LINE:
+      case TILE_CIRCLE:
+      case TILE_POLYGON: {
+        TILE_composeVector(band, primitive);
+        break;
+      }
+      default: {
+        break;
+      }
+    }
+  }
+}
+
+HAL_StatusTypeDef TILE_wait(void) {
+  if (!flushing) {
+    return HAL_OK;
+  }
+
+  uint32_t start = HAL_GetTick();
+  while (DMA2D->CR & DMA2D_CR_START) {
+    if (HAL_GetTick() - start > FLUSH_TIMEOUT) {
+      DMA2D->CR |= DMA2D_CR_ABORT;
+      flushing = 0;
+      return HAL_TIMEOUT;
+    }
+  }
+
+  flushing = 0;
+
+  uint32_t isr = DMA2D->ISR;
+  DMA2D->IFCR = DMA2D_IFCR_ALL;
+  return isr & (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF) ? HAL_ERROR : HAL_OK;
+}
+
+/**
+ * Memory to memory without conversion, dstOffset pixels are skipped after every row
+ */
+static void TILE_flush(const uint16_t *src, uint32_t dst, uint16_t dstOffset, uint16_t width, uint16_t lines) {
+  DMA2D->IFCR = DMA2D_IFCR_ALL;
+  DMA2D->CR = 0;
+  DMA2D->FGMAR = (uint32_t) src;
+  DMA2D->FGOR = 0;
+  DMA2D->FGPFCCR = DMA2D_FGPFCCR_CM_1; // RGB565
+  DMA2D->OPFCCR = DMA2D_OPFCCR_CM_1;
+  DMA2D->OMAR = dst;
+  DMA2D->OOR = dstOffset;
+  DMA2D->NLR = ((uint32_t) width << DMA2D_NLR_PL_Pos) | lines;
+
+  DISP_throttle();
+
+  DMA2D->CR |= DMA2D_CR_START;
+  flushing = 1;
+}
+
+HAL_StatusTypeDef TILE_prepare(uint16_t index) {
+  uint16_t width = DISP_getScreenWidth();
+  uint16_t height = DISP_getScreenHeight();
+  uint16_t lines = TILE_getLines();
+
+  prepared = 0;
+  if (lines == 0 || index >= TILE_getCount()) {
+    return HAL_ERROR;
+  }
+
+  TILE_BandTypeDef band = {
+      .Buffer = buffers[back],
+      .Width = width,
+      .Y0 = index * lines,
+      .Lines = height - index * lines < lines ? height - index * lines : lines,
+  };
+
+  // The other buffer may still be flushing, this one is free
+  TILE_compose(&band);
+
+  preparedBand = band;
+  prepared = 1;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef TILE_commit(void) {
+  if (!prepared) {
+    return HAL_ERROR;
+  }
+
+  HAL_StatusTypeDef status = TILE_wait();
+
+  // The band rows are contiguous in the framebuffer
+  TILE_flush(preparedBand.Buffer, DISP_getDrawAddress() + (uint32_t) preparedBand.Y0 * preparedBand.Width * 2, 0,
+             preparedBand.Width, preparedBand.Lines);
+  back ^= 1;
+  prepared = 0;
+
+  return status;
+}
+
+HAL_StatusTypeDef TILE_flushRect(const uint16_t *src, uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+  uint32_t screenWidth = DISP_getScreenWidth();
+  if (width == 0 || height == 0 || x + width > screenWidth || y + height > DISP_getScreenHeight()) {
+    return HAL_ERROR;
+  }
+
+  HAL_StatusTypeDef status = TILE_wait();
+
+  TILE_flush(src, DISP_getDrawAddress() + ((uint32_t) y * screenWidth + x) * 2, screenWidth - width, width, height);
+  return status;
+}
+
+uint8_t TILE_isBehindBeam(void) {
+  // Nothing scans out a page that is not shown
+  if (DISP_getDrawAddress() != DISP_getPageAddress(DISP_getActivePage())) {
+    return 1;
+  }
+  return DISP_getBeamRow() >= (int32_t) preparedBand.Y0 + preparedBand.Lines;
+}
+
+void TILE_setBeamMode(uint8_t enabled) {
+  beamMode = enabled;
+}
+
+uint8_t TILE_getBeamMode(void) {
+  return beamMode;
+}
+
+HAL_StatusTypeDef TILE_render(uint16_t index) {
+  if (TILE_prepare(index) != HAL_OK) {
+    return HAL_ERROR;
+  }
+
+  while (beamMode && !TILE_isBehindBeam()) {
+  }
+
+  return TILE_commit();
+}
+
+HAL_StatusTypeDef TILE_renderAll(void) {
+  HAL_StatusTypeDef status = HAL_OK;
+
+  for (uint16_t i = 0; i < TILE_getCount(); i++) {
+    if (TILE_render(i) != HAL_OK) {
+      status = HAL_ERROR;
+    }
+  }
+
+  if (TILE_wait() != HAL_OK) {
+    status = HAL_ERROR;
+  }
+  return status;
+}
@@ -0,0 +1,193 @@
+#include "upload.h"
+#include "disp.h"
+#include "crc.h"
+
+#define OP_SHIFT 6
+#define OP_EXTENDED 0x20
+#define OP_COUNT_MASK 0x1F
+#define OP_COUNT_BITS 5
+
+typedef enum {
+  DECODE_OP,
+  DECODE_COUNT,
+  DECODE_VALUE_LOW,
+  DECODE_VALUE_HIGH,
+} DecodeStateTypeDef;
+
+static UPLOAD_HeaderTypeDef header;
+static UPLOAD_StateTypeDef state = UPLOAD_STATE_IDLE;
+
+static uint32_t pageAddr;
+static uint32_t baseAddr;
+static uint32_t stride;
+static uint32_t offset;
+static uint32_t pixels;
+static uint16_t col;
+static uint16_t row;
+
+static DecodeStateTypeDef decodeState;
+static uint8_t op;
+static uint32_t count;
+static uint16_t value;
+
+static uint8_t UPLOAD_emit(uint16_t color, uint32_t n) {
+  if (n > (uint32_t) header.Width * header.Height - pixels) {
+    return 0;
+  }
+
+  pixels += n;
+
+  while (n--) {
+    uint32_t pos = ((header.Y + row) * stride + header.X + col) * 2;
+
+    if (op != UPLOAD_OP_SKIP) {
+      *(__IO uint16_t *) (pageAddr + pos) = color;
+    } else {
+      *(__IO uint16_t *) (pageAddr + pos) = *(__IO uint16_t *) (baseAddr + pos);
+    }
+
+    if (++col == header.Width) {
+      col = 0;
+      row++;
+      DISP_throttle();
+    }
+  }
+
+  return 1;
+}
+
+static uint8_t UPLOAD_decode(uint8_t b) {
+  switch (decodeState) {
+    case DECODE_OP:
+      op = b >> OP_SHIFT;
+      count = b & OP_COUNT_MASK;
+      if (b & OP_EXTENDED) {
+        decodeState = DECODE_COUNT;
+        return 1;
+      }
+      break;
+    case DECODE_COUNT:
+      count |= (uint32_t) b << OP_COUNT_BITS;
+      break;
+    case DECODE_VALUE_LOW:
+      value = b;
+      decodeState = DECODE_VALUE_HIGH;
+      return 1;
+    case DECODE_VALUE_HIGH:
+      value |= b << 8;
+      if (op == UPLOAD_OP_RUN) {
+        decodeState = DECODE_OP;
+        return UPLOAD_emit(DISP_SwapRedBlue(value), count);
+      }
+      decodeState = --count ? DECODE_VALUE_LOW : DECODE_OP;
+      return UPLOAD_emit(DISP_SwapRedBlue(value), 1);
+  }
+
+  // Op and count are complete
+  count++;
+
+  switch (op) {
+    case UPLOAD_OP_LITERAL:
+    case UPLOAD_OP_RUN:
+      decodeState = DECODE_VALUE_LOW;
+      return 1;
+    case UPLOAD_OP_SKIP:
+      if (header.Encoding != UPLOAD_ENCODING_DELTA) {
+        return 0;
+      }
+      decodeState = DECODE_OP;
+      return UPLOAD_emit(0, count);
+    default:
+      return 0;
+  }
+}
+
+UPLOAD_StatusTypeDef UPLOAD_begin(const UPLOAD_HeaderTypeDef *h) {
+  uint32_t screenWidth = DISP_getScreenWidth();
+  uint32_t screenHeight = DISP_getScreenHeight();
+
+  // The shown page would tear while streaming, the upload goes to another one and is flipped to
+  if (h->Page >= DISP_PAGE_COUNT || h->Page == DISP_getActivePage() || h->Encoding > UPLOAD_ENCODING_DELTA ||
+      h->Width == 0 || h->Height == 0 ||
+      h->X + h->Width > screenWidth || h->Y + h->Height > screenHeight) {
+    state = UPLOAD_STATE_IDLE;
+    return UPLOAD_BAD_HEADER;
+  }
+
+  header = *h;
+  state = UPLOAD_STATE_ACTIVE;
+
+  pageAddr = DISP_getPageAddress(header.Page);
+  baseAddr = DISP_getPageAddress(DISP_getActivePage());
+  stride = screenWidth;
+  offset = 0;
+  pixels = 0;
+  col = 0;
+  row = 0;
+
+  if (header.Encoding == UPLOAD_ENCODING_RAW) {
+    // Raw data is a single literal covering the whole rect
+    op = UPLOAD_OP_LITERAL;
+    count = (uint32_t) header.Width * header.Height;
+    decodeState = DECODE_VALUE_LOW;
+  } else {
+    decodeState = DECODE_OP;
+  }
+
+  return UPLOAD_OK;
+}
+
+UPLOAD_StatusTypeDef UPLOAD_chunk(uint32_t chunkOffset, const uint8_t *data, uint8_t size, uint32_t crc) {
+  if (state != UPLOAD_STATE_ACTIVE) {
+    return UPLOAD_NOT_ACTIVE;
+  }
+
+  if (CRC_calc(CRC_INIT, data, size) != crc) {
+    return UPLOAD_BAD_CRC;
+  }
+
+  if (chunkOffset > offset) {
+    return UPLOAD_OUT_OF_ORDER;
+  }
+
+  // Skip the part that was already decoded from a previous attempt
+  for (uint32_t i = offset - chunkOffset; i < size; i++) {
+    if (offset >= header.Size || !UPLOAD_decode(data[i])) {
+      state = UPLOAD_STATE_ERROR;
+      return UPLOAD_BAD_DATA;
+    }
+    offset++;
+  }
+
+  return UPLOAD_OK;
+}
+
+UPLOAD_StatusTypeDef UPLOAD_end(void) {
+  if (state != UPLOAD_STATE_ACTIVE) {
+    return UPLOAD_NOT_ACTIVE;
+  }
+
+  if (offset != header.Size || pixels != (uint32_t) header.Width * header.Height) {
+    return UPLOAD_INCOMPLETE;
+  }
+
+  state = UPLOAD_STATE_DONE;
+
+  if (header.Show) {
+    DISP_showPage(header.Page);
+  }
+
+  return UPLOAD_OK;
+}
+
+UPLOAD_InfoTypeDef UPLOAD_getInfo(void) {
+  UPLOAD_InfoTypeDef info = {
+      .State = state,
+      .Page = header.Page,
+      .Offset = offset,
+      .Size = header.Size,
+      .Pixels = pixels,
+      .Show = header.Show,
+  };
+  return info;
+}
@@ -0,0 +1,260 @@
+#include <math.h>
+#include "vector.h"
+
+// 16.16 fixed point for polygon vertices and edge crossings
+#define FIXED_ONE 0x10000
+#define FIXED_CEIL(v) (((v) + (FIXED_ONE - 1)) >> 16)
+
+static int32_t VECTOR_guard(int32_t v) {
+  return v < -VECTOR_GUARD ? -VECTOR_GUARD : v > VECTOR_GUARD ? VECTOR_GUARD : v;
+}
+
+void VECTOR_span(const VECTOR_TargetTypeDef *target, int32_t y, int32_t x1, int32_t x2, uint16_t color) {
+  if (y < target->Y1 || y > target->Y2) {
+    return;
+  }
+  if (x1 > x2) {
+    int32_t t = x1;
+    x1 = x2;
+    x2 = t;
+  }
+  if (x1 < target->X1) x1 = target->X1;
+  if (x2 > target->X2) x2 = target->X2;
+  if (x1 > x2) {
+    return;
+  }
+
+  uint16_t *dst = &target->Buffer[(uint32_t) (y - target->Y1) * target->Stride + x1];
+  uint32_t count = x2 - x1 + 1;
+
+  // Word stores for the aligned middle, two pixels each
+  if (((uint32_t) dst & 2) != 0) {
+    *dst++ = color;
+    count--;
+  }
+  uint32_t pair = (uint32_t) color << 16 | color;
+  uint32_t *words = (uint32_t *) dst;
+  for (uint32_t i = 0; i < count / 2; i++) {
+    words[i] = pair;
+  }
+  if (count & 1) {
+    dst[count - 1] = color;
+  }
+}
+
+void VECTOR_line(const VECTOR_TargetTypeDef *target, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                 uint16_t color) {
+  // Drawn top to bottom so a line and its reverse set the same pixels
+  if (y1 > y2) {
+    int32_t t = x1;
+    x1 = x2;
+    x2 = t;
+    t = y1;
+    y1 = y2;
+    y2 = t;
+  }
+  if (y2 < target->Y1 || y1 > target->Y2 || (x1 < target->X1 && x2 < target->X1) ||
+      (x1 > target->X2 && x2 > target->X2)) {
+    return;
+  }
+
+  int32_t dx = x2 > x1 ? x2 - x1 : x1 - x2;
+  int32_t dy = y2 - y1;
+  int32_t sx = x2 > x1 ? 1 : -1;
+
+  if (dx > dy) {
+    // A run per row, it ends where the error steps down a row
+    int32_t err = 2 * dy - dx;
+    int32_t start = x1;
+    int32_t x = x1;
+    int32_t y = y1;
+    for (int32_t i = 0; i < dx && y <= target->Y2; i++) {
+      if (err > 0) {
+        VECTOR_span(target, y, start, x, color);
+        y++;
+        start = x + sx;
+        err -= 2 * dx;
+      }
+      err += 2 * dy;
+      x += sx;
+    }
+    VECTOR_span(target, y, start, x, color);
+  } else {
+    int32_t err = 2 * dx - dy;
+    int32_t x = x1;
+    int32_t last = y2 < target->Y2 ? y2 : target->Y2;
+    for (int32_t y = y1; y <= last; y++) {
+      VECTOR_span(target, y, x, x, color);
+      if (err > 0) {
+        x += sx;
+        err -= 2 * dy;
+      }
+      err += 2 * dx;
+    }
+  }
+}
+
+/**
+ * Rows of the circle are touched in two ways. Near the left and right the row changes on every step
+ * and has a pixel at +-x, near the top and bottom a row holds a run of steps that ends when x steps in.
+ */
+void VECTOR_circle(const VECTOR_TargetTypeDef *target, int32_t cx, int32_t cy, uint16_t radius, uint8_t filled,
+                   uint16_t color) {
+  if (cy + radius < target->Y1 || cy - radius > target->Y2 || cx + radius < target->X1 ||
+      cx - radius > target->X2) {
+    return;
+  }
+
+  int32_t x = radius;
+  int32_t y = 0;
+  int32_t err = 1 - x;
+  int32_t start = 0;
+
+  while (x >= y) {
+    if (filled) {
+      VECTOR_span(target, cy + y, cx - x, cx + x, color);
+      VECTOR_span(target, cy - y, cx - x, cx + x, color);
+    } else {
+      VECTOR_span(target, cy + y, cx - x, cx - x, color);
+      VECTOR_span(target, cy + y, cx + x, cx + x, color);
+      VECTOR_span(target, cy - y, cx - x, cx - x, color);
+      VECTOR_span(target, cy - y, cx + x, cx + x, color);
+    }
+
+    int32_t row = x;
+    y++;
+    if (err < 0) {
+      err += 2 * y + 1;
+    } else {
+      x--;
+      err += 2 * (y - x) + 1;
+    }
+
+    if (x != row || x < y) {
+      // Steps start .. y - 1 were on rows cy +- row
+      int32_t end = y - 1;
+      if (filled || start == 0) {
+        VECTOR_span(target, cy + row, cx - end, cx + end, color);
+        VECTOR_span(target, cy - row, cx - end, cx + end, color);
+      } else {
+        VECTOR_span(target, cy + row, cx - end, cx - start, color);
+        VECTOR_span(target, cy + row, cx + start, cx + end, color);
+        VECTOR_span(target, cy - row, cx - end, cx - start, color);
+        VECTOR_span(target, cy - row, cx + start, cx + end, color);
+      }
+      start = y;
+    }
+  }
+}
+
+/**
+ * Vertices in 16.16, row y samples the pixel centers at y
+ */
+static void VECTOR_fillFixed(const VECTOR_TargetTypeDef *target, const int32_t *xs, const int32_t *ys,
+                             uint8_t count, uint16_t color) {
+  int32_t minY = ys[0];
+  int32_t maxY = ys[0];
+  for (uint8_t i = 1; i < count; i++) {
+    if (ys[i] < minY) minY = ys[i];
+    if (ys[i] > maxY) maxY = ys[i];
+  }
+
+  int32_t first = FIXED_CEIL(minY);
+  int32_t last = FIXED_CEIL(maxY) - 1;
+  if (first < target->Y1) first = target->Y1;
+  if (last > target->Y2) last = target->Y2;
+
+  int32_t crossings[VECTOR_MAX_POINTS];
+
+  for (int32_t y = first; y <= last; y++) {
+    int32_t sample = y * FIXED_ONE;
+    uint8_t n = 0;
+
+    for (uint8_t i = 0; i < count; i++) {
+      uint8_t j = i + 1 < count ? i + 1 : 0;
+      int32_t y1 = ys[i];
+      int32_t y2 = ys[j];
+      if ((y1 <= sample && sample < y2) || (y2 <= sample && sample < y1)) {
+        int32_t x = xs[i] + (int32_t) ((int64_t) (sample - y1) * (xs[j] - xs[i]) / (y2 - y1));
+
+        // Insertion sort, there are only a few crossings per row
+        uint8_t k = n++;
+        for (; k > 0 && crossings[k - 1] > x; k--) {
+          crossings[k] = crossings[k - 1];
+        }
+        crossings[k] = x;
+      }
+    }
+
+    for (uint8_t k = 0; k + 1 < n; k += 2) {
+      int32_t x1 = FIXED_CEIL(crossings[k]);
+      int32_t x2 = FIXED_CEIL(crossings[k + 1]) - 1;
+      if (x1 <= x2) {
+        VECTOR_span(target, y, x1, x2, color);
+      }
+    }
+  }
+}
+
+void VECTOR_polygon(const VECTOR_TargetTypeDef *target, const VECTOR_PointTypeDef *points, uint8_t count,
+                    uint16_t color) {
+  if (count < 3 || count > VECTOR_MAX_POINTS) {
+    return;
+  }
+
+  int32_t xs[VECTOR_MAX_POINTS];
+  int32_t ys[VECTOR_MAX_POINTS];
+  for (uint8_t i = 0; i < count; i++) {
+    xs[i] = VECTOR_guard(points[i].X) * FIXED_ONE;
+    ys[i] = VECTOR_guard(points[i].Y) * FIXED_ONE;
+  }
+
+  VECTOR_fillFixed(target, xs, ys, count, color);
+}
+
+void VECTOR_thickLine(const VECTOR_TargetTypeDef *target, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                      uint16_t width, uint16_t color) {
+  if (width <= 1) {
+    VECTOR_line(target, x1, y1, x2, y2, color);
+    return;
+  }
+
+  x1 = VECTOR_guard(x1);
+  y1 = VECTOR_guard(y1);
+  x2 = VECTOR_guard(x2);
+  y2 = VECTOR_guard(y2);
+  if (width > VECTOR_GUARD) {
+    width = VECTOR_GUARD;
+  }
+
+  float dx = (float) (x2 - x1);
+  float dy = (float) (y2 - y1);
+  float length = sqrtf(dx * dx + dy * dy);
+  if (length == 0.0f) {
+    dx = 1.0f;
+    length = 1.0f;
+  }
+
+  // Half a pixel along the line, half the width across it
+  float ux = dx / length * (0.5f * FIXED_ONE);
+  float uy = dy / length * (0.5f * FIXED_ONE);
+  int32_t ax = (int32_t) (ux * width);
+  int32_t ay = (int32_t) (uy * width);
+  int32_t ex = (int32_t) ux;
+  int32_t ey = (int32_t) uy;
+
+  int32_t xs[4] = {
+      x1 * FIXED_ONE - ex - ay,
+      x2 * FIXED_ONE + ex - ay,
+      x2 * FIXED_ONE + ex + ay,
+      x1 * FIXED_ONE - ex + ay,
+  };
+  int32_t ys[4] = {
+      y1 * FIXED_ONE - ey + ax,
+      y2 * FIXED_ONE + ey + ax,
+      y2 * FIXED_ONE + ey - ax,
+      y1 * FIXED_ONE - ey - ax,
+  };
+
+  VECTOR_fillFixed(target, xs, ys, 4, color);
+}
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""
+Packs a TrueType / OpenType font into a glyph atlas for font.c.
+
+Every glyph is rendered at the given pixel size, cropped to its ink and
+stored row by row, rows start on a byte. 1 bpp keeps the first pixel in
+the top bit, 4 bpp in the high nibble. Ink outside the cell of the glyph,
+its advance by the line height, is cut so a cell can be redrawn alone.
+
+  python3 scripts/fonts/fontpack.py DejaVuSansMono.ttf 12 --bpp 4 --name font_mono_12
+
+writes Src/font_mono_12.c and Inc/font_mono_12.h. Needs Pillow.
+"""
+
+import argparse
+import os
+
+from PIL import Image, ImageDraw, ImageFont
+
+
+def render_glyph(font, char, advance, height, bpp, threshold):
+    image = Image.new('L', (advance, height), 0)
+    ImageDraw.Draw(image).text((0, 0), char, font=font, fill=255, anchor='la')
+    if bpp == 1:
+        image = image.point(lambda v: 255 if v >= threshold else 0)
+    else:
+        image = image.point(lambda v: (v * 15 + 127) // 255 * 17)
+
+    box = image.getbbox()
+    if box is None:
+        return None
+    left, top, right, bottom = box
+    width = right - left
+    pixels = image.load()
+
+    data = bytearray()
+    for y in range(top, bottom):
+        if bpp == 1:
+            row = 0
+            for x in range(width):
+                row = row << 1 | (pixels[left + x, y] != 0)
+            row <<= -width % 8
+            data += row.to_bytes((width + 7) // 8, 'big')
+        else:
+            for x in range(0, width, 2):
+                hi = pixels[left + x, y] // 17
+                lo = pixels[left + x + 1, y] // 17 if x + 1 < width else 0
+                data.append(hi << 4 | lo)
+    return left, top, width, bottom - top, bytes(data)
+
+
+def pack(path, size, bpp, first, last, threshold):
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    height = ascent + descent
+
+    atlas = bytearray()
+    glyphs = []
+    for code in range(first, last + 1):
+        char = chr(code)
+        advance = max(1, round(font.getlength(char)))
+        glyph = render_glyph(font, char, advance, height, bpp, threshold)
+        if glyph is None:
+            glyphs.append((len(atlas), 0, 0, 0, 0, advance, char))
+            continue
+        left, top, width, rows, data = glyph
+        glyphs.append((len(atlas), width, rows, left, top, advance, char))
+        atlas += data
+
+    return {
+        'height': height,
+        'baseline': ascent,
+        'atlas': bytes(atlas),
+        'glyphs': glyphs,
+    }
+
+
+def char_comment(char):
+    return repr(char) if char != '\\' else "'\\\\'"
+
+
+def write_source(out, name, source, size, bpp, first, packed):
+    glyphs = packed['glyphs']
+    default = ord('?') - first if first <= ord('?') < first + len(glyphs) else 0
+
+    lines = [
+        '// Generated by scripts/fonts/fontpack.py from %s at %d px, %d bpp' % (os.path.basename(source), size, bpp),
+        '#include "%s.h"' % name,
+        '',
+        'static const uint8_t atlas[%d] = {' % len(packed['atlas']),
+    ]
+    atlas = packed['atlas']
+    for i in range(0, len(atlas), 16):
+        lines.append('    ' + ' '.join('0x%02x,' % b for b in atlas[i:i + 16]))
+    lines += [
+        '};',
+        '',
+        'static const FONT_GlyphTypeDef glyphs[%d] = {' % len(glyphs),
+    ]
+    for offset, width, rows, left, top, advance, char in glyphs:
+        lines.append('    {%d, %d, %d, %d, %d, %d}, // %s' % (offset, width, rows, left, top, advance,
+                                                          char_comment(char)))
+    lines += [
+        '};',
+        '',
+        'const FONT_TypeDef %s = {' % name,
+        '    .Atlas = atlas,',
+        '    .Glyphs = glyphs,',
+        '    .First = %d,' % first,
+        '    .Count = %d,' % len(glyphs),
+        '    .Default = %d,' % default,
+        '    .Bpp = FONT_%dBPP,' % bpp,
+        '    .Height = %d,' % packed['height'],
+        '    .Baseline = %d,' % packed['baseline'],
+        '};',
+        '',
+    ]
+    with open(os.path.join(out, name + '.c'), 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+def write_header(out, name):
+    guard = 'LTDC_0_%s_H' % name.upper()
+    lines = [
+        '#ifndef %s' % guard,
+        '#define %s' % guard,
+        '',
+        '#include "font.h"',
+        '',
+        'extern const FONT_TypeDef %s;' % name,
+        '',
+        '#endif //%s' % guard,
+        '',
+    ]
+    with open(os.path.join(out, name + '.h'), 'w', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+def main():
+    here = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+    parser = argparse.ArgumentParser(description='Packs a font into a glyph atlas for font.c')
+    parser.add_argument('font', help='TrueType or OpenType file')
+    parser.add_argument('size', type=int, help='pixel size')
+    parser.add_argument('--bpp', type=int, choices=(1, 4), default=4)
+    parser.add_argument('--name', required=True, help='C name of the font and of its files')
+    parser.add_argument('--first', type=lambda v: int(v, 0), default=0x20, help='first character code')
+    parser.add_argument('--last', type=lambda v: int(v, 0), default=0x7e, help='last character code')
+    parser.add_argument('--threshold', type=int, default=128, help='coverage a 1 bpp pixel is set from, 0..255')
+    parser.add_argument('--src', default=os.path.join(here, 'Src'))
+    parser.add_argument('--inc', default=os.path.join(here, 'Inc'))
+    args = parser.parse_args()
+
+    if not 0 <= args.first <= args.last <= 0xff:
+        parser.error('character codes must be in 0..255')
+
+    packed = pack(args.font, args.size, args.bpp, args.first, args.last, args.threshold)
+    if packed['height'] > 255 or max(g[5] for g in packed['glyphs']) > 255:
+        parser.error('glyphs larger than 255 px')
+
+    write_source(args.src, args.name, args.font, args.size, args.bpp, args.first, packed)
+    write_header(args.inc, args.name)
+
+
+if __name__ == '__main__':
+    main()
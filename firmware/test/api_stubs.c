@@ -0,0 +1,323 @@
+#include "api.h"
+#include "debug_screen.h"
+#include "disp.h"
+#include "adv7393.h"
+#include "upload.h"
+#include "capture.h"
+#include "crc.h"
+#include "bandwidth.h"
+#include "tile.h"
+#include "raster.h"
+#include "render.h"
+#include "rotate.h"
+#include "picture.h"
+#include "pixel.h"
+#include "blend.h"
+#include "dlist.h"
+#include "mfd.h"
+#include "anim.h"
+#include "event.h"
+
+/**
+ * Inert stand-ins for the modules the API drives, the transport tests only
+ * run commands without side effects. DISP_setThrottle, HAL_GetTick and the
+ * event queue are provided by the test itself.
+ */
+uint32_t SystemCoreClock = 180000000U;
+
+void Error_Handler(void) {
+}
+
+uint8_t ADV7393_readReg(uint8_t reg) {
+  return 0;
+}
+
+HAL_StatusTypeDef ADV7393_writeReg(uint8_t reg, uint8_t value) {
+  return HAL_OK;
+}
+
+ANIM_StatsTypeDef ANIM_getStats(void) {
+  return (ANIM_StatsTypeDef) {0};
+}
+
+void ANIM_resetStats(void) {
+}
+
+BANDWIDTH_ResultTypeDef BANDWIDTH_check(const BANDWIDTH_EstimateTypeDef *estimate) {
+  return BANDWIDTH_OK;
+}
+
+BANDWIDTH_EstimateTypeDef BANDWIDTH_estimate(const DISP_LTDC_ConfigTypeDef *cfg, uint32_t pixelClock) {
+  return (BANDWIDTH_EstimateTypeDef) {0};
+}
+
+uint8_t BANDWIDTH_getDrawReservePercent(void) {
+  return 0;
+}
+
+BANDWIDTH_PolicyTypeDef BANDWIDTH_getPolicy(void) {
+  return BANDWIDTH_POLICY_OFF;
+}
+
+void BANDWIDTH_setPolicy(BANDWIDTH_PolicyTypeDef policy, uint8_t drawReservePercent) {
+}
+
+uint8_t BLEND_getPixelSize(BLEND_FormatTypeDef format) {
+  return 2;
+}
+
+HAL_StatusTypeDef BLEND_rect(uint16_t *dst, uint32_t dstStride, const void *src, uint32_t srcStride,
+                             BLEND_FormatTypeDef format, uint8_t alpha, uint16_t width, uint16_t height) {
+  return HAL_OK;
+}
+
+void BLEND_rectCpu(uint16_t *dst, uint32_t dstStride, const void *src, uint32_t srcStride,
+                   BLEND_FormatTypeDef format, uint8_t alpha, uint16_t width, uint16_t height) {
+}
+
+uint8_t CAPTURE_begin(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+  return 0;
+}
+
+uint8_t CAPTURE_isActive(void) {
+  return 0;
+}
+
+uint8_t CAPTURE_read(uint8_t *data, uint8_t size) {
+  return 0;
+}
+
+uint32_t CRC_calc(uint32_t crc, const uint8_t *data, uint32_t size) {
+  return crc;
+}
+
+uint8_t DEBUG_SCREEN_animate(uint8_t animation, uint8_t speed, uint32_t budgetUs) {
+  return 1;
+}
+
+void DEBUG_SCREEN_cancelPrepared(void) {
+}
+
+uint8_t DEBUG_SCREEN_isPreparing(void) {
+  return 0;
+}
+
+void DEBUG_SCREEN_next(void) {
+}
+
+void DEBUG_SCREEN_prepare(uint8_t next) {
+}
+
+void DEBUG_SCREEN_prev(void) {
+}
+
+void DEBUG_SCREEN_reInit(void) {
+}
+
+void DEBUG_SCREEN_showExternal(void) {
+}
+
+void DEBUG_SCREEN_showList(uint8_t slot, uint8_t rendered) {
+}
+
+uint8_t DEBUG_SCREEN_showPrepared(void) {
+  return 0;
+}
+
+DISP_LTDC_ClockConfigTypeDef DISP_Get_Clock_Config(void) {
+  return (DISP_LTDC_ClockConfigTypeDef) {0};
+}
+
+void DISP_Set_Clock_Config(DISP_LTDC_ClockConfigTypeDef *cfg) {
+}
+
+HAL_StatusTypeDef DISP_applyConfig(DISP_LTDC_ConfigTypeDef *newCfg) {
+  return HAL_OK;
+}
+
+uint32_t DISP_calcPixelClockFreq(const DISP_LTDC_ClockConfigTypeDef *cfg) {
+  return 0;
+}
+
+uint32_t DISP_frameChecksum(DISP_RectTypeDef rect) {
+  return 0;
+}
+
+uint8_t DISP_getActivePage(void) {
+  return 0;
+}
+
+DISP_ChecksumWatchTypeDef DISP_getChecksumWatch(void) {
+  return (DISP_ChecksumWatchTypeDef) {0};
+}
+
+DISP_LTDC_ConfigTypeDef DISP_getCurrentCfg(void) {
+  return (DISP_LTDC_ConfigTypeDef) {0};
+}
+
+uint32_t DISP_getDrawAddress(void) {
+  return 0;
+}
+
+DISP_ErrorStatsTypeDef DISP_getErrorStats(void) {
+  return (DISP_ErrorStatsTypeDef) {0};
+}
+
+uint32_t DISP_getFrameCount(void) {
+  return 0;
+}
+
+uint32_t DISP_getFramePeriodUs(void) {
+  return 20000;
+}
+
+uint32_t DISP_getLtdcPixelClockFreq(void) {
+  return 0;
+}
+
+uint32_t DISP_getPageAddress(uint8_t page) {
+  return 0;
+}
+
+uint16_t DISP_getScanline(void) {
+  return 0;
+}
+
+uint32_t DISP_getScreenHeight(void) {
+  return 0;
+}
+
+uint32_t DISP_getScreenWidth(void) {
+  return 0;
+}
+
+void DISP_resetErrorStats(void) {
+}
+
+void DISP_showPage(uint8_t page) {
+}
+
+void DISP_watchChecksum(DISP_RectTypeDef rect, uint16_t interval) {
+}
+
+DLIST_StatusTypeDef DLIST_begin(uint8_t slot, uint32_t size) {
+  return DLIST_OK;
+}
+
+DLIST_StatusTypeDef DLIST_buildSlot(uint8_t slot) {
+  return DLIST_OK;
+}
+
+DLIST_StatusTypeDef DLIST_chunk(uint32_t offset, const uint8_t *data, uint8_t size, uint32_t crc) {
+  return DLIST_OK;
+}
+
+DLIST_StatusTypeDef DLIST_end(void) {
+  return DLIST_OK;
+}
+
+uint32_t DLIST_getSize(uint8_t slot) {
+  return 0;
+}
+
+uint32_t EVENT_cycles(void) {
+  return 0;
+}
+
+EVENT_StatsTypeDef EVENT_getStats(void) {
+  return (EVENT_StatsTypeDef) {0};
+}
+
+void EVENT_resetStats(void) {
+}
+
+uint8_t MFD_getCount(void) {
+  return 0;
+}
+
+MFD_StatsTypeDef MFD_getStats(void) {
+  return (MFD_StatsTypeDef) {0};
+}
+
+void MFD_resetStats(void) {
+}
+
+uint8_t MFD_setValue(uint8_t index, int32_t value) {
+  return 0;
+}
+
+uint8_t PIXEL_check(PIXEL_KernelTypeDef kernel, uint32_t *refCycles, uint32_t *simdCycles) {
+  return 1;
+}
+
+uint8_t RASTER_bands(const uint32_t *colors, uint8_t count, uint8_t hideLayer) {
+  return 1;
+}
+
+void RASTER_clear(void) {
+}
+
+uint8_t RASTER_fade(uint32_t background, uint8_t from, uint8_t to) {
+  return 1;
+}
+
+RASTER_StatsTypeDef RASTER_getStats(void) {
+  return (RASTER_StatsTypeDef) {0};
+}
+
+uint8_t RASTER_ramp(uint32_t from, uint32_t to, uint8_t hideLayer) {
+  return 1;
+}
+
+void RASTER_resetStats(void) {
+}
+
+void RENDER_cancel(void) {
+}
+
+void ROTATE_copy(const uint16_t *src, uint16_t srcWidth, uint16_t srcHeight, ROTATE_AngleTypeDef angle,
+                 uint8_t mirror, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t *dst,
+                 uint32_t dstStride) {
+}
+
+void TILE_clear(void) {
+}
+
+uint8_t TILE_getBeamMode(void) {
+  return 0;
+}
+
+uint8_t TILE_pattern(uint8_t pattern) {
+  return 1;
+}
+
+HAL_StatusTypeDef TILE_renderAll(void) {
+  return HAL_OK;
+}
+
+void TILE_setBeamMode(uint8_t enabled) {
+}
+
+HAL_StatusTypeDef TILE_wait(void) {
+  return HAL_OK;
+}
+
+UPLOAD_StatusTypeDef UPLOAD_begin(const UPLOAD_HeaderTypeDef *header) {
+  return UPLOAD_OK;
+}
+
+UPLOAD_StatusTypeDef UPLOAD_chunk(uint32_t offset, const uint8_t *data, uint8_t size, uint32_t crc) {
+  return UPLOAD_OK;
+}
+
+UPLOAD_StatusTypeDef UPLOAD_end(void) {
+  return UPLOAD_OK;
+}
+
+UPLOAD_InfoTypeDef UPLOAD_getInfo(void) {
+  return (UPLOAD_InfoTypeDef) {0};
+}
+
+uint16_t *get_fox_240x320(void) {
+  return NULL;
+}
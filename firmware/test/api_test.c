@@ -0,0 +1,260 @@
+#include <stdio.h>
+#include <string.h>
+#include "api.h"
+#include "api_transport.h"
+#include "disp.h"
+#include "event.h"
+
+/**
+ * The packet layer driven through the loopback transport: checksum, sequence ids,
+ * packets split across reads, batches and resync after a partial packet.
+ * Command and status values follow api.c.
+ */
+#define PACKET_SIZE 64
+#define SEQ_OFFSET (PACKET_SIZE - 2)
+#define RESYNC_GAP_MS 6 // longer than RX_RESYNC_MS
+
+#define GET_CONFIG 0xc3
+#define BATCH_BEGIN 0xc9
+#define BATCH_COMMIT 0xca
+#define SET_THROTTLE 0xd5
+#define ACK 0xf5
+#define BATCH_RESULT 0xf6
+
+#define STATUS_OK 0x00
+#define STATUS_UNKNOWN_COMMAND 0x01
+#define STATUS_NO_BATCH 0x04
+#define STATUS_NOT_SUPPORTED 0x05
+
+static uint32_t tick = 0;
+static int throttle = -1;
+static EVENT_HandlerTypeDef packetHandler;
+static uint8_t packetPosted = 0;
+static uint32_t failures = 0;
+
+uint32_t HAL_GetTick(void) {
+  return tick;
+}
+
+void DISP_setThrottle(DISP_ThrottleTypeDef mode) {
+  throttle = mode;
+}
+
+void EVENT_subscribe(EVENT_TypeTypeDef type, EVENT_HandlerTypeDef handler) {
+  if (type == EVENT_API_PACKET) {
+    packetHandler = handler;
+  }
+}
+
+uint8_t EVENT_post(EVENT_SourceTypeDef source, EVENT_TypeTypeDef type, uint32_t arg) {
+  packetPosted = 1;
+  return 1;
+}
+
+#define CHECK(condition)                                      \
+  do {                                                        \
+    if (!(condition)) {                                       \
+      printf("%s:%d: %s\n", __func__, __LINE__, #condition);  \
+      failures++;                                             \
+    }                                                         \
+  } while (0)
+
+static void buildPacket(uint8_t *packet, uint8_t cmd, const uint8_t *payload, uint8_t size, uint8_t seq) {
+  memset(packet, 0xFF, PACKET_SIZE);
+  packet[0] = cmd;
+  packet[1] = size;
+  memcpy(&packet[2], payload, size);
+  packet[SEQ_OFFSET] = seq;
+
+  uint8_t crc = 0;
+  for (int i = 0; i < PACKET_SIZE - 1; i++) {
+    crc += packet[i];
+  }
+  packet[PACKET_SIZE - 1] = crc;
+}
+
+/**
+ * Runs what the main loop would on EVENT_API_PACKET
+ */
+static void dispatch(void) {
+  if (packetPosted) {
+    packetPosted = 0;
+    packetHandler(NULL);
+  }
+}
+
+static void send(const uint8_t *data, uint16_t size) {
+  API_TRANSPORT_loopbackWrite(data, size);
+  dispatch();
+}
+
+static void sendCommand(uint8_t cmd, const uint8_t *payload, uint8_t size, uint8_t seq) {
+  uint8_t packet[PACKET_SIZE];
+  buildPacket(packet, cmd, payload, size, seq);
+  send(packet, PACKET_SIZE);
+}
+
+/**
+ * Next reply, 0 when nothing was sent. Every reply has to carry a valid checksum.
+ */
+static uint8_t readReply(uint8_t *reply) {
+  uint16_t size = API_TRANSPORT_loopbackRead(reply, PACKET_SIZE);
+  if (size == 0) {
+    return 0;
+  }
+  CHECK(size == PACKET_SIZE);
+
+  uint8_t crc = 0;
+  for (int i = 0; i < PACKET_SIZE - 1; i++) {
+    crc += reply[i];
+  }
+  CHECK(crc == reply[PACKET_SIZE - 1]);
+  return 1;
+}
+
+static void expectAck(uint8_t cmd, uint8_t status, uint8_t seq) {
+  uint8_t reply[PACKET_SIZE];
+  if (!readReply(reply)) {
+    printf("no ACK for 0x%02x seq %u\n", cmd, seq);
+    failures++;
+    return;
+  }
+  CHECK(reply[0] == ACK);
+  CHECK(reply[1] == 2);
+  CHECK(reply[2] == cmd);
+  CHECK(reply[3] == status);
+  CHECK(reply[SEQ_OFFSET] == seq);
+}
+
+static void expectNoReply(void) {
+  uint8_t reply[PACKET_SIZE];
+  CHECK(!readReply(reply));
+}
+
+static void testAck(void) {
+  uint8_t mode = DISP_THROTTLE_ON;
+  sendCommand(SET_THROTTLE, &mode, 1, 0x11);
+  expectAck(SET_THROTTLE, STATUS_OK, 0x11);
+  CHECK(throttle == DISP_THROTTLE_ON);
+
+  sendCommand(0x42, NULL, 0, 0x12);
+  expectAck(0x42, STATUS_UNKNOWN_COMMAND, 0x12);
+  expectNoReply();
+}
+
+static void testBadCrc(void) {
+  uint8_t mode = DISP_THROTTLE_AUTO;
+  uint8_t packet[PACKET_SIZE];
+  buildPacket(packet, SET_THROTTLE, &mode, 1, 0x21);
+  packet[PACKET_SIZE - 1]++;
+  throttle = -1;
+  send(packet, PACKET_SIZE);
+  expectNoReply();
+  CHECK(throttle == -1);
+
+  // Dropped packet-wise, the next one is received as usual
+  sendCommand(SET_THROTTLE, &mode, 1, 0x22);
+  expectAck(SET_THROTTLE, STATUS_OK, 0x22);
+  CHECK(throttle == DISP_THROTTLE_AUTO);
+}
+
+static void testSplit(void) {
+  uint8_t mode = DISP_THROTTLE_OFF;
+  uint8_t packet[PACKET_SIZE];
+  buildPacket(packet, SET_THROTTLE, &mode, 1, 0x31);
+
+  for (uint16_t i = 0; i < PACKET_SIZE; i++) {
+    send(&packet[i], 1);
+    if (i < PACKET_SIZE - 1) {
+      expectNoReply();
+    }
+  }
+  expectAck(SET_THROTTLE, STATUS_OK, 0x31);
+
+  // Two packets in odd chunks, as a USB bridge hands them over
+  uint8_t stream[PACKET_SIZE * 2];
+  buildPacket(stream, SET_THROTTLE, &mode, 1, 0x32);
+  buildPacket(stream + PACKET_SIZE, SET_THROTTLE, &mode, 1, 0x33);
+  send(stream, 23);
+  send(stream + 23, 77);
+  send(stream + 100, 28);
+  expectAck(SET_THROTTLE, STATUS_OK, 0x32);
+  expectAck(SET_THROTTLE, STATUS_OK, 0x33);
+  expectNoReply();
+}
+
+static void testBatch(void) {
+  sendCommand(BATCH_COMMIT, NULL, 0, 0x40);
+  expectAck(BATCH_COMMIT, STATUS_NO_BATCH, 0x40);
+
+  uint8_t mode = DISP_THROTTLE_ON;
+  throttle = -1;
+  sendCommand(BATCH_BEGIN, NULL, 0, 0x41);
+  expectAck(BATCH_BEGIN, STATUS_OK, 0x41);
+
+  // Queued without replies until the commit
+  sendCommand(SET_THROTTLE, &mode, 1, 0x42);
+  sendCommand(GET_CONFIG, NULL, 0, 0x43);
+  expectNoReply();
+  CHECK(throttle == -1);
+
+  sendCommand(BATCH_COMMIT, NULL, 0, 0x44);
+  uint8_t reply[PACKET_SIZE];
+  CHECK(readReply(reply));
+  CHECK(reply[0] == BATCH_RESULT);
+  CHECK(reply[1] == 5);
+  CHECK(reply[2] == STATUS_OK);
+  CHECK(reply[3] == 0x42);
+  CHECK(reply[4] == STATUS_OK);
+  // Commands with their own reply would send it unsequenced, they are refused
+  CHECK(reply[5] == 0x43);
+  CHECK(reply[6] == STATUS_NOT_SUPPORTED);
+  CHECK(reply[SEQ_OFFSET] == 0x44);
+  CHECK(throttle == DISP_THROTTLE_ON);
+  expectNoReply();
+}
+
+static void testResync(void) {
+  uint8_t mode = DISP_THROTTLE_OFF;
+  uint8_t partial[PACKET_SIZE];
+  buildPacket(partial, SET_THROTTLE, &mode, 1, 0x50);
+
+  // The rest of a packet lost on the line, the idle gap drops what was received
+  send(partial, 20);
+  tick += RESYNC_GAP_MS;
+  sendCommand(SET_THROTTLE, &mode, 1, 0x51);
+  expectAck(SET_THROTTLE, STATUS_OK, 0x51);
+  expectNoReply();
+
+  // Without the gap the next packet is misaligned and fails its checksum
+  send(partial, 20);
+  sendCommand(SET_THROTTLE, &mode, 1, 0x52);
+  expectNoReply();
+  tick += RESYNC_GAP_MS;
+  sendCommand(SET_THROTTLE, &mode, 1, 0x53);
+  expectAck(SET_THROTTLE, STATUS_OK, 0x53);
+
+  // A line error reported by the transport drops the partial packet right away
+  send(partial, 20);
+  API_resetReceive();
+  sendCommand(SET_THROTTLE, &mode, 1, 0x54);
+  expectAck(SET_THROTTLE, STATUS_OK, 0x54);
+  expectNoReply();
+}
+
+int main(void) {
+  API_Init(API_TRANSPORT_loopback());
+
+  testAck();
+  testBadCrc();
+  testSplit();
+  testBatch();
+  testResync();
+
+  if (failures) {
+    printf("%u failures\n", failures);
+    return 1;
+  }
+  printf("API packet layer ok\n");
+  return 0;
+}
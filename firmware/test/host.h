@@ -0,0 +1,42 @@
+#ifndef LTDC_0_TEST_HOST_H
+#define LTDC_0_TEST_HOST_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * C versions of the CMSIS intrinsics used by the portable modules, following the
+ * instruction descriptions. The GE flags of USUB16 are kept for SEL.
+ */
+static uint32_t hostGe;
+
+static inline uint32_t __PKHBT(uint32_t a, uint32_t b, uint32_t shift) {
+  return (a & 0x0000FFFFU) | (b << shift & 0xFFFF0000U);
+}
+
+static inline uint32_t __PKHTB(uint32_t a, uint32_t b, uint32_t shift) {
+  return (a & 0xFFFF0000U) | (b >> shift & 0x0000FFFFU);
+}
+
+static inline uint32_t __USUB16(uint32_t a, uint32_t b) {
+  uint32_t low = (a & 0xFFFF) - (b & 0xFFFF);
+  uint32_t high = (a >> 16) - (b >> 16);
+  // Set where the lane did not borrow
+  hostGe = (low & 0x10000 ? 0 : 0x3) | (high & 0x10000 ? 0 : 0xC);
+  return (low & 0xFFFF) | high << 16;
+}
+
+static inline void __DMB(void) {
+  __sync_synchronize();
+}
+
+static inline uint32_t __SEL(uint32_t a, uint32_t b) {
+  uint32_t result = 0;
+  for (uint32_t i = 0; i < 4; i++) {
+    uint32_t mask = 0xFFU << (i * 8);
+    result |= (hostGe >> i & 1 ? a : b) & mask;
+  }
+  return result;
+}
+
+#endif //LTDC_0_TEST_HOST_H
@@ -0,0 +1,208 @@
+#include <stdio.h>
+#include <string.h>
+#include "pixel.h"
+
+/**
+ * Every kernel against its reference: all RGB565 values where the kernel takes one,
+ * random pairs where it takes two, over the whole alpha or factor range.
+ * Rows are run aligned and shifted by a pixel with an odd length.
+ */
+#define ROW 4096
+
+static uint16_t rowA[ROW + 1];
+static uint16_t rowB[ROW + 1];
+static uint32_t rowArgb[ROW + 1];
+static uint16_t outRef[ROW + 1];
+static uint16_t outSimd[ROW + 1];
+
+static uint32_t seed = 0x2545F491;
+static uint32_t failures = 0;
+
+uint32_t EVENT_cycles(void) {
+  return 0;
+}
+
+static uint32_t random32(void) {
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}
+
+static void fillRandom(void) {
+  for (uint32_t i = 0; i <= ROW; i++) {
+    rowA[i] = (uint16_t) random32();
+    rowB[i] = (uint16_t) random32();
+    rowArgb[i] = random32();
+  }
+}
+
+/**
+ * Both outputs start from rowB, the color key and the alpha blends keep destination pixels
+ */
+static void resetOut(void) {
+  memcpy(outRef, rowB, sizeof(outRef));
+  memcpy(outSimd, rowB, sizeof(outSimd));
+}
+
+static void compare(const char *name, uint32_t param, uint32_t offset) {
+  for (uint32_t i = 0; i <= ROW; i++) {
+    if (outRef[i] != outSimd[i]) {
+      printf("%s param %u offset %u: pixel %u is 0x%04x, expected 0x%04x\n", name, param, offset, i, outSimd[i],
+             outRef[i]);
+      failures++;
+      return;
+    }
+  }
+}
+
+static void testSwap(void) {
+  for (uint32_t base = 0; base < 0x10000; base += ROW) {
+    for (uint32_t i = 0; i <= ROW; i++) {
+      rowA[i] = (uint16_t) (base + i);
+    }
+    for (uint32_t offset = 0; offset < 2; offset++) {
+      resetOut();
+      PIXEL_swapRef(outRef + offset, rowA + offset, ROW - offset);
+      PIXEL_swap(outSimd + offset, rowA + offset, ROW - offset);
+      compare("swap", base, offset);
+    }
+  }
+}
+
+static void testBlend(void) {
+  for (uint32_t alpha = 0; alpha < 256; alpha++) {
+    fillRandom();
+    for (uint32_t offset = 0; offset < 2; offset++) {
+      resetOut();
+      PIXEL_blendRef(outRef + offset, rowA + offset, rowB + offset, alpha, ROW - offset);
+      PIXEL_blend(outSimd + offset, rowA + offset, rowB + offset, alpha, ROW - offset);
+      compare("blend", alpha, offset);
+    }
+  }
+}
+
+static void testScale(void) {
+  // Factors above 256 are clamped
+  for (uint32_t factor = 0; factor <= 260; factor++) {
+    for (uint32_t base = 0; base < 0x10000; base += ROW) {
+      for (uint32_t i = 0; i <= ROW; i++) {
+        rowA[i] = (uint16_t) (base + i);
+      }
+      for (uint32_t offset = 0; offset < 2; offset++) {
+        resetOut();
+        PIXEL_scaleRef(outRef + offset, rowA + offset, factor, ROW - offset);
+        PIXEL_scale(outSimd + offset, rowA + offset, factor, ROW - offset);
+        compare("scale", factor, offset);
+      }
+    }
+  }
+}
+
+static void testColorKey(void) {
+  for (uint32_t k = 0; k < 64; k++) {
+    fillRandom();
+    uint16_t key = k == 0 ? 0 : k == 1 ? 0xFFFF : rowA[0];
+    // Keyed runs of every length and phase
+    for (uint32_t i = 0; i <= ROW; i++) {
+      if (random32() % 3 == 0) {
+        rowA[i] = key;
+      }
+    }
+    for (uint32_t offset = 0; offset < 2; offset++) {
+      resetOut();
+      PIXEL_colorKeyRef(outRef + offset, rowA + offset, key, ROW - offset);
+      PIXEL_colorKey(outSimd + offset, rowA + offset, key, ROW - offset);
+      compare("color key", key, offset);
+    }
+  }
+}
+
+static void testConvert(void) {
+  for (uint32_t n = 0; n < 64; n++) {
+    fillRandom();
+    for (uint32_t offset = 0; offset < 2; offset++) {
+      resetOut();
+      PIXEL_convertRef(outRef + offset, rowArgb + offset, ROW - offset);
+      PIXEL_convert(outSimd + offset, rowArgb + offset, ROW - offset);
+      compare("convert", n, offset);
+    }
+  }
+}
+
+/**
+ * Mostly transparent and opaque pairs like overlays, with mixed and partial ones in between
+ */
+static void shapeAlpha(void) {
+  for (uint32_t i = 0; i <= ROW; i++) {
+    switch (random32() % 4) {
+      case 0:
+        rowArgb[i] &= 0x00FFFFFF;
+        break;
+      case 1:
+        rowArgb[i] |= 0xFF000000;
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+static void testBlendArgb4444(void) {
+  uint16_t src[ROW + 1];
+  for (uint32_t alpha = 0; alpha < 256; alpha++) {
+    for (uint32_t base = 0; base < 0x10000; base += ROW) {
+      fillRandom();
+      for (uint32_t i = 0; i <= ROW; i++) {
+        src[i] = (uint16_t) (base + i);
+      }
+      for (uint32_t offset = 0; offset < 2; offset++) {
+        resetOut();
+        PIXEL_blendArgb4444Ref(outRef + offset, src + offset, alpha, ROW - offset);
+        PIXEL_blendArgb4444(outSimd + offset, src + offset, alpha, ROW - offset);
+        compare("blend ARGB4444", alpha, offset);
+      }
+    }
+  }
+}
+
+static void testBlendArgb8888(void) {
+  for (uint32_t alpha = 0; alpha < 256; alpha++) {
+    for (uint32_t n = 0; n < 4; n++) {
+      fillRandom();
+      shapeAlpha();
+      for (uint32_t offset = 0; offset < 2; offset++) {
+        resetOut();
+        PIXEL_blendArgb8888Ref(outRef + offset, rowArgb + offset, alpha, ROW - offset);
+        PIXEL_blendArgb8888(outSimd + offset, rowArgb + offset, alpha, ROW - offset);
+        compare("blend ARGB8888", alpha, offset);
+      }
+    }
+  }
+}
+
+int main(void) {
+  testSwap();
+  testBlend();
+  testScale();
+  testColorKey();
+  testConvert();
+  testBlendArgb4444();
+  testBlendArgb8888();
+
+  // The self check the firmware runs on the target
+  for (uint32_t kernel = 0; kernel < PIXEL_KERNEL_COUNT; kernel++) {
+    uint32_t refCycles, simdCycles;
+    if (!PIXEL_check(kernel, &refCycles, &simdCycles)) {
+      printf("PIXEL_check failed for kernel %u\n", kernel);
+      failures++;
+    }
+  }
+
+  if (failures) {
+    printf("%u failures\n", failures);
+    return 1;
+  }
+  printf("all kernels match their references\n");
+  return 0;
+}